@@ -1,13 +1,21 @@
 using System.Collections.Frozen;
+using Vista.SDK.Transport;
 
 namespace Vista.SDK.Benchmarks.Codebooks;
 
 [Config(typeof(Config))]
+[GroupBenchmarksBy(BenchmarkLogicalGroupRule.ByCategory), CategoriesColumn]
 public class CodebooksLookup
 {
     private Dictionary<CodebookName, Codebook> _dict;
     private FrozenDictionary<CodebookName, Codebook> _frozenDict;
     private SDK.Codebooks _codebooks;
+    private HashSet<string> _standardValues;
+    private Dictionary<string, DataChannelTypeName> _typeNames;
+    private DataChannelTypeNames _dataChannelTypeNames;
+
+    // A metadata tag segment of a local ID, as the parser sees it
+    private const string Segment = "qty-temperature";
 
     [GlobalSetup]
     public void Setup()
@@ -21,21 +29,29 @@ public void Setup()
             _dict[codebook.Name] = codebook.Codebook;
 
         _frozenDict = _dict.ToFrozenDictionary();
+
+        _standardValues = new HashSet<string>(_codebooks[CodebookName.Quantity].StandardValues);
+
+        _dataChannelTypeNames = ISO19848.Instance.GetDataChannelTypeNames(ISO19848Version.v2024);
+        _typeNames = _dataChannelTypeNames.ToDictionary(t => t.Type);
     }
 
     [Benchmark(Baseline = true)]
+    [BenchmarkCategory("Codebook")]
     public bool Dict() =>
         _dict.TryGetValue(CodebookName.Quantity, out _)
         && _dict.TryGetValue(CodebookName.Type, out _)
         && _dict.TryGetValue(CodebookName.Detail, out _);
 
     [Benchmark]
+    [BenchmarkCategory("Codebook")]
     public bool FrozenDict() =>
         _frozenDict.TryGetValue(CodebookName.Quantity, out _)
         && _frozenDict.TryGetValue(CodebookName.Type, out _)
         && _frozenDict.TryGetValue(CodebookName.Detail, out _);
 
     [Benchmark]
+    [BenchmarkCategory("Codebook")]
     public bool Codebooks()
     {
         var a = _codebooks.GetCodebook(CodebookName.Quantity);
@@ -44,6 +60,31 @@ public bool Codebooks()
         return a is not null && b is not null && c is not null;
     }
 
+    [Benchmark(Baseline = true)]
+    [BenchmarkCategory("Standard value")]
+    public bool StandardValueHashSet() => _standardValues.Contains(Segment.Substring(4));
+
+    [Benchmark]
+    [BenchmarkCategory("Standard value")]
+    public bool StandardValue() => _codebooks[CodebookName.Quantity].HasStandardValue(Segment.AsSpan(4));
+
+    [Benchmark(Baseline = true)]
+    [BenchmarkCategory("Create tag")]
+    public MetadataTag? TryCreateTagString() => _codebooks.TryCreateTag(CodebookName.Quantity, Segment.Substring(4));
+
+    [Benchmark]
+    [BenchmarkCategory("Create tag")]
+    public MetadataTag? TryCreateTagSpan() => _codebooks.TryCreateTag(CodebookName.Quantity, Segment.AsSpan(4));
+
+    [Benchmark(Baseline = true)]
+    [BenchmarkCategory("Data channel type")]
+    public bool DataChannelTypeDict() => _typeNames.ContainsKey("Average");
+
+    [Benchmark]
+    [BenchmarkCategory("Data channel type")]
+    public bool DataChannelTypeParse() =>
+        _dataChannelTypeNames.Parse("Average") is DataChannelTypeNames.ParseResult.Ok;
+
     internal sealed class Config : ManualConfig
     {
         public Config()
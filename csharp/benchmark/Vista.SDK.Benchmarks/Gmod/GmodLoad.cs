@@ -3,13 +3,27 @@ namespace Vista.SDK.Benchmarks.Gmod;
 [Config(typeof(Config))]
 public class GmodLoad
 {
-    [Benchmark]
+    [Benchmark(Baseline = true)]
     public SDK.Gmod Load()
     {
         var dto = VIS.LoadGmodDto(VisVersion.v3_7a);
         return new SDK.Gmod(VisVersion.v3_7a, dto);
     }
 
+    [Benchmark]
+    public SDK.Gmod LoadSnapshot()
+    {
+        using var store = VIS.LoadGmodStore(VisVersion.v3_7a)!;
+        return new SDK.Gmod(VisVersion.v3_7a, store);
+    }
+
+    [Benchmark]
+    public SDK.Gmod LoadMapped()
+    {
+        var store = VIS.LoadGmodStore(VisVersion.v3_7a)!;
+        return new SDK.Gmod(VisVersion.v3_7a, store, mapped: true);
+    }
+
     internal sealed class Config : ManualConfig
     {
         public Config()
@@ -9,6 +9,15 @@ public class GmodPathParse
     private SDK.Gmod _gmod;
     private Locations _locations;
 
+    private static readonly string[] _paths =
+    [
+        "411.1/C101.72/I101",
+        "612.21-1/C701.13/S93",
+        "411.1/C101.31-2",
+        "1021.1i-6P/H123",
+    ];
+    private readonly GmodPath?[] _parsed = new GmodPath?[_paths.Length];
+
     [GlobalSetup]
     public void Setup()
     {
@@ -36,4 +45,19 @@ public void Setup()
             _locations,
             out _
         );
+
+    [Benchmark(Baseline = true), BenchmarkCategory("Batch")]
+    public int TryParseEach()
+    {
+        var parsed = 0;
+        foreach (var path in _paths)
+        {
+            if (GmodPath.TryParse(path, _gmod, _locations, out _))
+                parsed++;
+        }
+        return parsed;
+    }
+
+    [Benchmark, BenchmarkCategory("Batch")]
+    public int TryParsePaths() => GmodPath.TryParsePaths(_paths, _gmod, _locations, _parsed);
 }
@@ -17,6 +17,10 @@ public void Setup()
         _gmod = vis.GetGmod(VisVersion.v3_4a);
     }
 
-    [Benchmark]
+    [Benchmark(Baseline = true)]
     public bool FullTraversal() => _gmod.Traverse((_, _) => TraversalHandlerResult.Continue);
+
+    [Benchmark]
+    public bool FullTraversalParallel() =>
+        _gmod.TraverseParallel(() => 0, (_, _, _) => TraversalHandlerResult.Continue, out _);
 }
@@ -8,14 +8,29 @@ public class GmodVersioningConvertPath
 {
     private Gmod _gmod;
     private GmodPath _gmodPath;
+    private GmodPath[] _batch;
 
     [GlobalSetup]
     public void Setup()
     {
         _gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
         _gmodPath = _gmod.ParsePath("411.1/C101.72/I101");
+
+        // A fleet's worth of data channels shares a small set of paths
+        var paths = new[] { "411.1/C101.72/I101", "411.1/C101.31-2", "411.1/C101.63/S206", "511.11-1/C101.663i/C663" }
+            .Select(_gmod.ParsePath)
+            .ToArray();
+        _batch = Enumerable.Range(0, 1000).Select(i => paths[i % paths.Length]).ToArray();
     }
 
     [Benchmark]
     public GmodPath ConvertPath() => VIS.Instance.ConvertPath(VisVersion.v3_4a, _gmodPath, VisVersion.v3_5a);
+
+    [Benchmark]
+    public GmodPath ConvertPathMultiHop() =>
+        VIS.Instance.ConvertPath(VisVersion.v3_4a, _gmodPath, VIS.LatestVisVersion);
+
+    [Benchmark(OperationsPerInvoke = 1000)]
+    public IReadOnlyList<GmodPath> ConvertPathsMultiHopBatch() =>
+        VIS.Instance.ConvertPaths(_batch, VIS.LatestVisVersion);
 }
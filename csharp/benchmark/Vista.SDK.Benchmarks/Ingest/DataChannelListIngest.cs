@@ -0,0 +1,63 @@
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+using Domain = Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Benchmarks.Ingest;
+
+/// <summary>
+/// Receiving a ship's data channel list: reading the JSON, building the domain model,
+/// which parses and validates every local ID and property, and writing it back out
+/// </summary>
+[Config(typeof(IngestConfig))]
+public class DataChannelListIngest
+{
+    private Domain.DataChannelListPackage _package;
+    private DataChannelListPackage _dto;
+    private byte[] _json;
+    private MemoryStream _stream;
+
+    [Params(30_000)]
+    public int DataChannels { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _package = IngestData.CreateDataChannelList(DataChannels);
+        _dto = _package.ToJsonDto();
+        _stream = new MemoryStream();
+        _dto.Serialize(_stream);
+        _json = _stream.ToArray();
+        Console.WriteLine($"// Payload size: {_json.Length / 1024} KB");
+    }
+
+    [GlobalCleanup]
+    public void Cleanup() => _stream.Dispose();
+
+    [Benchmark]
+    [BenchmarkCategory("Parse")]
+    public DataChannelListPackage Deserialize()
+    {
+        using var stream = new MemoryStream(_json, writable: false);
+        return Serializer.DeserializeDataChannelList(stream);
+    }
+
+    [Benchmark]
+    [BenchmarkCategory("Validate")]
+    public Domain.DataChannelListPackage ToDomainModel() => _dto.ToDomainModel();
+
+    [Benchmark]
+    [BenchmarkCategory("Parse")]
+    public Domain.DataChannelListPackage Ingest()
+    {
+        using var stream = new MemoryStream(_json, writable: false);
+        return Serializer.DeserializeDataChannelList(stream).ToDomainModel();
+    }
+
+    [Benchmark]
+    [BenchmarkCategory("Serialize")]
+    public void Serialize()
+    {
+        _stream.SetLength(0);
+        _package.ToJsonDto().Serialize(_stream);
+    }
+}
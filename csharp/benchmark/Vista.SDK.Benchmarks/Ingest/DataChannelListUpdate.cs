@@ -0,0 +1,80 @@
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+using Domain = Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Benchmarks.Ingest;
+
+/// <summary>
+/// Receiving a new configuration of a ship's data channel list that changes a few channels:
+/// building the list and its query index from the new package, or applying the diff to the ones in use
+/// </summary>
+[Config(typeof(IngestConfig))]
+public class DataChannelListUpdate
+{
+    private DataChannelListPackage _currentDto;
+    private DataChannelListPackage _updatedDto;
+    private Domain.DataChannelListPackage _package;
+    private Domain.DataChannelListIndex _index;
+
+    [Params(30_000)]
+    public int DataChannels { get; set; }
+
+    [Params(10, 300)]
+    public int Changes { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var package = IngestData.CreateDataChannelList(DataChannels);
+        var dataChannels = package.DataChannelList.DataChannels;
+        var codebooks = VIS.Instance.GetCodebooks(VisVersion.v3_4a);
+
+        // Modified, removed and added channels in turn, spread over the list
+        var updated = new Domain.DataChannelList(dataChannels);
+        var step = dataChannels.Count / Changes;
+        for (var i = 0; i < Changes; i++)
+        {
+            var dataChannel = dataChannels[i * step];
+            var id = dataChannel.DataChannelId;
+            switch (i % 3)
+            {
+                case 0:
+                    updated.Remove(dataChannel);
+                    updated.Add(dataChannel with { Property = dataChannel.Property with { Remarks = "Updated" } });
+                    break;
+                case 1:
+                    updated.Remove(dataChannel);
+                    break;
+                default:
+                    var detail = codebooks.CreateTag(CodebookName.Detail, $"added{i}");
+                    var localId = id.LocalId.Builder.WithMetadataTag(detail).Build();
+                    var added = id with { LocalId = localId, ShortId = $"added{i}" };
+                    updated.Add(dataChannel with { DataChannelId = added });
+                    break;
+            }
+        }
+
+        _currentDto = package.ToJsonDto();
+        _updatedDto = (package with { Package = package.Package with { DataChannelList = updated } }).ToJsonDto();
+    }
+
+    // The list and index in use, which applying a diff changes
+    [IterationSetup]
+    public void IterationSetup()
+    {
+        _package = _currentDto.ToDomainModel();
+        _index = _package.DataChannelList.CreateIndex();
+    }
+
+    [Benchmark(Baseline = true)]
+    public Domain.DataChannelListIndex Rebuild() => _updatedDto.ToDomainModel().DataChannelList.CreateIndex();
+
+    [Benchmark]
+    public Domain.DataChannelListIndex ApplyDiff()
+    {
+        var updated = _updatedDto.ToDomainModel();
+        var diff = Domain.DataChannelListDiff.Compute(_package, updated);
+        _package.DataChannelList.Apply(diff);
+        return _index.Update(diff);
+    }
+}
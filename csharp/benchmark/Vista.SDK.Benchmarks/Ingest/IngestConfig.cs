@@ -0,0 +1,27 @@
+using BenchmarkDotNet.Engines;
+
+namespace Vista.SDK.Benchmarks.Ingest;
+
+/// <summary>
+/// Shared by the end-to-end benchmarks. Operations take from milliseconds to seconds, so they are measured
+/// without pilot stage or overhead subtraction, and reported with allocations and latency percentiles.
+/// </summary>
+internal sealed class IngestConfig : ManualConfig
+{
+    public IngestConfig()
+    {
+        this.AddJob(
+            Job.Default.WithStrategy(RunStrategy.Monitoring).WithWarmupCount(2).WithIterationCount(15).WithId("Ingest")
+        );
+        AddStatistics(this);
+        this.AddLogicalGroupRules(BenchmarkLogicalGroupRule.ByCategory);
+        this.AddColumn(CategoriesColumn.Default);
+        this.SummaryStyle = SummaryStyle.Default.WithSizeUnit(SizeUnit.KB);
+    }
+
+    public static void AddStatistics(ManualConfig config)
+    {
+        config.AddDiagnoser(MemoryDiagnoser.Default);
+        config.AddColumn(StatisticColumn.Median, StatisticColumn.P90, StatisticColumn.P95, StatisticColumn.Max);
+    }
+}
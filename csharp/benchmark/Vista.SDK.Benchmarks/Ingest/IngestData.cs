@@ -0,0 +1,151 @@
+using System.Globalization;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+using DataChannelListPackage = Vista.SDK.Transport.DataChannel.DataChannelListPackage;
+using Domain = Vista.SDK.Transport;
+
+namespace Vista.SDK.Benchmarks.Ingest;
+
+/// <summary>
+/// Realistically sized payloads for the ingest benchmarks, built from the local IDs in testdata/LocalIds.txt
+/// and the data channel properties of the DataChannelList sample
+/// </summary>
+internal static class IngestData
+{
+    public static LocalIdBuilder[] ReadLocalIds()
+    {
+        var localIds = new List<LocalIdBuilder>();
+        foreach (var line in File.ReadLines("testdata/LocalIds.txt"))
+        {
+            if (LocalIdBuilder.TryParse(line, out var localId))
+                localIds.Add(localId);
+        }
+        return localIds.ToArray();
+    }
+
+    /// <summary>
+    /// A data channel list with <paramref name="count"/> channels with the VIS 3-4a local IDs of the test data,
+    /// as a list can only hold one VIS version. Local IDs beyond those are made unique with a custom detail tag.
+    /// </summary>
+    public static DataChannelListPackage CreateDataChannelList(int count)
+    {
+        var sample = Serializer
+            .DeserializeDataChannelList(File.ReadAllText("schemas/json/DataChannelList.sample.json"))!
+            .ToDomainModel();
+        var templates = sample.DataChannelList.DataChannels;
+
+        var localIds = ReadLocalIds().Where(l => l.VisVersion == VisVersion.v3_4a).ToArray();
+        var codebooks = VIS.Instance.GetCodebooks(VisVersion.v3_4a);
+        var seen = new HashSet<LocalId>();
+        var dataChannels = new List<Domain.DataChannel.DataChannel>(count);
+        for (var i = 0; dataChannels.Count < count; i++)
+        {
+            var builder = localIds[i % localIds.Length];
+            if (i >= localIds.Length)
+            {
+                var detail = codebooks.CreateTag(CodebookName.Detail, $"bench{i / localIds.Length}");
+                builder = builder.WithMetadataTag(detail);
+            }
+
+            var localId = builder.Build();
+            if (!seen.Add(localId))
+                continue;
+
+            var template = templates[dataChannels.Count % templates.Count];
+            dataChannels.Add(
+                template with
+                {
+                    DataChannelId = new Domain.DataChannel.DataChannelId
+                    {
+                        LocalId = localId,
+                        ShortId = dataChannels.Count.ToString("X5", CultureInfo.InvariantCulture),
+                        NameObject = template.DataChannelId.NameObject,
+                    },
+                }
+            );
+        }
+
+        return sample with
+        {
+            Package = sample.Package with { DataChannelList = new Domain.DataChannel.DataChannelList(dataChannels) },
+        };
+    }
+
+    /// <summary>
+    /// A table of the first 1000 decimal channels of <paramref name="dataChannelList"/>,
+    /// with as many data sets as it takes for the JSON to be about <paramref name="jsonBytes"/> long
+    /// </summary>
+    public static Domain.TimeSeries.TimeSeriesDataPackage CreateTimeSeriesData(
+        DataChannelListPackage dataChannelList,
+        long jsonBytes
+    )
+    {
+        const int channelsPerTable = 1000;
+        // Value and quality, with quotes and separators
+        const int bytesPerValue = 6 + 3 + 1 + 3;
+
+        var channels = dataChannelList
+            .DataChannelList.DataChannels.Where(dc => dc.Property.Format.IsDecimal)
+            .Take(channelsPerTable)
+            .ToArray();
+        var dataSets = Math.Max(1, (int)(jsonBytes / ((long)channels.Length * bytesPerValue)));
+
+        var random = new Random(42);
+        var start = new DateTimeOffset(2024, 1, 1, 0, 0, 0, TimeSpan.Zero);
+        var table = new Domain.TimeSeries.TabularData
+        {
+            DataChannelIds = channels
+                .Select(dc => Domain.DataChannelId.Parse(dc.DataChannelId.ShortId!))
+                .ToList(),
+            DataSets = new List<Domain.TimeSeries.TabularDataSet>(dataSets),
+        };
+        for (var i = 0; i < dataSets; i++)
+        {
+            var values = new List<string>(channels.Length);
+            var quality = new List<string>(channels.Length);
+            foreach (var channel in channels)
+            {
+                var range = channel.Property.Range!;
+                var value = range.Low + random.NextDouble() * (range.High - range.Low);
+                values.Add(Math.Round(value, 3).ToString(CultureInfo.InvariantCulture));
+                quality.Add("0");
+            }
+            table.DataSets.Add(
+                new Domain.TimeSeries.TabularDataSet
+                {
+                    TimeStamp = start.AddSeconds(i),
+                    Value = values,
+                    Quality = quality,
+                }
+            );
+        }
+
+        var header = dataChannelList.Package.Header;
+        return new Domain.TimeSeries.TimeSeriesDataPackage
+        {
+            Package = new Domain.TimeSeries.Package
+            {
+                Header = new Domain.TimeSeries.Header
+                {
+                    ShipId = header.ShipId,
+                    TimeSpan = new Domain.TimeSeries.TimeSpan { Start = start, End = start.AddSeconds(dataSets) },
+                    DateCreated = start,
+                    Author = header.Author,
+                },
+                TimeSeriesData =
+                [
+                    new Domain.TimeSeries.TimeSeriesData
+                    {
+                        DataConfiguration = new Domain.TimeSeries.ConfigurationReference
+                        {
+                            Id = header.DataChannelListId.Id,
+                            TimeStamp = header.DataChannelListId.TimeStamp,
+                        },
+                        TabularData = [table],
+                        EventData = null,
+                    },
+                ],
+            },
+        };
+    }
+}
@@ -0,0 +1,58 @@
+namespace Vista.SDK.Benchmarks.Ingest;
+
+/// <summary>
+/// Migrating the local IDs of testdata/LocalIds.txt from older VIS versions to each later one,
+/// as when a fleet's data channel lists are moved to a new VIS version
+/// </summary>
+[Config(typeof(IngestConfig))]
+public class LocalIdBulkConvert
+{
+    private LocalId[] _localIds;
+
+    public static IEnumerable<VisVersion> TargetVersions =>
+        VisVersions.All.Where(v => v > VisVersion.v3_4a);
+
+    [ParamsSource(nameof(TargetVersions))]
+    public VisVersion Target { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // Conversion throws for a few uncovered cases, which would end the batch
+        _localIds = IngestData
+            .ReadLocalIds()
+            .Where(l => l.VisVersion < Target)
+            .Select(l => l.Build())
+            .Where(CanConvert)
+            .ToArray();
+        Console.WriteLine($"// Local IDs: {_localIds.Length}");
+
+        bool CanConvert(LocalId localId)
+        {
+            try
+            {
+                VIS.Instance.ConvertLocalId(localId, Target);
+                return true;
+            }
+            catch (Exception)
+            {
+                return false;
+            }
+        }
+    }
+
+    [Benchmark(Baseline = true)]
+    public int ConvertEach()
+    {
+        var converted = 0;
+        foreach (var localId in _localIds)
+        {
+            if (VIS.Instance.ConvertLocalId(localId, Target) is not null)
+                converted++;
+        }
+        return converted;
+    }
+
+    [Benchmark]
+    public IReadOnlyList<LocalId> ConvertBatch() => VIS.Instance.ConvertLocalIds(_localIds, Target);
+}
@@ -0,0 +1,50 @@
+using BenchmarkDotNet.Engines;
+
+namespace Vista.SDK.Benchmarks.Ingest;
+
+/// <summary>
+/// Loading the Gmods, codebooks and locations of every VIS version into a fresh <see cref="VIS"/>.
+/// The cold start job measures the first call in each of several new processes,
+/// including JIT and reading the embedded resources, the warm job the steady state cost of a reload.
+/// </summary>
+[Config(typeof(Config))]
+public class ModelStartup
+{
+    [Benchmark(Baseline = true)]
+    public int LoadAllVersions()
+    {
+        var vis = new VIS();
+        var nodes = 0;
+        foreach (var version in VisVersions.All)
+        {
+            nodes += vis.GetGmod(version).Count();
+            vis.GetCodebooks(version);
+            vis.GetLocations(version);
+        }
+        return nodes;
+    }
+
+    [Benchmark]
+    public Task PreloadAllVersions() => new VIS().PreloadAsync();
+
+    internal sealed class Config : ManualConfig
+    {
+        public Config()
+        {
+            this.AddJob(
+                Job.Default.WithStrategy(RunStrategy.ColdStart)
+                    .WithLaunchCount(10)
+                    .WithWarmupCount(0)
+                    .WithIterationCount(1)
+                    .WithId("Cold start")
+            );
+            this.AddJob(
+                Job.Default.WithStrategy(RunStrategy.Monitoring)
+                    .WithWarmupCount(2)
+                    .WithIterationCount(10)
+                    .WithId("Warm")
+            );
+            IngestConfig.AddStatistics(this);
+        }
+    }
+}
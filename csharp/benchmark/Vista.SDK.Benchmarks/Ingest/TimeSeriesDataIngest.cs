@@ -0,0 +1,77 @@
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+using Domain = Vista.SDK.Transport;
+
+namespace Vista.SDK.Benchmarks.Ingest;
+
+/// <summary>
+/// Receiving a large time series package: reading the JSON, validating every value against
+/// the data channel list, either after deserializing or while streaming, and writing it back out
+/// </summary>
+[Config(typeof(IngestConfig))]
+public class TimeSeriesDataIngest
+{
+    private static readonly Domain.TimeSeries.ValidateData _accept = (_, _, _, _) => new ValidateResult.Ok();
+
+    private Domain.DataChannel.DataChannelListPackage _dataChannelList;
+    private Domain.TimeSeries.TimeSeriesDataPackage _package;
+    private byte[] _json;
+    private MemoryStream _stream;
+
+    [Params(100)]
+    public int PayloadMegabytes { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _dataChannelList = IngestData.CreateDataChannelList(30_000);
+        _package = IngestData.CreateTimeSeriesData(_dataChannelList, PayloadMegabytes * 1024L * 1024L);
+        _stream = new MemoryStream();
+        _package.ToJsonDto().Serialize(_stream);
+        _json = _stream.ToArray();
+        Console.WriteLine($"// Payload size: {_json.Length / (1024 * 1024)} MB");
+
+        if (Validate() is not ValidateResult.Ok || ValidateStreaming() is not ValidateResult.Ok)
+            throw new InvalidOperationException("Generated time series data is not valid");
+    }
+
+    [GlobalCleanup]
+    public void Cleanup() => _stream.Dispose();
+
+    [Benchmark]
+    [BenchmarkCategory("Parse")]
+    public Domain.TimeSeries.TimeSeriesDataPackage Deserialize()
+    {
+        using var stream = new MemoryStream(_json, writable: false);
+        return Serializer.DeserializeTimeSeriesData(stream).ToDomainModel();
+    }
+
+    [Benchmark]
+    [BenchmarkCategory("Validate")]
+    public ValidateResult Validate()
+    {
+        foreach (var data in _package.Package.TimeSeriesData)
+        {
+            var result = data.Validate(_dataChannelList, _accept, _accept);
+            if (result is not ValidateResult.Ok)
+                return result;
+        }
+        return new ValidateResult.Ok();
+    }
+
+    [Benchmark]
+    [BenchmarkCategory("Validate")]
+    public ValidateResult ValidateStreaming()
+    {
+        using var stream = new MemoryStream(_json, writable: false);
+        return Serializer.ValidateTimeSeriesData(stream, _dataChannelList, _accept, _accept);
+    }
+
+    [Benchmark]
+    [BenchmarkCategory("Serialize")]
+    public void Serialize()
+    {
+        _stream.SetLength(0);
+        _package.ToJsonDto().Serialize(_stream);
+    }
+}
@@ -7,7 +7,14 @@ namespace Vista.SDK.Benchmarks.Internal;
 [Config(typeof(Config))]
 public class ShortStringHash
 {
-    [Params("400", "H346.11112")]
+    [Params(
+        "400",
+        "H346.11112",
+        "/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet",
+        "/dnv-v2/vis-3-4a/1031/meta/cmd-start.stop/~prefix.for.very.long.custom/"
+            + "detail-with.a.long.and.elaborate.description/~some.other.custom.detail.value/"
+            + "qty-temperature/pos-outlet"
+    )]
     public string Input { get; set; }
 
     [Benchmark(Baseline = true)]
@@ -25,6 +32,17 @@ public class ShortStringHash
     [Benchmark]
     public uint Fnv() => Hash<FnvHasher>(Input);
 
+    [Benchmark]
+    public uint ChdCodeHasher() => default(SDK.Internal.ChdCodeHasher).Hash(Input.AsSpan());
+
+    [Benchmark]
+    public uint ChdStringHasher() => default(SDK.Internal.ChdStringHasher).Hash(Input.AsSpan());
+
+    // Hashers dispatch on the ISA at runtime, SSE4.2 and SSE2 on x64, CRC32 and AdvSimd on ARM64,
+    // this is the portable path long keys take without vector support
+    [Benchmark]
+    public uint ChdStringHasherScalar() => SDK.Internal.ChdStringHasher.HashScalar(Input.AsSpan());
+
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     private static uint Hash<THasher>(string inputStr)
         where THasher : struct, IHasher
@@ -56,19 +74,19 @@ interface IHasher
     {
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         public static uint Hash(uint hash, byte ch) =>
-            SDK.Internal.ChdDictionary<GmodNode>.Hashing.LarssonHash(hash, ch);
+            SDK.Internal.ChdHashing.LarssonHash(hash, ch);
     }
 
     readonly struct Crc32IntrinsicHasher : IHasher
     {
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static uint Hash(uint hash, byte ch) => SDK.Internal.ChdDictionary<GmodNode>.Hashing.Crc32(hash, ch);
+        public static uint Hash(uint hash, byte ch) => SDK.Internal.ChdHashing.Crc32(hash, ch);
     }
 
     readonly struct FnvHasher : IHasher
     {
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        public static uint Hash(uint hash, byte ch) => SDK.Internal.ChdDictionary<GmodNode>.Hashing.Fnv(hash, ch);
+        public static uint Hash(uint hash, byte ch) => SDK.Internal.ChdHashing.Fnv(hash, ch);
     }
 
     internal static class Hashing
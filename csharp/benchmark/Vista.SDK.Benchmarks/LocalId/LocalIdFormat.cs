@@ -0,0 +1,48 @@
+using System.Buffers;
+
+namespace Vista.SDK.Benchmarks.LocalId;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+[GroupBenchmarksBy(BenchmarkLogicalGroupRule.ByCategory), CategoriesColumn]
+public class LocalIdFormat
+{
+    private const string LocalIdStr =
+        "/dnv-v2/vis-3-4a/411.1/C101.63/S206/sec/411.1/C101.31-5/meta/qty-temperature/cnt-exhaust.gas/pos-inlet";
+
+    private SDK.LocalId _localId;
+    private GmodPath _path;
+    private readonly char[] _chars = new char[256];
+    private readonly byte[] _bytes = new byte[256];
+    private readonly ArrayBufferWriter<byte> _writer = new(256);
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _localId = SDK.LocalId.Parse(LocalIdStr);
+        _path = _localId.SecondaryItem!;
+    }
+
+    [Benchmark(Baseline = true), BenchmarkCategory("LocalId")]
+    public string BuilderToString() => _localId.Builder.ToString();
+
+    [Benchmark, BenchmarkCategory("LocalId")]
+    public bool TryFormatUtf8() => _localId.TryFormatUtf8(_bytes, out _);
+
+    [Benchmark, BenchmarkCategory("LocalId")]
+    public int WriteTo()
+    {
+        _writer.Clear();
+        _localId.WriteTo(_writer);
+        return _writer.WrittenCount;
+    }
+
+    [Benchmark(Baseline = true), BenchmarkCategory("GmodPath")]
+    public string PathToString() => _path.ToString();
+
+    [Benchmark, BenchmarkCategory("GmodPath")]
+    public bool PathTryFormat() => _path.TryFormat(_chars, out _);
+
+    [Benchmark, BenchmarkCategory("GmodPath")]
+    public bool PathTryFormatUtf8() => _path.TryFormatUtf8(_bytes, out _);
+}
@@ -0,0 +1,40 @@
+using System.Text;
+
+namespace Vista.SDK.Benchmarks.LocalId;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+[GroupBenchmarksBy(BenchmarkLogicalGroupRule.ByCategory), CategoriesColumn]
+public class LocalIdParse
+{
+    private const string LocalIdStr =
+        "/dnv-v2/vis-3-4a/411.1/C101.63/S206/sec/411.1/C101.31-5/meta/qty-temperature/cnt-exhaust.gas/pos-inlet";
+
+    private static readonly byte[] LocalIdUtf8 = Encoding.UTF8.GetBytes(LocalIdStr);
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var vis = VIS.Instance;
+        // Load cache
+        _ = vis.GetGmod(VisVersion.v3_4a);
+        _ = vis.GetCodebooks(VisVersion.v3_4a);
+        _ = vis.GetLocations(VisVersion.v3_4a);
+    }
+
+    [Benchmark(Baseline = true), BenchmarkCategory("Known")]
+    public bool TryParse() => SDK.LocalId.TryParse(LocalIdStr, out _, out _);
+
+    [Benchmark, BenchmarkCategory("Known")]
+    public bool TryParseSpan() => SDK.LocalId.TryParse(LocalIdStr.AsSpan(), out _);
+
+    [Benchmark, BenchmarkCategory("Known")]
+    public bool TryParseUtf8() => SDK.LocalId.TryParse(LocalIdUtf8.AsSpan(), out _);
+
+    [Benchmark, BenchmarkCategory("Uncached")]
+    public bool TryParseSpanUncached()
+    {
+        SDK.LocalId.ParseCache.Clear();
+        return SDK.LocalId.TryParse(LocalIdStr.AsSpan(), out _);
+    }
+}
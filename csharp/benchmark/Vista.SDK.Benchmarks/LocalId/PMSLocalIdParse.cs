@@ -0,0 +1,34 @@
+using System.Text;
+using Vista.SDK.Experimental;
+
+namespace Vista.SDK.Benchmarks.LocalId;
+
+/// <summary>The PMS local ID parsing paths, sharing their parser with <see cref="LocalIdParse"/></summary>
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class PMSLocalIdParse
+{
+    private const string LocalIdStr =
+        "/dnv-v2-experimental/vis-3-6a/511.11-2/C101.663i/C663/meta/maint.cat-preventive/act.type-service/detail-turbine";
+
+    private static readonly byte[] LocalIdUtf8 = Encoding.UTF8.GetBytes(LocalIdStr);
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var vis = VIS.Instance;
+        // Load cache
+        _ = vis.GetGmod(VisVersion.v3_6a);
+        _ = vis.GetCodebooks(VisVersion.v3_6a);
+        _ = vis.GetLocations(VisVersion.v3_6a);
+    }
+
+    [Benchmark(Baseline = true)]
+    public bool TryParse() => PMSLocalIdBuilder.TryParse(LocalIdStr, out _, out _);
+
+    [Benchmark]
+    public bool TryParseSpan() => PMSLocalIdBuilder.TryParse(LocalIdStr.AsSpan(), out _);
+
+    [Benchmark]
+    public bool TryParseUtf8() => PMSLocalIdBuilder.TryParse(LocalIdUtf8.AsSpan(), out _);
+}
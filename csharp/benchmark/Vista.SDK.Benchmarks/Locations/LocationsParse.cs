@@ -0,0 +1,29 @@
+using Vista.SDK.Internal;
+
+namespace Vista.SDK.Benchmarks.Locations;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class LocationsParse
+{
+    private SDK.Locations _locations;
+
+    [Params("1", "SU", "11FIPU")]
+    public string Location { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _locations = VIS.Instance.GetLocations(VisVersion.v3_4a);
+    }
+
+    [Benchmark(Baseline = true)]
+    public bool FullParser()
+    {
+        var errorBuilder = LocationParsingErrorBuilder.Empty;
+        return _locations.TryParseWithErrors(Location.AsSpan(), Location, out _, ref errorBuilder);
+    }
+
+    [Benchmark]
+    public bool TryParse() => _locations.TryParse(Location, out _);
+}
@@ -1,5 +1,8 @@
 ﻿using BenchmarkDotNet.Running;
+using Vista.SDK.Benchmarks.Regression;
 
 // BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args, new DebugInProcessConfig());
 
-BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args);
+var gate = RegressionGate.FromArgs(ref args);
+var summaries = BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args);
+return gate?.Run(summaries) ?? 0;
@@ -0,0 +1,182 @@
+using System.Globalization;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using BenchmarkDotNet.Exporters;
+
+namespace Vista.SDK.Benchmarks.Regression;
+
+/// <summary>
+/// Saves benchmark results as a JSON baseline, or compares them to one and fails when any got slower or allocates
+/// more than the allowed margin, so that regressions between releases show up in CI.
+/// Medians are compared, as they are the least sensitive to outliers in the few iterations macro benchmarks run.
+/// </summary>
+/// <example>
+/// <code>
+/// dotnet run -c Release -- --filter *Ingest* --save-baseline baselines/ingest.json
+/// dotnet run -c Release -- --filter *Ingest* --compare-baseline baselines/ingest.json --max-regression 10
+/// </code>
+/// </example>
+internal sealed class RegressionGate
+{
+    private static readonly JsonSerializerOptions _options = new()
+    {
+        PropertyNamingPolicy = JsonNamingPolicy.CamelCase,
+        WriteIndented = true,
+    };
+
+    private readonly string _savePath;
+    private readonly string _comparePath;
+    private readonly double _maxRegression;
+
+    private RegressionGate(string savePath, string comparePath, double maxRegression)
+    {
+        _savePath = savePath;
+        _comparePath = comparePath;
+        _maxRegression = maxRegression;
+    }
+
+    /// <summary>Takes the gate options out of <paramref name="args"/>, leaving the ones for BenchmarkDotNet</summary>
+    /// <returns>Null if neither saving nor comparing was asked for</returns>
+    public static RegressionGate FromArgs(ref string[] args)
+    {
+        string savePath = null;
+        string comparePath = null;
+        var maxRegression = 10.0;
+
+        var remaining = new List<string>();
+        for (var i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "--save-baseline":
+                    savePath = Value(args, ref i);
+                    break;
+                case "--compare-baseline":
+                    comparePath = Value(args, ref i);
+                    break;
+                case "--max-regression":
+                    maxRegression = double.Parse(Value(args, ref i), CultureInfo.InvariantCulture);
+                    break;
+                default:
+                    remaining.Add(args[i]);
+                    break;
+            }
+        }
+
+        args = remaining.ToArray();
+        if (savePath is null && comparePath is null)
+            return null;
+        return new RegressionGate(savePath, comparePath, maxRegression);
+
+        static string Value(string[] args, ref int i) =>
+            ++i < args.Length ? args[i] : throw new ArgumentException($"Missing value for {args[i - 1]}");
+    }
+
+    /// <returns>The process exit code, non-zero if a benchmark regressed</returns>
+    public int Run(IEnumerable<Summary> summaries)
+    {
+        var current = Baseline.From(summaries);
+        var exitCode = 0;
+
+        if (_comparePath is not null)
+        {
+            var baseline = JsonSerializer.Deserialize<Baseline>(File.ReadAllText(_comparePath), _options);
+            exitCode = Compare(baseline, current);
+        }
+
+        if (_savePath is not null)
+        {
+            var directory = Path.GetDirectoryName(Path.GetFullPath(_savePath));
+            Directory.CreateDirectory(directory!);
+            File.WriteAllText(_savePath, JsonSerializer.Serialize(current, _options));
+            Console.WriteLine($"// Baseline with {current.Benchmarks.Count} results saved to {_savePath}");
+        }
+
+        return exitCode;
+    }
+
+    private int Compare(Baseline baseline, Baseline current)
+    {
+        if (baseline.Runtime != current.Runtime || baseline.Os != current.Os)
+        {
+            Console.WriteLine(
+                $"// Warning: baseline was measured on {baseline.Runtime}, {baseline.Os}, "
+                    + $"now running on {current.Runtime}, {current.Os}"
+            );
+        }
+
+        var previous = baseline.Benchmarks.ToDictionary(b => b.Name);
+        var regressions = 0;
+        Console.WriteLine($"// Comparison with {_comparePath}, allowed regression {_maxRegression}%");
+        Console.WriteLine("| Benchmark | Median | Change | P95 | Allocated | Change | |");
+        Console.WriteLine("|---|---:|---:|---:|---:|---:|---|");
+        foreach (var result in current.Benchmarks)
+        {
+            if (!previous.TryGetValue(result.Name, out var before))
+            {
+                Console.WriteLine($"| {result.Name} | {result.MedianNs:N0} ns | | {result.P95Ns:N0} ns | | | new |");
+                continue;
+            }
+
+            var time = Change(before.MedianNs, result.MedianNs);
+            var allocated = Change(before.AllocatedBytes ?? 0, result.AllocatedBytes ?? 0);
+            // Allocations are deterministic, but a few bytes either way on tiny operations are not a regression
+            var allocatedRegressed =
+                allocated > _maxRegression && result.AllocatedBytes - before.AllocatedBytes > 1024;
+            var regressed = time > _maxRegression || allocatedRegressed;
+            if (regressed)
+                regressions++;
+
+            Console.WriteLine(
+                $"| {result.Name} | {result.MedianNs:N0} ns | {time:+0.0;-0.0}% | {result.P95Ns:N0} ns "
+                    + $"| {result.AllocatedBytes:N0} B | {allocated:+0.0;-0.0}% | {(regressed ? "REGRESSED" : "")} |"
+            );
+        }
+
+        var missing = previous.Keys.Except(current.Benchmarks.Select(b => b.Name)).ToArray();
+        foreach (var name in missing)
+            Console.WriteLine($"| {name} | | | | | | missing |");
+
+        Console.WriteLine($"// {regressions} regressed, {missing.Length} missing");
+        return regressions > 0 ? 1 : 0;
+    }
+
+    private static double Change(double before, double after) =>
+        before == 0 ? (after == 0 ? 0 : 100) : (after - before) / before * 100;
+
+    internal sealed record Baseline(string Runtime, string Os, int ProcessorCount, List<BenchmarkResult> Benchmarks)
+    {
+        public static Baseline From(IEnumerable<Summary> summaries)
+        {
+            var results = new List<BenchmarkResult>();
+            foreach (var summary in summaries)
+            {
+                // Benchmarks that run in several jobs are told apart by them
+                var multipleJobs = summary.Reports.Select(r => r.BenchmarkCase.Job.ResolvedId).Distinct().Count() > 1;
+                foreach (var report in summary.Reports)
+                {
+                    var statistics = report.ResultStatistics;
+                    if (statistics is null)
+                        continue;
+
+                    var benchmarkCase = report.BenchmarkCase;
+                    var name = FullNameProvider.GetBenchmarkName(benchmarkCase);
+                    if (multipleJobs)
+                        name = $"{name} [{benchmarkCase.Job.ResolvedId}]";
+
+                    long? allocated = report.GcStats.GetBytesAllocatedPerOperation(benchmarkCase);
+                    results.Add(new BenchmarkResult(name, statistics.Median, statistics.Percentiles.P95, allocated));
+                }
+            }
+
+            return new Baseline(
+                RuntimeInformation.FrameworkDescription,
+                RuntimeInformation.OSDescription,
+                Environment.ProcessorCount,
+                results
+            );
+        }
+    }
+
+    internal sealed record BenchmarkResult(string Name, double MedianNs, double P95Ns, long? AllocatedBytes);
+}
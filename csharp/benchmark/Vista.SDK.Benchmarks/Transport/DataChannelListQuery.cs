@@ -0,0 +1,66 @@
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class DataChannelListQuery
+{
+    private DataChannelList _dataChannelList;
+    private DataChannelListIndex _index;
+    private LocalIdQuery[] _queries;
+    private LocalIdQueryMatcher _matcher;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var text = File.ReadAllText("schemas/json/DataChannelList.sample.compact.json");
+        _dataChannelList = Serializer.DeserializeDataChannelList(text)!.ToDomainModel().DataChannelList;
+        _index = _dataChannelList.CreateIndex();
+
+        var gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
+        var codebooks = VIS.Instance.GetCodebooks(VisVersion.v3_4a);
+        var pPath = gmod.ParsePath("621.11i/H135");
+        _queries =
+        [
+            LocalIdQueryBuilder
+                .Empty()
+                .WithTags(
+                    MetadataTagsQueryBuilder
+                        .Empty()
+                        .WithTag(codebooks.CreateTag(CodebookName.Content, "heavy.fuel.oil"))
+                        .Build()
+                )
+                .Build(),
+            LocalIdQueryBuilder.Empty().WithPrimaryItem(pPath, builder => builder.WithoutLocations().Build()).Build(),
+            LocalIdQueryBuilder.Empty().WithSecondaryItem(gmod.ParsePath("1036.13i-1/C662.1/C661")).Build(),
+        ];
+        _matcher = LocalIdQueryMatcher.Compile(_queries);
+    }
+
+    [Benchmark(Baseline = true)]
+    public int Scan()
+    {
+        var matches = 0;
+        foreach (var query in _queries)
+        {
+            foreach (var dataChannel in _dataChannelList)
+            {
+                if (query.Match(dataChannel.DataChannelId.LocalId))
+                    matches++;
+            }
+        }
+        return matches;
+    }
+
+    [Benchmark]
+    public int Index()
+    {
+        var matches = 0;
+        foreach (var result in _index.Match(_matcher))
+            matches += result.Count;
+        return matches;
+    }
+}
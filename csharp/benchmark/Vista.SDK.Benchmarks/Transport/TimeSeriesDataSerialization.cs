@@ -0,0 +1,61 @@
+using Vista.SDK.Transport.Binary;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+using Domain = Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+[GroupBenchmarksBy(BenchmarkLogicalGroupRule.ByCategory), CategoriesColumn]
+public class TimeSeriesDataSerialization
+{
+    private Domain.TimeSeriesDataPackage _package;
+    private MemoryStream _stream;
+    private byte[] _json;
+    private byte[] _binary;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var text = File.ReadAllText("schemas/json/TimeSeriesData.sample.json");
+        _package = Serializer.DeserializeTimeSeriesData(text)!.ToDomainModel();
+        _stream = new MemoryStream();
+
+        _package.ToJsonDto().Serialize(_stream);
+        _json = _stream.ToArray();
+        _binary = _package.Serialize();
+        Console.WriteLine($"// Payload size: Json {_json.Length} B, Binary {_binary.Length} B");
+    }
+
+    [GlobalCleanup]
+    public void Cleanup() => _stream.Dispose();
+
+    [Benchmark(Baseline = true, Description = "Json")]
+    [BenchmarkCategory("Serialize")]
+    public void Serialize_Json()
+    {
+        _stream.SetLength(0);
+        _package.ToJsonDto().Serialize(_stream);
+    }
+
+    [Benchmark(Description = "Binary")]
+    [BenchmarkCategory("Serialize")]
+    public void Serialize_Binary()
+    {
+        _stream.SetLength(0);
+        _package.Serialize(_stream);
+    }
+
+    [Benchmark(Baseline = true, Description = "Json")]
+    [BenchmarkCategory("Deserialize")]
+    public Domain.TimeSeriesDataPackage Deserialize_Json()
+    {
+        using var stream = new MemoryStream(_json, writable: false);
+        return Serializer.DeserializeTimeSeriesData(stream)!.ToDomainModel();
+    }
+
+    [Benchmark(Description = "Binary")]
+    [BenchmarkCategory("Deserialize")]
+    public Domain.TimeSeriesDataPackage Deserialize_Binary() => BinarySerializer.DeserializeTimeSeriesData(_binary);
+}
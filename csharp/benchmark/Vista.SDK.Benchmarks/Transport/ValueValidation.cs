@@ -0,0 +1,39 @@
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class ValueValidation
+{
+    private Format _format;
+    private ValueValidator _validator;
+
+    [Params("Decimal", "String")]
+    public string Type { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _format = new Format
+        {
+            Type = Type,
+            Restriction = Type == "Decimal"
+                ? new Restriction { FractionDigits = 3, MinInclusive = -1000, MaxInclusive = 1000 }
+                : new Restriction { MaxLength = 16, Pattern = "^[A-Z]+$" }
+        };
+        _validator = ValueValidator.Compile(_format);
+    }
+
+    private string Value => Type == "Decimal" ? "123.456" : "RUNNING";
+
+    [Benchmark(Baseline = true)]
+    public ValidateResult FormatValidateValue() => _format.ValidateValue(Value, out _);
+
+    [Benchmark]
+    public ValidateResult CompiledValidator() => _validator.Validate(Value, out _);
+
+    [Benchmark]
+    public ValidateResult CompiledValidatorNoValue() => _validator.Validate(Value);
+}
@@ -0,0 +1,46 @@
+namespace Vista.SDK.Benchmarks.VIS;
+
+[Config(typeof(Config))]
+public class VisLookup
+{
+    private SDK.VIS _registry;
+    private SDK.VIS _expiring;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _registry = new SDK.VIS(new VisOptions { CacheMode = VisCacheMode.Registry });
+        _expiring = new SDK.VIS(new VisOptions { CacheMode = VisCacheMode.Expiring });
+
+        // Load cache
+        _registry.PreloadAsync(new[] { VisVersion.v3_4a }).GetAwaiter().GetResult();
+        _expiring.PreloadAsync(new[] { VisVersion.v3_4a }).GetAwaiter().GetResult();
+    }
+
+    [Benchmark(Baseline = true)]
+    public Locations Expiring()
+    {
+        _expiring.GetGmod(VisVersion.v3_4a);
+        _expiring.GetCodebooks(VisVersion.v3_4a);
+        return _expiring.GetLocations(VisVersion.v3_4a);
+    }
+
+    [Benchmark]
+    public Locations Registry()
+    {
+        _registry.GetGmod(VisVersion.v3_4a);
+        _registry.GetCodebooks(VisVersion.v3_4a);
+        return _registry.GetLocations(VisVersion.v3_4a);
+    }
+
+    internal sealed class Config : ManualConfig
+    {
+        public Config()
+        {
+            this.SummaryStyle = SummaryStyle.Default.WithRatioStyle(RatioStyle.Trend);
+            this.AddColumn(RankColumn.Arabic);
+            this.Orderer = new DefaultOrderer(SummaryOrderPolicy.SlowestToFastest, MethodOrderPolicy.Declared);
+            this.AddDiagnoser(MemoryDiagnoser.Default);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+using System.Buffers;
+using Vista.SDK.Transport.TimeSeries;
+using DataChannelListPackage = Vista.SDK.Transport.DataChannel.DataChannelListPackage;
+
+namespace Vista.SDK.Transport.Binary;
+
+/// <summary>
+/// Compact binary encoding of the ISO19848 packages, as an alternative to JSON
+/// for high-frequency and bandwidth constrained links.
+/// </summary>
+/// <remarks>
+/// A payload starts with a magic and a version byte.
+/// Integers are variable length, data channel ids and qualities are referenced by index once written,
+/// timestamps of consecutive data sets are deltas and values are stored as numbers when they format back
+/// to the exact same string, so deserializing gives back an equal package.
+/// Data channel lists reference the names repeated across their data channels, like types and units, by index.
+/// Custom headers and data kinds may hold JSON primitives or <see cref="System.Text.Json.JsonElement"/>.
+/// </remarks>
+public static class BinarySerializer
+{
+    /// <summary>The default maximum length in bytes of a string or encoded data sets field when deserializing</summary>
+    public const int DefaultMaxFieldLength = 16 * 1024 * 1024;
+
+    public static byte[] Serialize(this TimeSeriesDataPackage package)
+    {
+        using var stream = new MemoryStream();
+        package.Serialize(stream);
+        return stream.ToArray();
+    }
+
+    public static void Serialize(this TimeSeriesDataPackage package, Stream stream)
+    {
+        using var writer = new WireWriter(stream);
+        TimeSeriesDataEncoding.Write(writer, package);
+    }
+
+    public static void Serialize(this TimeSeriesDataPackage package, IBufferWriter<byte> bufferWriter)
+    {
+        using var writer = new WireWriter(bufferWriter);
+        TimeSeriesDataEncoding.Write(writer, package);
+    }
+
+    /// <exception cref="InvalidDataException">Not a valid binary package</exception>
+    /// <exception cref="EndOfStreamException">The package is truncated</exception>
+    public static TimeSeriesDataPackage DeserializeTimeSeriesData(byte[] data) =>
+        DeserializeTimeSeriesData(data, 0, data.Length);
+
+    public static TimeSeriesDataPackage DeserializeTimeSeriesData(
+        byte[] data,
+        int offset,
+        int count,
+        int maxFieldLength = DefaultMaxFieldLength
+    )
+    {
+        using var reader = new WireReader(data, offset, count, maxFieldLength);
+        return TimeSeriesDataEncoding.Read(reader);
+    }
+
+    /// <param name="stream">The stream to read the package from</param>
+    /// <param name="maxFieldLength">
+    /// The maximum length in bytes of a single string or encoded data sets field, longer fields throw an
+    /// <see cref="InvalidDataException"/>
+    /// </param>
+    public static TimeSeriesDataPackage DeserializeTimeSeriesData(
+        Stream stream,
+        int maxFieldLength = DefaultMaxFieldLength
+    )
+    {
+        using var reader = new WireReader(stream, maxFieldLength);
+        return TimeSeriesDataEncoding.Read(reader);
+    }
+
+    public static byte[] Serialize(this DataChannelListPackage package)
+    {
+        using var stream = new MemoryStream();
+        package.Serialize(stream);
+        return stream.ToArray();
+    }
+
+    public static void Serialize(this DataChannelListPackage package, Stream stream)
+    {
+        using var writer = new WireWriter(stream);
+        DataChannelListEncoding.Write(writer, package);
+    }
+
+    public static void Serialize(this DataChannelListPackage package, IBufferWriter<byte> bufferWriter)
+    {
+        using var writer = new WireWriter(bufferWriter);
+        DataChannelListEncoding.Write(writer, package);
+    }
+
+    /// <exception cref="InvalidDataException">Not a valid binary package</exception>
+    /// <exception cref="EndOfStreamException">The package is truncated</exception>
+    public static DataChannelListPackage DeserializeDataChannelList(byte[] data) =>
+        DeserializeDataChannelList(data, 0, data.Length);
+
+    public static DataChannelListPackage DeserializeDataChannelList(
+        byte[] data,
+        int offset,
+        int count,
+        int maxFieldLength = DefaultMaxFieldLength
+    )
+    {
+        using var reader = new WireReader(data, offset, count, maxFieldLength);
+        return DataChannelListEncoding.Read(reader);
+    }
+
+    /// <inheritdoc cref="DeserializeTimeSeriesData(Stream, int)"/>
+    public static DataChannelListPackage DeserializeDataChannelList(
+        Stream stream,
+        int maxFieldLength = DefaultMaxFieldLength
+    )
+    {
+        using var reader = new WireReader(stream, maxFieldLength);
+        return DataChannelListEncoding.Read(reader);
+    }
+}
@@ -0,0 +1,326 @@
+using Domain = Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Transport.Binary;
+
+/// <summary>
+/// Encoding of <see cref="Domain.DataChannelListPackage"/>.
+/// Type names, units, quality codings, alert priorities and naming rules repeat across the data channels
+/// of a list, so they are written once per package and referenced by index after that.
+/// </summary>
+internal static class DataChannelListEncoding
+{
+    private static ReadOnlySpan<byte> Magic => "VDC"u8;
+
+    public const byte Version = 1;
+
+    public static void Write(WireWriter writer, Domain.DataChannelListPackage package)
+    {
+        foreach (var b in Magic)
+            writer.WriteByte(b);
+        writer.WriteByte(Version);
+
+        new Encoder(writer).WritePackage(package.Package);
+        writer.Flush();
+    }
+
+    public static Domain.DataChannelListPackage Read(WireReader reader)
+    {
+        foreach (var b in Magic)
+        {
+            if (reader.ReadByte() != b)
+                throw new InvalidDataException("Not a binary DataChannelList package");
+        }
+        var version = reader.ReadByte();
+        if (version != Version)
+            throw new InvalidDataException($"Unsupported binary DataChannelList package version {version}");
+
+        var decoder = new Decoder(reader);
+        return new Domain.DataChannelListPackage { Package = decoder.ReadPackage() };
+    }
+
+    private sealed class Encoder(WireWriter writer)
+    {
+        private readonly Dictionary<string, int> _names = new(StringComparer.Ordinal);
+
+        public void WritePackage(Domain.Package package)
+        {
+            WriteHeader(package.Header);
+
+            writer.WriteVarUInt((ulong)package.DataChannelList.Count);
+            foreach (var dataChannel in package.DataChannelList)
+                WriteDataChannel(dataChannel);
+        }
+
+        private void WriteHeader(Domain.Header header)
+        {
+            writer.WriteString(header.ShipId.ToString());
+            writer.WriteString(header.DataChannelListId.Id);
+            writer.WriteNullableString(header.DataChannelListId.Version);
+            writer.WriteDateTimeOffset(header.DataChannelListId.TimeStamp);
+
+            writer.WriteBoolean(header.VersionInformation is not null);
+            if (header.VersionInformation is not null)
+            {
+                writer.WriteString(header.VersionInformation.NamingRule);
+                writer.WriteString(header.VersionInformation.NamingSchemeVersion);
+                writer.WriteNullableString(header.VersionInformation.ReferenceUrl);
+            }
+            writer.WriteNullableString(header.Author);
+            writer.WriteNullableDateTimeOffset(header.DateCreated);
+            ValueEncoding.WriteProperties(writer, header.CustomHeaders);
+        }
+
+        private void WriteDataChannel(Domain.DataChannel dataChannel)
+        {
+            var id = dataChannel.DataChannelId;
+            // Like the JSON encoding, local IDs are written in their short form
+            var localId = id.LocalId.VerboseMode ? id.LocalId.Builder.WithVerboseMode(false).Build() : id.LocalId;
+            writer.WriteString(localId.ToString());
+            writer.WriteNullableString(id.ShortId);
+            writer.WriteBoolean(id.NameObject is not null);
+            if (id.NameObject is not null)
+            {
+                writer.WriteReference(_names, id.NameObject.NamingRule);
+                ValueEncoding.WriteProperties(writer, id.NameObject.CustomNameObjects);
+            }
+
+            var property = dataChannel.Property;
+            writer.WriteReference(_names, property.DataChannelType.Type);
+            WriteNullableDouble(property.DataChannelType.UpdateCycle);
+            WriteNullableDouble(property.DataChannelType.CalculationPeriod);
+
+            writer.WriteReference(_names, property.Format.Type);
+            writer.WriteBoolean(property.Format.Restriction is not null);
+            if (property.Format.Restriction is not null)
+                WriteRestriction(property.Format.Restriction);
+
+            writer.WriteBoolean(property.Range is not null);
+            if (property.Range is not null)
+            {
+                writer.WriteDouble(property.Range.Low);
+                writer.WriteDouble(property.Range.High);
+            }
+
+            writer.WriteBoolean(property.Unit is not null);
+            if (property.Unit is not null)
+            {
+                writer.WriteReference(_names, property.Unit.UnitSymbol);
+                WriteNullableReference(property.Unit.QuantityName);
+                ValueEncoding.WriteProperties(writer, property.Unit.CustomElements);
+            }
+
+            WriteNullableReference(property.QualityCoding);
+            WriteNullableReference(property.AlertPriority);
+            writer.WriteNullableString(property.Name);
+            writer.WriteNullableString(property.Remarks);
+            ValueEncoding.WriteProperties(writer, property.CustomProperties);
+        }
+
+        private void WriteRestriction(Domain.Restriction restriction)
+        {
+            writer.WriteBoolean(restriction.Enumeration is not null);
+            if (restriction.Enumeration is not null)
+            {
+                writer.WriteVarUInt((ulong)restriction.Enumeration.Count);
+                foreach (var value in restriction.Enumeration)
+                    writer.WriteReference(_names, value);
+            }
+            WriteNullableUInt(restriction.FractionDigits);
+            WriteNullableUInt(restriction.Length);
+            WriteNullableDouble(restriction.MaxExclusive);
+            WriteNullableDouble(restriction.MaxInclusive);
+            WriteNullableUInt(restriction.MaxLength);
+            WriteNullableDouble(restriction.MinExclusive);
+            WriteNullableDouble(restriction.MinInclusive);
+            WriteNullableUInt(restriction.MinLength);
+            writer.WriteNullableString(restriction.Pattern);
+            WriteNullableUInt(restriction.TotalDigits);
+            writer.WriteBoolean(restriction.WhiteSpace is not null);
+            if (restriction.WhiteSpace is not null)
+                writer.WriteByte((byte)restriction.WhiteSpace.Value);
+        }
+
+        private void WriteNullableReference(string? value)
+        {
+            writer.WriteBoolean(value is not null);
+            if (value is not null)
+                writer.WriteReference(_names, value);
+        }
+
+        private void WriteNullableDouble(double? value)
+        {
+            writer.WriteBoolean(value is not null);
+            if (value is not null)
+                writer.WriteDouble(value.Value);
+        }
+
+        private void WriteNullableUInt(uint? value)
+        {
+            writer.WriteBoolean(value is not null);
+            if (value is not null)
+                writer.WriteVarUInt(value.Value);
+        }
+    }
+
+    private sealed class Decoder(WireReader reader)
+    {
+        // Counts read from the payload aren't trusted for preallocating
+        private const int MaxInitialCapacity = 1024;
+
+        private readonly List<string> _names = new();
+
+        public Domain.Package ReadPackage()
+        {
+            var header = ReadHeader();
+
+            var count = reader.ReadLength();
+            var dataChannels = new List<Domain.DataChannel>(Math.Min(count, MaxInitialCapacity));
+            for (var i = 0; i < count; i++)
+                dataChannels.Add(ReadDataChannel());
+
+            return new Domain.Package { Header = header, DataChannelList = new Domain.DataChannelList(dataChannels) };
+        }
+
+        private Domain.Header ReadHeader()
+        {
+            var shipId = ShipId.Parse(reader.ReadString());
+            var dataChannelListId = new Domain.ConfigurationReference
+            {
+                Id = reader.ReadString(),
+                Version = reader.ReadNullableString(),
+                TimeStamp = reader.ReadDateTimeOffset(),
+            };
+
+            Domain.VersionInformation? versionInformation = null;
+            if (reader.ReadBoolean())
+                versionInformation = new Domain.VersionInformation
+                {
+                    NamingRule = reader.ReadString(),
+                    NamingSchemeVersion = reader.ReadString(),
+                    ReferenceUrl = reader.ReadNullableString(),
+                };
+
+            return new Domain.Header
+            {
+                ShipId = shipId,
+                DataChannelListId = dataChannelListId,
+                VersionInformation = versionInformation,
+                Author = reader.ReadNullableString(),
+                DateCreated = reader.ReadNullableDateTimeOffset(),
+                CustomHeaders = ValueEncoding.ReadProperties(reader),
+            };
+        }
+
+        private Domain.DataChannel ReadDataChannel()
+        {
+            var localId = LocalId.Parse(reader.ReadString());
+            var shortId = reader.ReadNullableString();
+            Domain.NameObject? nameObject = null;
+            if (reader.ReadBoolean())
+                nameObject = new Domain.NameObject
+                {
+                    NamingRule = ReadName(),
+                    CustomNameObjects = ValueEncoding.ReadProperties(reader),
+                };
+
+            var dataChannelType = new Domain.DataChannelType
+            {
+                Type = ReadName(),
+                UpdateCycle = ReadNullableDouble(),
+                CalculationPeriod = ReadNullableDouble(),
+            };
+            var format = new Domain.Format
+            {
+                Type = ReadName(),
+                Restriction = reader.ReadBoolean() ? ReadRestriction() : null,
+            };
+
+            Domain.Range? range = null;
+            if (reader.ReadBoolean())
+                range = new Domain.Range { Low = reader.ReadDouble(), High = reader.ReadDouble() };
+
+            Domain.Unit? unit = null;
+            if (reader.ReadBoolean())
+                unit = new Domain.Unit
+                {
+                    UnitSymbol = ReadName(),
+                    QuantityName = ReadNullableName(),
+                    CustomElements = ValueEncoding.ReadProperties(reader),
+                };
+
+            return new Domain.DataChannel
+            {
+                DataChannelId = new Domain.DataChannelId
+                {
+                    LocalId = localId,
+                    ShortId = shortId,
+                    NameObject = nameObject,
+                },
+                Property = new Domain.Property
+                {
+                    DataChannelType = dataChannelType,
+                    Format = format,
+                    Range = range,
+                    Unit = unit,
+                    QualityCoding = ReadNullableName(),
+                    AlertPriority = ReadNullableName(),
+                    Name = reader.ReadNullableString(),
+                    Remarks = reader.ReadNullableString(),
+                    CustomProperties = ValueEncoding.ReadProperties(reader),
+                },
+            };
+        }
+
+        private Domain.Restriction ReadRestriction()
+        {
+            List<string>? enumeration = null;
+            if (reader.ReadBoolean())
+            {
+                var count = reader.ReadLength();
+                enumeration = new(Math.Min(count, MaxInitialCapacity));
+                for (var i = 0; i < count; i++)
+                    enumeration.Add(ReadName());
+            }
+
+            return new Domain.Restriction
+            {
+                Enumeration = enumeration,
+                FractionDigits = ReadNullableUInt(),
+                Length = ReadNullableUInt(),
+                MaxExclusive = ReadNullableDouble(),
+                MaxInclusive = ReadNullableDouble(),
+                MaxLength = ReadNullableUInt(),
+                MinExclusive = ReadNullableDouble(),
+                MinInclusive = ReadNullableDouble(),
+                MinLength = ReadNullableUInt(),
+                Pattern = reader.ReadNullableString(),
+                TotalDigits = ReadNullableUInt(),
+                WhiteSpace = reader.ReadBoolean() ? ReadWhiteSpace() : null,
+            };
+        }
+
+        private Domain.WhiteSpace ReadWhiteSpace()
+        {
+            var value = reader.ReadByte();
+            if (value > (byte)Domain.WhiteSpace.Collapse)
+                throw new InvalidDataException($"Invalid white space {value}");
+            return (Domain.WhiteSpace)value;
+        }
+
+        private string ReadName() => reader.ReadReference(_names, static s => s);
+
+        private string? ReadNullableName() => reader.ReadBoolean() ? ReadName() : null;
+
+        private double? ReadNullableDouble() => reader.ReadBoolean() ? reader.ReadDouble() : null;
+
+        private uint? ReadNullableUInt()
+        {
+            if (!reader.ReadBoolean())
+                return null;
+            var value = reader.ReadVarUInt();
+            if (value > uint.MaxValue)
+                throw new InvalidDataException($"Invalid unsigned integer {value}");
+            return (uint)value;
+        }
+    }
+}
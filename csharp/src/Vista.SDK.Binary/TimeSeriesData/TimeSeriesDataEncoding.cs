@@ -0,0 +1,367 @@
+using Vista.SDK.Internal;
+using Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Transport.Binary;
+
+/// <summary>
+/// Encoding of <see cref="TimeSeriesDataPackage"/>.
+/// Data channel ids and qualities are written once per package and referenced by index after that,
+/// and the data sets of tables are encoded column by column with <see cref="TabularDataCodec"/>.
+/// Timestamps of consecutive event data sets are written as deltas.
+/// </summary>
+internal static class TimeSeriesDataEncoding
+{
+    private static ReadOnlySpan<byte> Magic => "VTS"u8;
+
+    public const byte Version = 1;
+
+    // Data sets of a table are written row by row when they can't be encoded by TabularDataCodec
+    private const byte NoDataSets = 0;
+    private const byte RowDataSets = 1;
+    private const byte EncodedDataSets = 2;
+
+    public static void Write(WireWriter writer, TimeSeriesDataPackage package)
+    {
+        foreach (var b in Magic)
+            writer.WriteByte(b);
+        writer.WriteByte(Version);
+
+        using var encoder = new Encoder(writer);
+        encoder.WritePackage(package.Package);
+        writer.Flush();
+    }
+
+    public static TimeSeriesDataPackage Read(WireReader reader)
+    {
+        foreach (var b in Magic)
+        {
+            if (reader.ReadByte() != b)
+                throw new InvalidDataException("Not a binary TimeSeriesData package");
+        }
+        var version = reader.ReadByte();
+        if (version != Version)
+            throw new InvalidDataException($"Unsupported binary TimeSeriesData package version {version}");
+
+        var decoder = new Decoder(reader);
+        return new TimeSeriesDataPackage { Package = decoder.ReadPackage() };
+    }
+
+    private sealed class Encoder(WireWriter writer) : IDisposable
+    {
+        private readonly PooledBufferWriter _encoded = new();
+        private readonly Dictionary<string, int> _dataChannelIds = new(StringComparer.Ordinal);
+        private readonly Dictionary<string, int> _qualities = new(StringComparer.Ordinal);
+
+        public void WritePackage(Package package)
+        {
+            writer.WriteBoolean(package.Header is not null);
+            if (package.Header is not null)
+                WriteHeader(package.Header);
+
+            writer.WriteVarUInt((ulong)package.TimeSeriesData.Count);
+            foreach (var data in package.TimeSeriesData)
+                WriteTimeSeriesData(data);
+        }
+
+        private void WriteHeader(Header header)
+        {
+            writer.WriteString(header.ShipId.ToString());
+            writer.WriteBoolean(header.TimeSpan is not null);
+            if (header.TimeSpan is not null)
+            {
+                writer.WriteDateTimeOffset(header.TimeSpan.Start);
+                writer.WriteDateTimeOffset(header.TimeSpan.End);
+            }
+            writer.WriteNullableDateTimeOffset(header.DateCreated);
+            writer.WriteNullableDateTimeOffset(header.DateModified);
+            writer.WriteNullableString(header.Author);
+
+            writer.WriteBoolean(header.SystemConfiguration is not null);
+            if (header.SystemConfiguration is not null)
+            {
+                writer.WriteVarUInt((ulong)header.SystemConfiguration.Count);
+                foreach (var configuration in header.SystemConfiguration)
+                    WriteConfigurationReference(configuration);
+            }
+            ValueEncoding.WriteProperties(writer, header.CustomHeaders);
+        }
+
+        private void WriteTimeSeriesData(TimeSeriesData data)
+        {
+            writer.WriteBoolean(data.DataConfiguration is not null);
+            if (data.DataConfiguration is not null)
+                WriteConfigurationReference(data.DataConfiguration);
+
+            writer.WriteBoolean(data.TabularData is not null);
+            if (data.TabularData is not null)
+            {
+                writer.WriteVarUInt((ulong)data.TabularData.Count);
+                foreach (var table in data.TabularData)
+                    WriteTabularData(table);
+            }
+
+            writer.WriteBoolean(data.EventData is not null);
+            if (data.EventData is not null)
+                WriteEventData(data.EventData);
+
+            ValueEncoding.WriteProperties(writer, data.CustomDataKinds);
+        }
+
+        private void WriteTabularData(TabularData table)
+        {
+            writer.WriteBoolean(table.DataChannelIds is not null);
+            if (table.DataChannelIds is not null)
+            {
+                writer.WriteVarUInt((ulong)table.DataChannelIds.Count);
+                foreach (var dataChannelId in table.DataChannelIds)
+                    writer.WriteReference(_dataChannelIds, dataChannelId.ToString());
+            }
+
+            if (table.DataSets is null)
+            {
+                writer.WriteByte(NoDataSets);
+                return;
+            }
+
+            _encoded.Clear();
+            if (TabularDataCodec.TryEncode(table, _encoded))
+            {
+                writer.WriteByte(EncodedDataSets);
+                writer.WriteBytes(_encoded.WrittenSpan);
+                return;
+            }
+
+            writer.WriteByte(RowDataSets);
+            writer.WriteVarUInt((ulong)table.DataSets.Count);
+            var previous = default(DateTimeOffset);
+            foreach (var dataSet in table.DataSets)
+            {
+                WriteTimeStamp(dataSet.TimeStamp, ref previous);
+                writer.WriteVarUInt((ulong)dataSet.Value.Count);
+                foreach (var value in dataSet.Value)
+                    ValueEncoding.Write(writer, value);
+
+                writer.WriteBoolean(dataSet.Quality is not null);
+                if (dataSet.Quality is not null)
+                {
+                    writer.WriteVarUInt((ulong)dataSet.Quality.Count);
+                    foreach (var quality in dataSet.Quality)
+                        writer.WriteReference(_qualities, quality);
+                }
+            }
+        }
+
+        private void WriteEventData(EventData eventData)
+        {
+            writer.WriteBoolean(eventData.DataSet is not null);
+            if (eventData.DataSet is null)
+                return;
+
+            writer.WriteVarUInt((ulong)eventData.DataSet.Count);
+            var previous = default(DateTimeOffset);
+            foreach (var dataSet in eventData.DataSet)
+            {
+                WriteTimeStamp(dataSet.TimeStamp, ref previous);
+                writer.WriteReference(_dataChannelIds, dataSet.DataChannelId.ToString());
+                ValueEncoding.Write(writer, dataSet.Value);
+                writer.WriteBoolean(dataSet.Quality is not null);
+                if (dataSet.Quality is not null)
+                    writer.WriteReference(_qualities, dataSet.Quality);
+            }
+        }
+
+        private void WriteConfigurationReference(ConfigurationReference configuration)
+        {
+            writer.WriteString(configuration.Id);
+            writer.WriteDateTimeOffset(configuration.TimeStamp);
+        }
+
+        private void WriteTimeStamp(DateTimeOffset timeStamp, ref DateTimeOffset previous)
+        {
+            writer.WriteVarInt(timeStamp.UtcTicks - previous.UtcTicks);
+            writer.WriteVarInt((long)(timeStamp.Offset - previous.Offset).TotalMinutes);
+            previous = timeStamp;
+        }
+
+        public void Dispose() => _encoded.Dispose();
+    }
+
+    private sealed class Decoder(WireReader reader)
+    {
+        // Counts read from the payload aren't trusted for preallocating
+        private const int MaxInitialCapacity = 1024;
+
+        private readonly List<DataChannelId> _dataChannelIds = new();
+        private readonly List<string> _qualities = new();
+
+        public Package ReadPackage()
+        {
+            var header = reader.ReadBoolean() ? ReadHeader() : null;
+
+            var count = reader.ReadLength();
+            var timeSeriesData = new List<TimeSeriesData>(Math.Min(count, MaxInitialCapacity));
+            for (var i = 0; i < count; i++)
+                timeSeriesData.Add(ReadTimeSeriesData());
+
+            return new Package { Header = header, TimeSeriesData = timeSeriesData };
+        }
+
+        private Header ReadHeader()
+        {
+            var shipId = ShipId.Parse(reader.ReadString());
+            TimeSeries.TimeSpan? timeSpan = null;
+            if (reader.ReadBoolean())
+                timeSpan = new TimeSeries.TimeSpan
+                {
+                    Start = reader.ReadDateTimeOffset(),
+                    End = reader.ReadDateTimeOffset(),
+                };
+            var dateCreated = reader.ReadNullableDateTimeOffset();
+            var dateModified = reader.ReadNullableDateTimeOffset();
+            var author = reader.ReadNullableString();
+
+            List<ConfigurationReference>? systemConfiguration = null;
+            if (reader.ReadBoolean())
+            {
+                var count = reader.ReadLength();
+                systemConfiguration = new(Math.Min(count, MaxInitialCapacity));
+                for (var i = 0; i < count; i++)
+                    systemConfiguration.Add(ReadConfigurationReference());
+            }
+
+            return new Header
+            {
+                ShipId = shipId,
+                TimeSpan = timeSpan,
+                DateCreated = dateCreated,
+                DateModified = dateModified,
+                Author = author,
+                SystemConfiguration = systemConfiguration,
+                CustomHeaders = ValueEncoding.ReadProperties(reader),
+            };
+        }
+
+        private TimeSeriesData ReadTimeSeriesData()
+        {
+            var dataConfiguration = reader.ReadBoolean() ? ReadConfigurationReference() : null;
+
+            List<TabularData>? tabularData = null;
+            if (reader.ReadBoolean())
+            {
+                var count = reader.ReadLength();
+                tabularData = new(Math.Min(count, MaxInitialCapacity));
+                for (var i = 0; i < count; i++)
+                    tabularData.Add(ReadTabularData());
+            }
+
+            var eventData = reader.ReadBoolean() ? ReadEventData() : null;
+
+            return new TimeSeriesData
+            {
+                DataConfiguration = dataConfiguration,
+                TabularData = tabularData,
+                EventData = eventData,
+                CustomDataKinds = ValueEncoding.ReadProperties(reader),
+            };
+        }
+
+        private TabularData ReadTabularData()
+        {
+            List<DataChannelId>? dataChannelIds = null;
+            if (reader.ReadBoolean())
+            {
+                var count = reader.ReadLength();
+                dataChannelIds = new(Math.Min(count, MaxInitialCapacity));
+                for (var i = 0; i < count; i++)
+                    dataChannelIds.Add(ReadDataChannelId());
+            }
+
+            List<TabularDataSet>? dataSets = null;
+            var kind = reader.ReadByte();
+            if (kind == EncodedDataSets)
+            {
+                dataSets = TabularDataCodec.Decode(reader.ReadBytes());
+            }
+            else if (kind == RowDataSets)
+            {
+                var count = reader.ReadLength();
+                dataSets = new(Math.Min(count, MaxInitialCapacity));
+                var previous = default(DateTimeOffset);
+                for (var i = 0; i < count; i++)
+                {
+                    var timeStamp = ReadTimeStamp(ref previous);
+
+                    var valueCount = reader.ReadLength();
+                    var values = new List<string>(Math.Min(valueCount, MaxInitialCapacity));
+                    for (var j = 0; j < valueCount; j++)
+                        values.Add(ValueEncoding.Read(reader));
+
+                    List<string>? quality = null;
+                    if (reader.ReadBoolean())
+                    {
+                        var qualityCount = reader.ReadLength();
+                        quality = new(Math.Min(qualityCount, MaxInitialCapacity));
+                        for (var j = 0; j < qualityCount; j++)
+                            quality.Add(reader.ReadReference(_qualities, static s => s));
+                    }
+
+                    dataSets.Add(
+                        new TabularDataSet
+                        {
+                            TimeStamp = timeStamp,
+                            Value = values,
+                            Quality = quality,
+                        }
+                    );
+                }
+            }
+            else if (kind != NoDataSets)
+            {
+                throw new InvalidDataException($"Invalid data sets kind {kind}");
+            }
+
+            return new TabularData { DataChannelIds = dataChannelIds, DataSets = dataSets };
+        }
+
+        private EventData ReadEventData()
+        {
+            if (!reader.ReadBoolean())
+                return new EventData { DataSet = null };
+
+            var count = reader.ReadLength();
+            var dataSet = new List<EventDataSet>(Math.Min(count, MaxInitialCapacity));
+            var previous = default(DateTimeOffset);
+            for (var i = 0; i < count; i++)
+            {
+                var timeStamp = ReadTimeStamp(ref previous);
+                var dataChannelId = ReadDataChannelId();
+                var value = ValueEncoding.Read(reader);
+                var quality = reader.ReadBoolean() ? reader.ReadReference(_qualities, static s => s) : null;
+                dataSet.Add(
+                    new EventDataSet
+                    {
+                        TimeStamp = timeStamp,
+                        DataChannelId = dataChannelId,
+                        Value = value,
+                        Quality = quality,
+                    }
+                );
+            }
+            return new EventData { DataSet = dataSet };
+        }
+
+        private ConfigurationReference ReadConfigurationReference() =>
+            new ConfigurationReference { Id = reader.ReadString(), TimeStamp = reader.ReadDateTimeOffset() };
+
+        private DateTimeOffset ReadTimeStamp(ref DateTimeOffset previous)
+        {
+            var utcTicks = previous.UtcTicks + reader.ReadVarInt();
+            var offsetMinutes = (long)previous.Offset.TotalMinutes + reader.ReadVarInt();
+            previous = WireReader.ToDateTimeOffset(utcTicks, offsetMinutes);
+            return previous;
+        }
+
+        // Each distinct data channel id is parsed once per package
+        private DataChannelId ReadDataChannelId() => reader.ReadReference(_dataChannelIds, DataChannelId.Parse);
+    }
+}
@@ -0,0 +1,159 @@
+using System.Globalization;
+using System.Text.Json;
+using Vista.SDK.Internal;
+
+namespace Vista.SDK.Transport.Binary;
+
+/// <summary>
+/// Typed encoding of the string values of the packages.
+/// A value is only encoded as a number when formatting the number gives back the exact same string,
+/// so decoding always reproduces the original value.
+/// </summary>
+internal static class ValueEncoding
+{
+    private const byte StringValue = 0;
+    private const byte DecimalValue = 1;
+    private const byte DoubleValue = 2;
+    private const byte TrueValue = 3;
+    private const byte FalseValue = 4;
+
+    public static void Write(WireWriter writer, string value)
+    {
+        if (DecimalText.TryParse(value, out var mantissa, out var scale))
+        {
+            writer.WriteByte(DecimalValue);
+            writer.WriteVarInt(mantissa);
+            writer.WriteByte((byte)scale);
+        }
+        else if (value == "true")
+        {
+            writer.WriteByte(TrueValue);
+        }
+        else if (value == "false")
+        {
+            writer.WriteByte(FalseValue);
+        }
+        else if (DecimalText.TryParseDouble(value, out var d))
+        {
+            writer.WriteByte(DoubleValue);
+            writer.WriteDouble(d);
+        }
+        else
+        {
+            writer.WriteByte(StringValue);
+            writer.WriteString(value);
+        }
+    }
+
+    public static string Read(WireReader reader)
+    {
+        var kind = reader.ReadByte();
+        switch (kind)
+        {
+            case StringValue:
+                return reader.ReadString();
+            case DecimalValue:
+                var mantissa = reader.ReadVarInt();
+                var scale = reader.ReadByte();
+                if (scale > DecimalText.MaxDigits)
+                    throw new InvalidDataException($"Invalid decimal scale {scale}");
+                return DecimalText.Format(mantissa, scale);
+            case DoubleValue:
+                return DecimalText.FormatDouble(reader.ReadDouble());
+            case TrueValue:
+                return "true";
+            case FalseValue:
+                return "false";
+            default:
+                throw new InvalidDataException($"Invalid value kind {kind}");
+        }
+    }
+
+    private const byte NullProperty = 0;
+    private const byte StringProperty = 1;
+    private const byte TrueProperty = 2;
+    private const byte FalseProperty = 3;
+    private const byte IntegerProperty = 4;
+    private const byte DoubleProperty = 5;
+    private const byte JsonProperty = 6;
+
+    /// <summary>
+    /// Writes custom properties, which hold JSON primitives, or <see cref="JsonElement"/> when read from JSON.
+    /// Elements are written as their JSON text.
+    /// </summary>
+    /// <exception cref="NotSupportedException">A property value of another type</exception>
+    public static void WriteProperties(WireWriter writer, IReadOnlyCollection<KeyValuePair<string, object>>? properties)
+    {
+        writer.WriteBoolean(properties is not null);
+        if (properties is null)
+            return;
+
+        writer.WriteVarUInt((ulong)properties.Count);
+        foreach (var property in properties)
+        {
+            writer.WriteString(property.Key);
+            switch (property.Value)
+            {
+                case null:
+                    writer.WriteByte(NullProperty);
+                    break;
+                case string s:
+                    writer.WriteByte(StringProperty);
+                    writer.WriteString(s);
+                    break;
+                case bool b:
+                    writer.WriteByte(b ? TrueProperty : FalseProperty);
+                    break;
+                case long or int or short or sbyte or uint or ushort or byte:
+                    writer.WriteByte(IntegerProperty);
+                    writer.WriteVarInt(Convert.ToInt64(property.Value, CultureInfo.InvariantCulture));
+                    break;
+                case double or float:
+                    writer.WriteByte(DoubleProperty);
+                    writer.WriteDouble(Convert.ToDouble(property.Value, CultureInfo.InvariantCulture));
+                    break;
+                case JsonElement element:
+                    writer.WriteByte(JsonProperty);
+                    writer.WriteString(element.GetRawText());
+                    break;
+                default:
+                    throw new NotSupportedException(
+                        $"Custom property '{property.Key}' of type {property.Value.GetType()} can't be encoded"
+                    );
+            }
+        }
+    }
+
+    public static Dictionary<string, object>? ReadProperties(WireReader reader)
+    {
+        if (!reader.ReadBoolean())
+            return null;
+
+        var count = reader.ReadLength();
+        var properties = new Dictionary<string, object>(Math.Min(count, 64));
+        for (var i = 0; i < count; i++)
+        {
+            var key = reader.ReadString();
+            var kind = reader.ReadByte();
+            object? value = kind switch
+            {
+                NullProperty => null,
+                StringProperty => reader.ReadString(),
+                TrueProperty => true,
+                FalseProperty => false,
+                IntegerProperty => reader.ReadVarInt(),
+                DoubleProperty => reader.ReadDouble(),
+                JsonProperty => ParseElement(reader.ReadString()),
+                _ => throw new InvalidDataException($"Invalid property kind {kind}"),
+            };
+            properties[key] = value!;
+        }
+        return properties;
+    }
+
+    private static JsonElement ParseElement(string json)
+    {
+        using var document = JsonDocument.Parse(json);
+        return document.RootElement.Clone();
+    }
+}
@@ -0,0 +1,209 @@
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Text;
+
+namespace Vista.SDK.Transport.Binary;
+
+/// <summary>
+/// Buffered reader of the wire primitives, from a byte array or refilled from a <see cref="Stream"/>
+/// as it is consumed, so decoding never holds more than one buffer of the payload.
+/// </summary>
+/// <remarks>
+/// Strings and byte fields longer than the maximum length are rejected before anything is allocated for them,
+/// and the buffer only grows as their bytes are read, so a corrupt length fails at the end of the stream.
+/// </remarks>
+internal sealed class WireReader : IDisposable
+{
+    private const int DefaultBufferSize = 16 * 1024;
+
+    private readonly Stream? _stream;
+    private readonly int _maxLength;
+    private byte[] _buffer;
+    private readonly bool _rented;
+    private int _position;
+    private int _end;
+
+    public WireReader(Stream stream, int maxLength = BinarySerializer.DefaultMaxFieldLength)
+    {
+        if (maxLength <= 0)
+            throw new ArgumentOutOfRangeException(nameof(maxLength));
+        _stream = stream ?? throw new ArgumentNullException(nameof(stream));
+        _maxLength = maxLength;
+        _buffer = ArrayPool<byte>.Shared.Rent(DefaultBufferSize);
+        _rented = true;
+    }
+
+    public WireReader(byte[] data, int offset, int count, int maxLength = BinarySerializer.DefaultMaxFieldLength)
+    {
+        if (maxLength <= 0)
+            throw new ArgumentOutOfRangeException(nameof(maxLength));
+        _buffer = data ?? throw new ArgumentNullException(nameof(data));
+        _maxLength = maxLength;
+        _position = offset;
+        _end = offset + count;
+    }
+
+    public byte ReadByte()
+    {
+        Ensure(1);
+        return _buffer[_position++];
+    }
+
+    public bool ReadBoolean() =>
+        ReadByte() switch
+        {
+            0 => false,
+            1 => true,
+            var b => throw new InvalidDataException($"Invalid boolean value {b}"),
+        };
+
+    public ulong ReadVarUInt()
+    {
+        ulong result = 0;
+        for (var shift = 0; shift < 64; shift += 7)
+        {
+            if (_position == _end)
+                Ensure(1);
+            var b = _buffer[_position++];
+            result |= (ulong)(b & 0x7F) << shift;
+            if (b < 0x80)
+                return result;
+        }
+        throw new InvalidDataException("Variable length integer is too long");
+    }
+
+    public long ReadVarInt()
+    {
+        var value = ReadVarUInt();
+        return (long)(value >> 1) ^ -(long)(value & 1);
+    }
+
+    /// <summary>Reads a length or count, bounded like arrays are</summary>
+    public int ReadLength()
+    {
+        var value = ReadVarUInt();
+        if (value > int.MaxValue)
+            throw new InvalidDataException($"Invalid length {value}");
+        return (int)value;
+    }
+
+    public double ReadDouble()
+    {
+        Ensure(8);
+        var bits = BinaryPrimitives.ReadInt64LittleEndian(_buffer.AsSpan(_position));
+        _position += 8;
+        return BitConverter.Int64BitsToDouble(bits);
+    }
+
+    /// <summary>Reads the length of a string or byte field, bounded by the maximum length</summary>
+    private int ReadFieldLength()
+    {
+        var length = ReadLength();
+        if (length > _maxLength)
+            throw new InvalidDataException($"Field length {length} exceeds the maximum of {_maxLength}");
+        return length;
+    }
+
+    public string ReadString()
+    {
+        var length = ReadFieldLength();
+        Ensure(length);
+        var value = Encoding.UTF8.GetString(_buffer, _position, length);
+        _position += length;
+        return value;
+    }
+
+    public string? ReadNullableString() => ReadBoolean() ? ReadString() : null;
+
+    /// <summary>Reads a reference written by <see cref="WireWriter.WriteReference"/>, creating values once per table</summary>
+    public T ReadReference<T>(List<T> table, Func<string, T> create)
+    {
+        var index = ReadLength();
+        if (index < table.Count)
+            return table[index];
+        if (index != table.Count)
+            throw new InvalidDataException($"Invalid string reference {index}");
+
+        var value = create(ReadString());
+        table.Add(value);
+        return value;
+    }
+
+    public ReadOnlySpan<byte> ReadBytes()
+    {
+        var length = ReadFieldLength();
+        Ensure(length);
+        var value = _buffer.AsSpan(_position, length);
+        _position += length;
+        return value;
+    }
+
+    public DateTimeOffset ReadDateTimeOffset()
+    {
+        var utcTicks = ReadVarInt();
+        var offsetMinutes = ReadVarInt();
+        return ToDateTimeOffset(utcTicks, offsetMinutes);
+    }
+
+    public DateTimeOffset? ReadNullableDateTimeOffset() => ReadBoolean() ? ReadDateTimeOffset() : null;
+
+    public static DateTimeOffset ToDateTimeOffset(long utcTicks, long offsetMinutes)
+    {
+        // DateTimeOffset allows offsets of up to 14 hours
+        if (offsetMinutes is < -14 * 60 or > 14 * 60)
+            throw new InvalidDataException($"Invalid timestamp offset {offsetMinutes}");
+        try
+        {
+            var offset = System.TimeSpan.FromMinutes(offsetMinutes);
+            return new DateTimeOffset(utcTicks, System.TimeSpan.Zero).ToOffset(offset);
+        }
+        catch (ArgumentException ex)
+        {
+            throw new InvalidDataException("Invalid timestamp", ex);
+        }
+    }
+
+    private void Ensure(int count)
+    {
+        if (_end - _position >= count)
+            return;
+        if (_stream is null)
+            throw new EndOfStreamException("Unexpected end of binary package");
+
+        // Move what is left to the front
+        var remaining = _end - _position;
+        if (remaining > 0)
+            Buffer.BlockCopy(_buffer, _position, _buffer, 0, remaining);
+        _position = 0;
+        _end = remaining;
+
+        while (_end < count)
+        {
+            // Values larger than the buffer grow it by doubling as their bytes arrive
+            if (_end == _buffer.Length)
+                Grow(Math.Min(count, (int)Math.Min(int.MaxValue, 2L * _buffer.Length)));
+            var read = _stream.Read(_buffer, _end, _buffer.Length - _end);
+            if (read == 0)
+                throw new EndOfStreamException("Unexpected end of binary package");
+            _end += read;
+        }
+    }
+
+    private void Grow(int size)
+    {
+        var buffer = ArrayPool<byte>.Shared.Rent(size);
+        Buffer.BlockCopy(_buffer, 0, buffer, 0, _end);
+        ArrayPool<byte>.Shared.Return(_buffer);
+        _buffer = buffer;
+    }
+
+    public void Dispose()
+    {
+        if (!_rented)
+            return;
+        var buffer = _buffer;
+        _buffer = Array.Empty<byte>();
+        if (buffer.Length > 0)
+            ArrayPool<byte>.Shared.Return(buffer);
+    }
+}
@@ -0,0 +1,160 @@
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Text;
+
+namespace Vista.SDK.Transport.Binary;
+
+/// <summary>
+/// Buffered writer of the wire primitives, flushing to a <see cref="Stream"/> or <see cref="IBufferWriter{T}"/>
+/// whenever the buffer is full, so encoding never holds more than one buffer of the payload.
+/// </summary>
+internal sealed class WireWriter : IDisposable
+{
+    private const int DefaultBufferSize = 16 * 1024;
+
+    // LEB128 of a 64-bit value takes at most 10 bytes
+    private const int MaxVarIntLength = 10;
+
+    private readonly Stream? _stream;
+    private readonly IBufferWriter<byte>? _bufferWriter;
+    private byte[] _buffer;
+    private int _position;
+
+    public WireWriter(Stream stream)
+    {
+        _stream = stream ?? throw new ArgumentNullException(nameof(stream));
+        _buffer = ArrayPool<byte>.Shared.Rent(DefaultBufferSize);
+    }
+
+    public WireWriter(IBufferWriter<byte> bufferWriter)
+    {
+        _bufferWriter = bufferWriter ?? throw new ArgumentNullException(nameof(bufferWriter));
+        _buffer = ArrayPool<byte>.Shared.Rent(DefaultBufferSize);
+    }
+
+    public void WriteByte(byte value)
+    {
+        Ensure(1);
+        _buffer[_position++] = value;
+    }
+
+    public void WriteBoolean(bool value) => WriteByte(value ? (byte)1 : (byte)0);
+
+    public void WriteVarUInt(ulong value)
+    {
+        Ensure(MaxVarIntLength);
+        var buffer = _buffer;
+        var position = _position;
+        while (value >= 0x80)
+        {
+            buffer[position++] = (byte)(value | 0x80);
+            value >>= 7;
+        }
+        buffer[position++] = (byte)value;
+        _position = position;
+    }
+
+    /// <summary>Zigzag encoded, so small negative values are as short as small positive ones</summary>
+    public void WriteVarInt(long value) => WriteVarUInt((ulong)((value << 1) ^ (value >> 63)));
+
+    public void WriteDouble(double value)
+    {
+        Ensure(8);
+        BinaryPrimitives.WriteInt64LittleEndian(_buffer.AsSpan(_position), BitConverter.DoubleToInt64Bits(value));
+        _position += 8;
+    }
+
+    public void WriteString(string value)
+    {
+        var length = Encoding.UTF8.GetByteCount(value);
+        WriteVarUInt((ulong)length);
+        Ensure(length);
+        _position += Encoding.UTF8.GetBytes(value, 0, value.Length, _buffer, _position);
+    }
+
+    public void WriteNullableString(string? value)
+    {
+        WriteBoolean(value is not null);
+        if (value is not null)
+            WriteString(value);
+    }
+
+    /// <summary>
+    /// Writes the index of a string written to <paramref name="table"/> before,
+    /// or the next index followed by the string itself
+    /// </summary>
+    public void WriteReference(Dictionary<string, int> table, string value)
+    {
+        if (table.TryGetValue(value, out var index))
+        {
+            WriteVarUInt((ulong)index);
+            return;
+        }
+        index = table.Count;
+        table[value] = index;
+        WriteVarUInt((ulong)index);
+        WriteString(value);
+    }
+
+    public void WriteBytes(ReadOnlySpan<byte> value)
+    {
+        WriteVarUInt((ulong)value.Length);
+        Ensure(value.Length);
+        value.CopyTo(_buffer.AsSpan(_position));
+        _position += value.Length;
+    }
+
+    /// <summary>As UTC ticks and the offset in minutes</summary>
+    public void WriteDateTimeOffset(DateTimeOffset value)
+    {
+        WriteVarInt(value.UtcTicks);
+        WriteVarInt((long)value.Offset.TotalMinutes);
+    }
+
+    public void WriteNullableDateTimeOffset(DateTimeOffset? value)
+    {
+        WriteBoolean(value.HasValue);
+        if (value.HasValue)
+            WriteDateTimeOffset(value.Value);
+    }
+
+    public void Flush()
+    {
+        if (_position == 0)
+            return;
+
+        if (_stream is not null)
+        {
+            _stream.Write(_buffer, 0, _position);
+        }
+        else
+        {
+            var span = _bufferWriter!.GetSpan(_position);
+            _buffer.AsSpan(0, _position).CopyTo(span);
+            _bufferWriter.Advance(_position);
+        }
+        _position = 0;
+    }
+
+    private void Ensure(int count)
+    {
+        if (_buffer.Length - _position >= count)
+            return;
+
+        Flush();
+        if (_buffer.Length >= count)
+            return;
+
+        // A single value larger than the buffer, like a very long string
+        ArrayPool<byte>.Shared.Return(_buffer);
+        _buffer = ArrayPool<byte>.Shared.Rent(count);
+    }
+
+    public void Dispose()
+    {
+        var buffer = _buffer;
+        _buffer = Array.Empty<byte>();
+        if (buffer.Length > 0)
+            ArrayPool<byte>.Shared.Return(buffer);
+    }
+}
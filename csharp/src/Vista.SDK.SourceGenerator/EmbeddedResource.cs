@@ -55,6 +55,25 @@ internal static List<string> GetVisVersions()
         return JsonSerializer.Deserialize<GmodDto>(stream);
     }
 
+    /// <summary>
+    /// Precompiled Gmod snapshots are produced at build time by Vista.SDK.SnapshotGenerator,
+    /// the returned stream points directly into the assembly image.
+    /// </summary>
+    internal static UnmanagedMemoryStream? GetGmodSnapshot(string visVersion)
+    {
+        var assembly = Assembly.GetExecutingAssembly();
+
+        var snapshotResourceName = GetResourceNames(assembly)
+            .Where(x => x.Contains("gmod") && x.EndsWith(".snapshot") && !x.Contains("versioning"))
+            .Where(x => x.Contains(visVersion))
+            .SingleOrDefault();
+
+        if (snapshotResourceName is null)
+            return null;
+
+        return GetStream(assembly, snapshotResourceName);
+    }
+
     internal static CodebooksDto? GetCodebooks(string visVersion)
     {
         var assembly = Assembly.GetExecutingAssembly();
@@ -0,0 +1,28 @@
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using Vista.SDK.Transport.Json;
+
+namespace Vista.SDK.Transport.Json.DataChannel;
+
+/// <summary>
+/// Source-generated metadata for the DataChannelList DTOs, resolved through <see cref="Serializer.Options"/>
+/// and usable directly for trimmed or NativeAOT applications.
+/// The extension data types cover the values deserialization produces and the JSON primitives.
+/// </summary>
+#if NET8_0_OR_GREATER
+[JsonSourceGenerationOptions(
+    DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull,
+    Converters = new[] { typeof(DateTimeConverter), typeof(DatetimeOffsetConverter) }
+)]
+#else
+// System.Text.Json 6 has no converters in the generation options, construct the context with a copy of Serializer.Options
+[JsonSourceGenerationOptions(DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull)]
+#endif
+[JsonSerializable(typeof(DataChannelListPackage))]
+[JsonSerializable(typeof(JsonElement))]
+[JsonSerializable(typeof(string))]
+[JsonSerializable(typeof(bool))]
+[JsonSerializable(typeof(long))]
+[JsonSerializable(typeof(double))]
+[JsonSerializable(typeof(decimal))]
+public sealed partial class DataChannelListSerializerContext : JsonSerializerContext { }
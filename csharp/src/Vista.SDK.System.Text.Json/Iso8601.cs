@@ -0,0 +1,194 @@
+using System.Text.Json;
+#if !NET8_0_OR_GREATER
+using System.Globalization;
+using System.Text.RegularExpressions;
+#endif
+
+namespace Vista.SDK.Transport.Json;
+
+/// <summary>
+/// Parser for the strict ISO 8601-1 timestamps of the transport packages,
+/// <c>yyyy-MM-ddTHH:mm:ss[.f+](Z|±HH:mm)</c>, validating and parsing in one pass.
+/// </summary>
+/// <remarks>
+/// Accepts and produces the same values as matching the format and then calling
+/// <see cref="DateTimeOffset.Parse(string, IFormatProvider, System.Globalization.DateTimeStyles)"/> with
+/// <see cref="System.Globalization.DateTimeStyles.RoundtripKind"/>, including rounding fractions
+/// of more than 7 digits to the nearest tick and allowing one trailing line feed, like the regex's <c>$</c>.
+/// </remarks>
+internal static class Iso8601
+{
+    // Longest timestamp decoded from chars on the stack, longer ones can only be valid with very long fractions
+    private const int MaxStackallocLength = 128;
+
+    private static readonly System.TimeSpan MaxOffset = System.TimeSpan.FromHours(14);
+
+    public static bool TryParse(ReadOnlySpan<char> value, out DateTimeOffset result)
+    {
+        if (value.Length > MaxStackallocLength)
+            return TryParse(NarrowOrEmpty(value), out result);
+
+        Span<byte> bytes = stackalloc byte[value.Length];
+        for (var i = 0; i < value.Length; i++)
+        {
+            var ch = value[i];
+            if (ch > 0x7F)
+            {
+                result = default;
+                return false;
+            }
+            bytes[i] = (byte)ch;
+        }
+        return TryParse(bytes, out result);
+    }
+
+    public static bool TryParse(ReadOnlySpan<byte> utf8, out DateTimeOffset result)
+    {
+        result = default;
+
+        // The $ of the format regex also matches before a final line feed
+        if (utf8.Length > 0 && utf8[utf8.Length - 1] == '\n')
+            utf8 = utf8.Slice(0, utf8.Length - 1);
+
+        // yyyy-MM-ddTHH:mm:ss is 19 characters, followed by at least Z
+        if (utf8.Length < 20)
+            return false;
+        if (utf8[4] != '-' || utf8[7] != '-' || utf8[10] != 'T' || utf8[13] != ':' || utf8[16] != ':')
+            return false;
+        if (
+            !TryDigits(utf8, 0, 4, out var year)
+            || !TryDigits(utf8, 5, 2, out var month)
+            || !TryDigits(utf8, 8, 2, out var day)
+            || !TryDigits(utf8, 11, 2, out var hour)
+            || !TryDigits(utf8, 14, 2, out var minute)
+            || !TryDigits(utf8, 17, 2, out var second)
+        )
+            return false;
+
+        var i = 19;
+        var fraction = 0.0;
+        if (utf8[i] == '.')
+        {
+            // Accumulated like DateTimeParse.ParseFraction, so rounding matches DateTimeOffset.Parse
+            var decimalBase = 0.1;
+            var start = ++i;
+            while (i < utf8.Length && IsDigit(utf8[i]))
+            {
+                fraction += (utf8[i] - '0') * decimalBase;
+                decimalBase *= 0.1;
+                i++;
+            }
+            if (i == start)
+                return false;
+        }
+
+        if (i >= utf8.Length)
+            return false;
+
+        var offset = System.TimeSpan.Zero;
+        var sign = utf8[i];
+        if (sign == 'Z')
+        {
+            i++;
+        }
+        else if (sign is (byte)'+' or (byte)'-')
+        {
+            if (
+                utf8.Length - i != 6
+                || utf8[i + 3] != ':'
+                || !TryDigits(utf8, i + 1, 2, out var offsetHours)
+                || !TryDigits(utf8, i + 4, 2, out var offsetMinutes)
+                || offsetMinutes > 59
+            )
+                return false;
+            offset = new System.TimeSpan(offsetHours, offsetMinutes, 0);
+            if (offset > MaxOffset)
+                return false;
+            if (sign == '-')
+                offset = offset.Negate();
+            i += 6;
+        }
+        else
+        {
+            return false;
+        }
+
+        if (i != utf8.Length)
+            return false;
+
+        if (year < 1 || month is < 1 or > 12 || day < 1 || day > DateTime.DaysInMonth(year, month))
+            return false;
+        if (hour > 23 || minute > 59 || second > 59)
+            return false;
+
+        var ticks = new DateTime(year, month, day, hour, minute, second).Ticks;
+        ticks += (long)Math.Round(fraction * System.TimeSpan.TicksPerSecond);
+
+        // Out of range once rounded up or moved to UTC
+        var utcTicks = ticks - offset.Ticks;
+        if (ticks > DateTime.MaxValue.Ticks || utcTicks < DateTime.MinValue.Ticks || utcTicks > DateTime.MaxValue.Ticks)
+            return false;
+
+        result = new DateTimeOffset(ticks, offset);
+        return true;
+    }
+
+    /// <summary>Reads the current string token of <paramref name="reader"/> as a timestamp</summary>
+    /// <exception cref="FormatException">The value is not a strict ISO 8601-1 timestamp</exception>
+    public static DateTimeOffset Read(ref Utf8JsonReader reader)
+    {
+#if NET8_0_OR_GREATER
+        if (reader.TokenType == JsonTokenType.String && !reader.HasValueSequence && !reader.ValueIsEscaped)
+        {
+            if (TryParse(reader.ValueSpan, out var result))
+                return result;
+        }
+        else if (reader.GetString() is { } value && TryParse(value.AsSpan(), out var result))
+        {
+            return result;
+        }
+
+        throw new FormatException($"Invalid ISO 8601-1 format: '{reader.GetString()}'");
+#else
+        // System.Text.Json 6 can't tell if the raw value is escaped, so the string is matched and parsed
+        var value = reader.GetString() ?? string.Empty;
+        if (!StrictRegex.IsMatch(value))
+            throw new FormatException($"Invalid ISO 8601-1 format: '{value}'");
+        return DateTimeOffset.Parse(value, CultureInfo.InvariantCulture, DateTimeStyles.RoundtripKind);
+#endif
+    }
+
+#if !NET8_0_OR_GREATER
+    private static readonly Regex StrictRegex = new Regex(
+        @"^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}(\.\d+)?(Z|[+-]\d{2}:\d{2})$",
+        RegexOptions.Compiled | RegexOptions.CultureInvariant
+    );
+#endif
+
+    private static bool TryDigits(ReadOnlySpan<byte> utf8, int start, int count, out int value)
+    {
+        value = 0;
+        for (var i = start; i < start + count; i++)
+        {
+            var digit = utf8[i] - '0';
+            if ((uint)digit > 9)
+                return false;
+            value = value * 10 + digit;
+        }
+        return true;
+    }
+
+    private static bool IsDigit(byte b) => (uint)(b - '0') <= 9;
+
+    private static byte[] NarrowOrEmpty(ReadOnlySpan<char> value)
+    {
+        var bytes = new byte[value.Length];
+        for (var i = 0; i < value.Length; i++)
+        {
+            if (value[i] > 0x7F)
+                return Array.Empty<byte>();
+            bytes[i] = (byte)value[i];
+        }
+        return bytes;
+    }
+}
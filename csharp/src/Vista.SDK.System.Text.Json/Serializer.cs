@@ -2,9 +2,12 @@
 using System.Globalization;
 using System.Text.Json;
 using System.Text.Json.Serialization;
-using System.Text.RegularExpressions;
+#if NET8_0_OR_GREATER
+using System.Text.Json.Serialization.Metadata;
+#endif
 using Vista.SDK.Transport.Json.DataChannel;
 using Vista.SDK.Transport.Json.TimeSeriesData;
+using Domain = Vista.SDK.Transport;
 
 namespace Vista.SDK.Transport.Json;
 
@@ -16,48 +19,91 @@ public class DateTimeConverter : JsonConverter<DateTime>
     public override DateTime Read(ref Utf8JsonReader reader, Type typeToConvert, JsonSerializerOptions options)
     {
         Debug.Assert(typeToConvert == typeof(DateTime));
-        var value = reader.GetString() ?? string.Empty;
-
-        if (!DatetimeOffsetConverter.Iso8601StrictRegex.IsMatch(value))
-            throw new FormatException($"Invalid ISO 8601-1 format: '{value}'");
-
-        return DateTimeOffset.Parse(value, CultureInfo.InvariantCulture, DateTimeStyles.RoundtripKind).DateTime;
+        return Iso8601.Read(ref reader).DateTime;
     }
 
     public override void Write(Utf8JsonWriter writer, DateTime value, JsonSerializerOptions options)
     {
+#if NET8_0_OR_GREATER
+        Span<byte> buffer = stackalloc byte[MaxRoundtripLength];
+        if (value.TryFormat(buffer, out var written, "o", CultureInfo.InvariantCulture))
+        {
+            writer.WriteStringValue(buffer.Slice(0, written));
+            return;
+        }
+#endif
         writer.WriteStringValue(value.ToString("o", CultureInfo.InvariantCulture));
     }
+
+    // "o" formats to at most 33 characters, yyyy-MM-ddTHH:mm:ss.fffffff+HH:mm
+    internal const int MaxRoundtripLength = 33;
 }
 
 public class DatetimeOffsetConverter : JsonConverter<DateTimeOffset>
 {
-    internal static readonly Regex Iso8601StrictRegex = new Regex(
-        @"^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}(\.\d+)?(Z|[+-]\d{2}:\d{2})$",
-        RegexOptions.Compiled | RegexOptions.CultureInvariant
-    );
     public static readonly IFormatProvider Provider = DateTimeConverter.Provider;
     public static readonly DateTimeStyles Style = DateTimeConverter.Style;
 
     public override DateTimeOffset Read(ref Utf8JsonReader reader, Type typeToConvert, JsonSerializerOptions options)
     {
         Debug.Assert(typeToConvert == typeof(DateTimeOffset));
-        var value = reader.GetString() ?? string.Empty;
-
-        if (!Iso8601StrictRegex.IsMatch(value))
-            throw new FormatException($"Invalid ISO 8601-1 format: '{value}'");
-
-        return DateTimeOffset.Parse(value, CultureInfo.InvariantCulture, DateTimeStyles.RoundtripKind);
+        return Iso8601.Read(ref reader);
     }
 
     public override void Write(Utf8JsonWriter writer, DateTimeOffset value, JsonSerializerOptions options)
     {
+#if NET8_0_OR_GREATER
+        Span<byte> buffer = stackalloc byte[DateTimeConverter.MaxRoundtripLength];
+        if (value.TryFormat(buffer, out var written, "o", CultureInfo.InvariantCulture))
+        {
+            writer.WriteStringValue(buffer.Slice(0, written));
+            return;
+        }
+#endif
         writer.WriteStringValue(value.ToString("o", CultureInfo.InvariantCulture));
     }
 }
 
 public static class Serializer
 {
+#if NET8_0_OR_GREATER
+    /// <summary>
+    /// Options for the transport DTOs, resolving their metadata from the source-generated contexts.
+    /// Other types, like custom extension data values, fall back to reflection when it is enabled.
+    /// </summary>
+    public static readonly JsonSerializerOptions Options =
+        new()
+        {
+            DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull,
+            Converters = { new DateTimeConverter(), new DatetimeOffsetConverter() },
+            TypeInfoResolver = CreateTypeInfoResolver(),
+        };
+
+    private static IJsonTypeInfoResolver CreateTypeInfoResolver()
+    {
+        var resolvers = new List<IJsonTypeInfoResolver>
+        {
+            DataChannelListSerializerContext.Default,
+            TimeSeriesDataSerializerContext.Default,
+            Experimental.Transport.Json.DataList.DataListSerializerContext.Default,
+            Experimental.Transport.Json.TimeSeriesData.ExperimentalTimeSeriesDataSerializerContext.Default,
+        };
+        if (JsonSerializer.IsReflectionEnabledByDefault)
+            resolvers.Add(new DefaultJsonTypeInfoResolver());
+        return JsonTypeInfoResolver.Combine(resolvers.ToArray());
+    }
+
+    // Resolved on first use, which makes Options read-only like serializing with it does
+    private static JsonTypeInfo<DataChannelListPackage>? _dataChannelListInfo;
+    private static JsonTypeInfo<TimeSeriesDataPackage>? _timeSeriesDataInfo;
+
+    private static JsonTypeInfo<DataChannelListPackage> DataChannelListInfo =>
+        _dataChannelListInfo ??= (JsonTypeInfo<DataChannelListPackage>)
+            Options.GetTypeInfo(typeof(DataChannelListPackage));
+
+    private static JsonTypeInfo<TimeSeriesDataPackage> TimeSeriesDataInfo =>
+        _timeSeriesDataInfo ??= (JsonTypeInfo<TimeSeriesDataPackage>)Options.GetTypeInfo(typeof(TimeSeriesDataPackage));
+#else
     public static readonly JsonSerializerOptions Options =
         new()
         {
@@ -65,53 +111,94 @@ public static class Serializer
             Converters = { new DateTimeConverter(), new DatetimeOffsetConverter() }
         };
 
-    public static string Serialize(this DataChannelListPackage package) => JsonSerializer.Serialize(package, Options);
+    // System.Text.Json 6 can't compose resolvers or get type info from options, the DTOs use reflection
+    private static JsonSerializerOptions DataChannelListInfo => Options;
+    private static JsonSerializerOptions TimeSeriesDataInfo => Options;
+#endif
+
+    public static string Serialize(this DataChannelListPackage package) =>
+        JsonSerializer.Serialize(package, DataChannelListInfo);
 
     public static void Serialize(this DataChannelListPackage package, Stream stream) =>
-        JsonSerializer.Serialize(stream, package, Options);
+        JsonSerializer.Serialize(stream, package, DataChannelListInfo);
 
     public static Task SerializeAsync(
         this DataChannelListPackage package,
         Stream stream,
         CancellationToken cancellationToken = default
-    ) => JsonSerializer.SerializeAsync(stream, package, Options, cancellationToken);
+    ) => JsonSerializer.SerializeAsync(stream, package, DataChannelListInfo, cancellationToken);
 
-    public static string Serialize(this TimeSeriesDataPackage package) => JsonSerializer.Serialize(package, Options);
+    public static string Serialize(this TimeSeriesDataPackage package) =>
+        JsonSerializer.Serialize(package, TimeSeriesDataInfo);
 
     public static void Serialize(this TimeSeriesDataPackage package, Stream stream) =>
-        JsonSerializer.Serialize(stream, package, Options);
+        JsonSerializer.Serialize(stream, package, TimeSeriesDataInfo);
 
     public static Task SerializeAsync(
         this TimeSeriesDataPackage package,
         Stream stream,
         CancellationToken cancellationToken = default
-    ) => JsonSerializer.SerializeAsync(stream, package, Options, cancellationToken);
+    ) => JsonSerializer.SerializeAsync(stream, package, TimeSeriesDataInfo, cancellationToken);
 
     public static DataChannelListPackage? DeserializeDataChannelList(string packageJson) =>
-        JsonSerializer.Deserialize<DataChannelListPackage>(packageJson, Options);
+        JsonSerializer.Deserialize<DataChannelListPackage>(packageJson, DataChannelListInfo);
 
     public static DataChannelListPackage? DeserializeDataChannelList(ReadOnlySpan<char> packageJson) =>
-        JsonSerializer.Deserialize<DataChannelListPackage>(packageJson, Options);
+        JsonSerializer.Deserialize<DataChannelListPackage>(packageJson, DataChannelListInfo);
 
     public static ValueTask<DataChannelListPackage?> DeserializeDataChannelListAsync(
         Stream packageJsonStream,
         CancellationToken cancellationToken = default
-    ) => JsonSerializer.DeserializeAsync<DataChannelListPackage>(packageJsonStream, Options, cancellationToken);
+    ) =>
+        JsonSerializer.DeserializeAsync<DataChannelListPackage>(
+            packageJsonStream,
+            DataChannelListInfo,
+            cancellationToken
+        );
 
     public static DataChannelListPackage? DeserializeDataChannelList(Stream packageJsonStream) =>
-        JsonSerializer.Deserialize<DataChannelListPackage>(packageJsonStream, Options);
+        JsonSerializer.Deserialize<DataChannelListPackage>(packageJsonStream, DataChannelListInfo);
 
     public static TimeSeriesDataPackage? DeserializeTimeSeriesData(string packageJson) =>
-        JsonSerializer.Deserialize<TimeSeriesDataPackage>(packageJson, Options);
+        JsonSerializer.Deserialize<TimeSeriesDataPackage>(packageJson, TimeSeriesDataInfo);
 
     public static TimeSeriesDataPackage? DeserializeTimeSeriesData(ReadOnlySpan<char> packageJson) =>
-        JsonSerializer.Deserialize<TimeSeriesDataPackage>(packageJson, Options);
+        JsonSerializer.Deserialize<TimeSeriesDataPackage>(packageJson, TimeSeriesDataInfo);
 
     public static ValueTask<TimeSeriesDataPackage?> DeserializeTimeSeriesDataAsync(
         Stream packageJsonStream,
         CancellationToken cancellationToken = default
-    ) => JsonSerializer.DeserializeAsync<TimeSeriesDataPackage>(packageJsonStream, Options, cancellationToken);
+    ) =>
+        JsonSerializer.DeserializeAsync<TimeSeriesDataPackage>(
+            packageJsonStream,
+            TimeSeriesDataInfo,
+            cancellationToken
+        );
 
     public static TimeSeriesDataPackage? DeserializeTimeSeriesData(Stream packageJsonStream) =>
-        JsonSerializer.Deserialize<TimeSeriesDataPackage>(packageJsonStream, Options);
+        JsonSerializer.Deserialize<TimeSeriesDataPackage>(packageJsonStream, TimeSeriesDataInfo);
+
+    /// <summary>
+    /// Validates a TimeSeriesData package against <paramref name="dcPackage"/> while reading it from
+    /// <paramref name="packageJsonStream"/>, passing each tabular value and event to the callbacks as it is read.
+    /// Unlike deserializing and calling <see cref="Domain.TimeSeries.TimeSeriesData.Validate"/>,
+    /// memory use doesn't grow with the size of the package.
+    /// A <c>PipeReader</c> can be validated through <c>PipeReader.AsStream()</c>.
+    /// </summary>
+    /// <exception cref="JsonException">The package is not valid JSON or misses required values</exception>
+    public static ValidateResult ValidateTimeSeriesData(
+        Stream packageJsonStream,
+        Domain.DataChannel.DataChannelListPackage dcPackage,
+        Domain.TimeSeries.ValidateData onTabularData,
+        Domain.TimeSeries.ValidateData onEventData
+    ) => StreamingValidator.Validate(packageJsonStream, dcPackage, onTabularData, onEventData);
+
+    /// <inheritdoc cref="ValidateTimeSeriesData"/>
+    public static ValueTask<ValidateResult> ValidateTimeSeriesDataAsync(
+        Stream packageJsonStream,
+        Domain.DataChannel.DataChannelListPackage dcPackage,
+        Domain.TimeSeries.ValidateData onTabularData,
+        Domain.TimeSeries.ValidateData onEventData,
+        CancellationToken cancellationToken = default
+    ) => StreamingValidator.ValidateAsync(packageJsonStream, dcPackage, onTabularData, onEventData, cancellationToken);
 }
@@ -0,0 +1,44 @@
+using System.Text.Json.Serialization;
+
+namespace Vista.SDK.Transport.Json.TimeSeriesData;
+
+/// <summary>
+/// A table with its data sets encoded by <see cref="Vista.SDK.Transport.TimeSeries.TabularDataCodec"/>, as base64.
+/// Carried in the <see cref="PropertyName"/> extension field of <see cref="TimeSeriesData"/>,
+/// so readers unaware of the encoding still accept the package and see it as custom data.
+/// </summary>
+public sealed class EncodedTabularData
+{
+    public const string PropertyName = "EncodedTabularData";
+
+    [JsonConstructor]
+    public EncodedTabularData(
+        IReadOnlyList<string> @dataChannelID,
+        int @numberOfDataSet,
+        byte[] @data,
+        int? @index = null
+    )
+    {
+        this.DataChannelID = @dataChannelID;
+
+        this.NumberOfDataSet = @numberOfDataSet;
+
+        this.Data = @data;
+
+        this.Index = @index;
+    }
+
+    [JsonPropertyName("DataChannelID")]
+    public IReadOnlyList<string> DataChannelID { get; }
+
+    [JsonPropertyName("NumberOfDataSet")]
+    public int NumberOfDataSet { get; }
+
+    [JsonPropertyName("Data")]
+    public byte[] Data { get; }
+
+    /// <summary>Position among the tabular data of its time series data, tables without one go last</summary>
+    [JsonPropertyName("Index")]
+    [JsonIgnore(Condition = JsonIgnoreCondition.WhenWritingNull)]
+    public int? Index { get; }
+}
@@ -1,11 +1,23 @@
+using System.Text.Json;
+using Vista.SDK.Internal;
 using Domain = Vista.SDK.Transport.TimeSeries;
 
 namespace Vista.SDK.Transport.Json.TimeSeriesData;
 
 public static class Extensions
 {
-    public static TimeSeriesDataPackage ToJsonDto(this Domain.TimeSeriesDataPackage package)
+    public static TimeSeriesDataPackage ToJsonDto(this Domain.TimeSeriesDataPackage package) =>
+        package.ToJsonDto(encodeTabularData: false);
+
+    /// <param name="package">The package to map</param>
+    /// <param name="encodeTabularData">
+    /// Moves tables into the <see cref="EncodedTabularData.PropertyName"/> extension field of their time series data,
+    /// when <see cref="Domain.TabularDataCodec"/> can encode them.
+    /// <see cref="ToDomainModel"/> decodes them again, back in their position among the tables that were left as is.
+    /// </param>
+    public static TimeSeriesDataPackage ToJsonDto(this Domain.TimeSeriesDataPackage package, bool encodeTabularData)
     {
+        using var buffer = encodeTabularData ? new PooledBufferWriter() : null;
         var p = package.Package;
         var h = package.Package.Header;
         return new TimeSeriesDataPackage(
@@ -25,55 +37,79 @@ public static TimeSeriesDataPackage ToJsonDto(this Domain.TimeSeriesDataPackage
                     {
                         CustomHeaders = h.CustomHeaders?.CopyProperties()
                     },
-                p.TimeSeriesData
-                    .Select(
-                        t =>
-                            new TimeSeriesData(
-                                t.DataConfiguration is null
-                                    ? null
-                                    : new ConfigurationReference(t.DataConfiguration.Id, t.DataConfiguration.TimeStamp),
-                                t.EventData is null
-                                    ? null
-                                    : new EventData(
-                                        t.EventData
-                                            .DataSet
-                                            ?.Select(
-                                                d =>
-                                                    new DataSet_Event(
-                                                        d.DataChannelId.ToString(),
-                                                        d.Quality,
-                                                        d.TimeStamp,
-                                                        d.Value
-                                                    )
-                                            )
-                                            .ToList(),
-                                        t.EventData.NumberOfDataSet
-                                    ),
-                                t.TabularData
-                                    ?.Select(
-                                        d =>
-                                            new TabularData(
-                                                d.DataChannelIds?.Select(i => i.ToString()).ToList(),
-                                                d.DataSets
-                                                    ?.Select(
-                                                        td => new DataSet_Tabular(td.Quality, td.TimeStamp, td.Value)
-                                                    )
-                                                    .ToList(),
-                                                d.NumberOfDataChannels,
-                                                d.NumberOfDataSets
-                                            )
-                                    )
-                                    .ToList()
-                            )
-                            {
-                                CustomData = t.CustomDataKinds?.CopyProperties()
-                            }
-                    )
-                    .ToList()
+                p.TimeSeriesData.Select(t => ToJsonDto(t, buffer)).ToList()
             )
         );
     }
 
+    private static TimeSeriesData ToJsonDto(Domain.TimeSeriesData t, PooledBufferWriter? buffer)
+    {
+        List<TabularData>? tabularData = null;
+        List<EncodedTabularData>? encoded = null;
+        if (t.TabularData is not null)
+        {
+            tabularData = new(t.TabularData.Count);
+            for (var index = 0; index < t.TabularData.Count; index++)
+            {
+                var d = t.TabularData[index];
+                if (buffer is not null && TryEncode(d, buffer, index) is { } encodedTable)
+                {
+                    (encoded ??= new()).Add(encodedTable);
+                    continue;
+                }
+
+                tabularData.Add(
+                    new TabularData(
+                        d.DataChannelIds?.Select(i => i.ToString()).ToList(),
+                        d.DataSets?.Select(td => new DataSet_Tabular(td.Quality, td.TimeStamp, td.Value)).ToList(),
+                        d.NumberOfDataChannels,
+                        d.NumberOfDataSets
+                    )
+                );
+            }
+        }
+
+        var customData = t.CustomDataKinds?.CopyProperties();
+        if (encoded is not null)
+        {
+            customData ??= new Dictionary<string, object>();
+            customData[EncodedTabularData.PropertyName] = encoded;
+        }
+
+        return new TimeSeriesData(
+            t.DataConfiguration is null
+                ? null
+                : new ConfigurationReference(t.DataConfiguration.Id, t.DataConfiguration.TimeStamp),
+            t.EventData is null
+                ? null
+                : new EventData(
+                    t.EventData
+                        .DataSet
+                        ?.Select(d => new DataSet_Event(d.DataChannelId.ToString(), d.Quality, d.TimeStamp, d.Value))
+                        .ToList(),
+                    t.EventData.NumberOfDataSet
+                ),
+            tabularData is { Count: 0 } && encoded is not null ? null : tabularData
+        )
+        {
+            CustomData = customData
+        };
+    }
+
+    private static EncodedTabularData? TryEncode(Domain.TabularData table, PooledBufferWriter buffer, int index)
+    {
+        buffer.Clear();
+        if (table.DataChannelIds is null || table.DataSets is null || !Domain.TabularDataCodec.TryEncode(table, buffer))
+            return null;
+
+        return new EncodedTabularData(
+            table.DataChannelIds.Select(i => i.ToString()).ToList(),
+            table.DataSets.Count,
+            buffer.WrittenSpan.ToArray(),
+            index
+        );
+    }
+
     public static Domain.TimeSeriesDataPackage ToDomainModel(this TimeSeriesDataPackage package)
     {
         var p = package.Package;
@@ -110,36 +146,39 @@ public static Domain.TimeSeriesDataPackage ToDomainModel(this TimeSeriesDataPack
                                         Id = t.DataConfiguration.ID,
                                         TimeStamp = t.DataConfiguration.TimeStamp
                                     },
-                                TabularData = t.TabularData
-                                    ?.Select(td =>
-                                    {
-                                        if (td.NumberOfDataChannel != td.DataChannelID?.Count)
-                                            throw new ArgumentException(
-                                                "Number of data channels does not match the expected count"
-                                            );
-                                        if (td.NumberOfDataSet != td.DataSet?.Count)
-                                            throw new ArgumentException(
-                                                "Number of data sets does not match the expected count"
-                                            );
-                                        return new Domain.TabularData
+                                TabularData = WithDecodedTabularData(
+                                    t.TabularData
+                                        ?.Select(td =>
                                         {
-                                            DataChannelIds = td.DataChannelID
-                                                ?.Select(i => DataChannelId.Parse(i))
-                                                .ToList(),
-                                            DataSets = td.DataSet
-                                                ?.Select(
-                                                    tds =>
-                                                        new Domain.TabularDataSet
-                                                        {
-                                                            TimeStamp = tds.TimeStamp,
-                                                            Value = tds.Value.ToList(),
-                                                            Quality = tds.Quality?.ToList()
-                                                        }
-                                                )
-                                                .ToList()
-                                        };
-                                    })
-                                    .ToList(),
+                                            if (td.NumberOfDataChannel != td.DataChannelID?.Count)
+                                                throw new ArgumentException(
+                                                    "Number of data channels does not match the expected count"
+                                                );
+                                            if (td.NumberOfDataSet != td.DataSet?.Count)
+                                                throw new ArgumentException(
+                                                    "Number of data sets does not match the expected count"
+                                                );
+                                            return new Domain.TabularData
+                                            {
+                                                DataChannelIds = td.DataChannelID
+                                                    ?.Select(i => DataChannelId.Parse(i))
+                                                    .ToList(),
+                                                DataSets = td.DataSet
+                                                    ?.Select(
+                                                        tds =>
+                                                            new Domain.TabularDataSet
+                                                            {
+                                                                TimeStamp = tds.TimeStamp,
+                                                                Value = tds.Value.ToList(),
+                                                                Quality = tds.Quality?.ToList()
+                                                            }
+                                                    )
+                                                    .ToList()
+                                            };
+                                        })
+                                        .ToList(),
+                                    t.CustomData
+                                ),
                                 EventData = t.EventData is null
                                     ? null
                                     : new Domain.EventData
@@ -158,11 +197,73 @@ public static Domain.TimeSeriesDataPackage ToDomainModel(this TimeSeriesDataPack
                                             )
                                             .ToList()
                                     },
-                                CustomDataKinds = t.CustomData?.CopyProperties()
+                                CustomDataKinds = WithoutEncodedTabularData(t.CustomData)
                             }
                     )
                     .ToList()
             }
         };
     }
+
+    private static List<Domain.TabularData>? WithDecodedTabularData(
+        List<Domain.TabularData>? tabularData,
+        IDictionary<string, object>? customData
+    )
+    {
+        var encoded = GetEncodedTabularData(customData);
+        if (encoded is null)
+            return tabularData;
+
+        // The encoded tables go back to their positions, in between the ones that were left as is
+        var tables = new List<Domain.TabularData>((tabularData?.Count ?? 0) + encoded.Count);
+        var next = 0;
+        foreach (var table in encoded)
+        {
+            var index = table.Index ?? int.MaxValue;
+            if (index < tables.Count)
+                throw new ArgumentException($"Invalid {EncodedTabularData.PropertyName} index {index}");
+            while (tables.Count < index && tabularData is not null && next < tabularData.Count)
+                tables.Add(tabularData[next++]);
+
+            // Checked before decoding, so the counts of the header bound what is decoded
+            var (dataSetCount, dataChannelCount) = Domain.TabularDataCodec.ReadCounts(table.Data);
+            if (dataSetCount != table.NumberOfDataSet)
+                throw new ArgumentException("Number of data sets does not match the expected count");
+            if (dataSetCount > 0 && dataChannelCount != table.DataChannelID.Count)
+                throw new ArgumentException("Number of data channels does not match the expected count");
+            var dataSets = Domain.TabularDataCodec.Decode(table.Data);
+
+            tables.Add(
+                new Domain.TabularData
+                {
+                    DataChannelIds = table.DataChannelID.Select(i => DataChannelId.Parse(i)).ToList(),
+                    DataSets = dataSets
+                }
+            );
+        }
+        while (tabularData is not null && next < tabularData.Count)
+            tables.Add(tabularData[next++]);
+        return tables;
+    }
+
+    private static IReadOnlyList<EncodedTabularData>? GetEncodedTabularData(IDictionary<string, object>? customData)
+    {
+        if (customData is null || !customData.TryGetValue(EncodedTabularData.PropertyName, out var value))
+            return null;
+
+        return value switch
+        {
+            IReadOnlyList<EncodedTabularData> tables => tables,
+            JsonElement element => element.Deserialize(TimeSeriesDataSerializerContext.Default.ListEncodedTabularData),
+            _ => throw new ArgumentException($"Invalid {EncodedTabularData.PropertyName}"),
+        };
+    }
+
+    private static Dictionary<string, object>? WithoutEncodedTabularData(IDictionary<string, object>? customData)
+    {
+        var copy = customData?.CopyProperties();
+        if (copy is not null && copy.Remove(EncodedTabularData.PropertyName) && copy.Count == 0)
+            return null;
+        return copy;
+    }
 }
@@ -0,0 +1,723 @@
+using System.Buffers;
+using System.Text.Json;
+using DomainDataChannel = Vista.SDK.Transport.DataChannel.DataChannel;
+using DataChannelListPackage = Vista.SDK.Transport.DataChannel.DataChannelListPackage;
+using Domain = Vista.SDK.Transport.TimeSeries;
+using ValidateData = Vista.SDK.Transport.TimeSeries.ValidateData;
+using ValueValidator = Vista.SDK.Transport.DataChannel.ValueValidator;
+
+namespace Vista.SDK.Transport.Json.TimeSeriesData;
+
+/// <summary>
+/// Validates a TimeSeriesData JSON package token by token while it is read, with the same rules and callbacks
+/// as <see cref="Domain.TimeSeriesData.Validate"/>, but without materializing the package.
+/// Data channel IDs are parsed and looked up once per table header (and once per distinct event channel),
+/// and each row or event is passed to the callbacks as soon as it has been read,
+/// so memory use is bounded by the largest row instead of the size of the package.
+/// Only the first <see cref="MaxErrors"/> invalid values are reported, and a table can hold at most
+/// <see cref="MaxBufferedValues"/> values in data sets that come before its data channel IDs.
+/// Tables in the <see cref="EncodedTabularData.PropertyName"/> extension field are decoded one at a time
+/// and validated like the others.
+/// </summary>
+internal sealed class StreamingValidator
+{
+    private const int InitialBufferSize = 16 * 1024;
+    private const int MaxResolvedChannels = 4096;
+    private const int MaxErrors = 1000;
+    private const int MaxBufferedValues = 100_000;
+
+    private enum Frame : byte
+    {
+        Root,
+        Document,
+        Package,
+        TimeSeriesDataArray,
+        TimeSeriesData,
+        DataConfiguration,
+        TabularDataArray,
+        Table,
+        EncodedTabularDataArray,
+        EncodedTable,
+        ChannelIds,
+        Rows,
+        Row,
+        RowValues,
+        RowQuality,
+        EventData,
+        Events,
+        Event,
+    }
+
+    private enum Property : byte
+    {
+        Unknown,
+        Package,
+        TimeSeriesData,
+        DataConfiguration,
+        TabularData,
+        EncodedTabularData,
+        EventData,
+        Id,
+        NumberOfDataSet,
+        DataChannelId,
+        DataSet,
+        TimeStamp,
+        Value,
+        Quality,
+        Data,
+    }
+
+    private sealed record ResolvedChannel(
+        DataChannelId Id,
+        DomainDataChannel? DataChannel,
+        ValueValidator? Validator,
+        string? Error
+    );
+
+    private sealed class Row
+    {
+        public DateTimeOffset? TimeStamp;
+        public readonly List<string> Values = new();
+        public List<string>? Quality;
+    }
+
+    private readonly DataChannelListPackage _dcPackage;
+    private readonly ValidateData _onTabularData;
+    private readonly ValidateData _onEventData;
+
+    private readonly List<Frame> _frames = new() { Frame.Root };
+    private Property _property;
+    private int _skipDepth = -1;
+
+    private readonly Dictionary<string, ResolvedChannel> _resolved = new(StringComparer.Ordinal);
+    private readonly List<(DataChannelId DataChannelId, string Cause)> _errors = new();
+    private int _errorCount;
+    private ValidateResult? _result;
+
+    // Current TimeSeriesData
+    private int _tableCount;
+    private bool _hasEventData;
+    private bool _hasEventDataSet;
+    private int _eventCount;
+
+    // Current table
+    private readonly List<ResolvedChannel> _channels = new();
+    private bool _hasChannels;
+    private bool _channelsComplete;
+    private bool _hasRows;
+    private int? _expectedRowCount;
+    private int _rowCount;
+    private List<Row>? _bufferedRows;
+    private int _bufferedValues;
+    private byte[]? _encodedData;
+
+    // Current row or event
+    private Row _row = new();
+    private string? _eventChannelId;
+    private string? _eventValue;
+    private string? _eventQuality;
+    private DateTimeOffset? _eventTimeStamp;
+
+    private StreamingValidator(DataChannelListPackage dcPackage, ValidateData onTabularData, ValidateData onEventData)
+    {
+        _dcPackage = dcPackage;
+        _onTabularData = onTabularData;
+        _onEventData = onEventData;
+    }
+
+    public static ValidateResult Validate(
+        Stream stream,
+        DataChannelListPackage dcPackage,
+        ValidateData onTabularData,
+        ValidateData onEventData
+    )
+    {
+        var validator = new StreamingValidator(dcPackage, onTabularData, onEventData);
+        var buffer = new ReadBuffer(InitialBufferSize);
+        try
+        {
+            while (true)
+            {
+                buffer.Fill(stream.Read(buffer.Array, buffer.Length, buffer.Array.Length - buffer.Length));
+                if (!validator.Process(ref buffer))
+                    return validator.Complete();
+            }
+        }
+        finally
+        {
+            buffer.Return();
+        }
+    }
+
+    public static async ValueTask<ValidateResult> ValidateAsync(
+        Stream stream,
+        DataChannelListPackage dcPackage,
+        ValidateData onTabularData,
+        ValidateData onEventData,
+        CancellationToken cancellationToken
+    )
+    {
+        var validator = new StreamingValidator(dcPackage, onTabularData, onEventData);
+        var buffer = new ReadBuffer(InitialBufferSize);
+        try
+        {
+            while (true)
+            {
+                var read = await stream
+                    .ReadAsync(buffer.Array, buffer.Length, buffer.Array.Length - buffer.Length, cancellationToken)
+                    .ConfigureAwait(false);
+                buffer.Fill(read);
+                if (!validator.Process(ref buffer))
+                    return validator.Complete();
+            }
+        }
+        finally
+        {
+            buffer.Return();
+        }
+    }
+
+    /// <summary>Unconsumed bytes of the stream, in a pooled array that grows when a single token doesn't fit</summary>
+    private struct ReadBuffer
+    {
+        public byte[] Array;
+        public int Length;
+        public bool IsFinalBlock;
+        public bool IsStart;
+        public JsonReaderState State;
+
+        public ReadBuffer(int size)
+        {
+            Array = ArrayPool<byte>.Shared.Rent(size);
+            Length = 0;
+            IsFinalBlock = false;
+            IsStart = true;
+            State = new JsonReaderState();
+        }
+
+        public void Fill(int read)
+        {
+            if (read == 0)
+                IsFinalBlock = true;
+            Length += read;
+        }
+
+        public void Consume(int consumed)
+        {
+            if (consumed > 0)
+            {
+                Buffer.BlockCopy(Array, consumed, Array, 0, Length - consumed);
+                Length -= consumed;
+            }
+            else if (Length == Array.Length)
+            {
+                var larger = ArrayPool<byte>.Shared.Rent(Array.Length * 2);
+                Buffer.BlockCopy(Array, 0, larger, 0, Length);
+                ArrayPool<byte>.Shared.Return(Array);
+                Array = larger;
+            }
+        }
+
+        public void Return() => ArrayPool<byte>.Shared.Return(Array);
+    }
+
+    /// <returns>False when the package has been read completely or validation stopped early</returns>
+    private bool Process(ref ReadBuffer buffer)
+    {
+        var offset = 0;
+        if (buffer.IsStart)
+        {
+            // Stream deserialization skips the UTF-8 BOM, so do we
+            if (buffer.Length < 3 && !buffer.IsFinalBlock)
+                return true;
+            buffer.IsStart = false;
+            if (buffer.Array.AsSpan(0, buffer.Length).StartsWith(Utf8Bom))
+                offset = Utf8Bom.Length;
+        }
+
+        var reader = new Utf8JsonReader(
+            buffer.Array.AsSpan(offset, buffer.Length - offset),
+            buffer.IsFinalBlock,
+            buffer.State
+        );
+        while (reader.Read())
+        {
+            Handle(ref reader);
+            if (_result is not null)
+                return false;
+        }
+
+        if (buffer.IsFinalBlock)
+            return false;
+
+        buffer.State = reader.CurrentState;
+        buffer.Consume(offset + (int)reader.BytesConsumed);
+        return true;
+    }
+
+    private static ReadOnlySpan<byte> Utf8Bom => [0xEF, 0xBB, 0xBF];
+
+    private ValidateResult Complete()
+    {
+        if (_result is not null)
+            return _result;
+        if (_frames.Count != 1)
+            throw new JsonException("Unexpected end of TimeSeriesData package");
+
+        if (_errors.Count > 0)
+        {
+            var messages = _errors.Select(x => $"DataChannel {x.DataChannelId} is invalid: {x.Cause}");
+            if (_errorCount > _errors.Count)
+                messages = messages.Append($"{_errorCount - _errors.Count} more invalid values are not reported");
+            return new ValidateResult.Invalid(messages.ToArray());
+        }
+
+        return new ValidateResult.Ok();
+    }
+
+    private Frame Current => _frames[_frames.Count - 1];
+
+    private void Handle(ref Utf8JsonReader reader)
+    {
+        if (_skipDepth != -1)
+        {
+            if (
+                reader.TokenType is JsonTokenType.EndObject or JsonTokenType.EndArray
+                && reader.CurrentDepth == _skipDepth
+            )
+                _skipDepth = -1;
+            return;
+        }
+
+        switch (reader.TokenType)
+        {
+            case JsonTokenType.PropertyName:
+                _property = ReadProperty(ref reader);
+                break;
+            case JsonTokenType.StartObject:
+                StartObject(ref reader);
+                break;
+            case JsonTokenType.StartArray:
+                StartArray(ref reader);
+                break;
+            case JsonTokenType.EndObject:
+            case JsonTokenType.EndArray:
+                End();
+                break;
+            case JsonTokenType.String:
+                ReadString(ref reader);
+                break;
+            case JsonTokenType.Number:
+                // The counts of plain tables aren't checked, since the domain model derives them from the contents,
+                // but encoded tables are decoded from their NumberOfDataSet
+                if (Current == Frame.EncodedTable && _property == Property.NumberOfDataSet)
+                    _expectedRowCount = reader.GetInt32();
+                break;
+        }
+    }
+
+    private static Property ReadProperty(ref Utf8JsonReader reader)
+    {
+        if (reader.ValueTextEquals("Package"u8))
+            return Property.Package;
+        if (reader.ValueTextEquals("TimeSeriesData"u8))
+            return Property.TimeSeriesData;
+        if (reader.ValueTextEquals("DataConfiguration"u8))
+            return Property.DataConfiguration;
+        if (reader.ValueTextEquals("TabularData"u8))
+            return Property.TabularData;
+        if (reader.ValueTextEquals("EncodedTabularData"u8))
+            return Property.EncodedTabularData;
+        if (reader.ValueTextEquals("EventData"u8))
+            return Property.EventData;
+        if (reader.ValueTextEquals("ID"u8))
+            return Property.Id;
+        if (reader.ValueTextEquals("NumberOfDataSet"u8))
+            return Property.NumberOfDataSet;
+        if (reader.ValueTextEquals("DataChannelID"u8))
+            return Property.DataChannelId;
+        if (reader.ValueTextEquals("DataSet"u8))
+            return Property.DataSet;
+        if (reader.ValueTextEquals("TimeStamp"u8))
+            return Property.TimeStamp;
+        if (reader.ValueTextEquals("Value"u8))
+            return Property.Value;
+        if (reader.ValueTextEquals("Quality"u8))
+            return Property.Quality;
+        if (reader.ValueTextEquals("Data"u8))
+            return Property.Data;
+        return Property.Unknown;
+    }
+
+    private void StartObject(ref Utf8JsonReader reader)
+    {
+        Frame? frame = (Current, _property) switch
+        {
+            (Frame.Root, _) => Frame.Document,
+            (Frame.Document, Property.Package) => Frame.Package,
+            (Frame.TimeSeriesDataArray, _) => Frame.TimeSeriesData,
+            (Frame.TimeSeriesData, Property.DataConfiguration) => Frame.DataConfiguration,
+            (Frame.TimeSeriesData, Property.EventData) => Frame.EventData,
+            (Frame.TabularDataArray, _) => Frame.Table,
+            (Frame.EncodedTabularDataArray, _) => Frame.EncodedTable,
+            (Frame.Rows, _) => Frame.Row,
+            (Frame.Events, _) => Frame.Event,
+            _ => null,
+        };
+
+        if (frame is null)
+        {
+            // Header, custom data and other parts that don't take part in validation
+            _skipDepth = reader.CurrentDepth;
+            return;
+        }
+
+        switch (frame.Value)
+        {
+            case Frame.TimeSeriesData:
+                _tableCount = 0;
+                _hasEventData = false;
+                _hasEventDataSet = false;
+                _eventCount = 0;
+                break;
+            case Frame.EventData:
+                _hasEventData = true;
+                break;
+            case Frame.Table:
+            case Frame.EncodedTable:
+                _tableCount++;
+                _channels.Clear();
+                _hasChannels = false;
+                _channelsComplete = false;
+                _hasRows = false;
+                _expectedRowCount = null;
+                _rowCount = 0;
+                _bufferedRows = null;
+                _bufferedValues = 0;
+                _encodedData = null;
+                break;
+            case Frame.Row:
+                _row = _bufferedRows is null ? ResetRow(_row) : new Row();
+                break;
+            case Frame.Event:
+                _eventChannelId = null;
+                _eventValue = null;
+                _eventQuality = null;
+                _eventTimeStamp = null;
+                break;
+        }
+
+        _frames.Add(frame.Value);
+        _property = Property.Unknown;
+
+        static Row ResetRow(Row row)
+        {
+            row.TimeStamp = null;
+            row.Values.Clear();
+            row.Quality?.Clear();
+            return row;
+        }
+    }
+
+    private void StartArray(ref Utf8JsonReader reader)
+    {
+        Frame? frame = (Current, _property) switch
+        {
+            (Frame.Package, Property.TimeSeriesData) => Frame.TimeSeriesDataArray,
+            (Frame.TimeSeriesData, Property.TabularData) => Frame.TabularDataArray,
+            (Frame.TimeSeriesData, Property.EncodedTabularData) => Frame.EncodedTabularDataArray,
+            (Frame.Table or Frame.EncodedTable, Property.DataChannelId) => Frame.ChannelIds,
+            (Frame.Table, Property.DataSet) => Frame.Rows,
+            (Frame.Row, Property.Value) => Frame.RowValues,
+            (Frame.Row, Property.Quality) => Frame.RowQuality,
+            (Frame.EventData, Property.DataSet) => Frame.Events,
+            _ => null,
+        };
+
+        if (frame is null)
+        {
+            _skipDepth = reader.CurrentDepth;
+            return;
+        }
+
+        switch (frame.Value)
+        {
+            case Frame.ChannelIds:
+                _hasChannels = true;
+                break;
+            case Frame.Rows:
+                _hasRows = true;
+                // Rows can only be validated as they are read once the data channels of the table are known
+                if (_channelsComplete)
+                    ValidateTableHeader();
+                else
+                    _bufferedRows = new List<Row>();
+                break;
+            case Frame.RowQuality:
+                _row.Quality ??= new List<string>();
+                break;
+            case Frame.Events:
+                _hasEventDataSet = true;
+                break;
+        }
+
+        _frames.Add(frame.Value);
+    }
+
+    private void ReadString(ref Utf8JsonReader reader)
+    {
+        switch (Current)
+        {
+            case Frame.DataConfiguration when _property == Property.Id:
+                if (_dcPackage.Package.Header.DataChannelListId.Id != reader.GetString())
+                    _result = new ValidateResult.Invalid(["DataConfiguration Id does not match DataChannelList Id"]);
+                break;
+            case Frame.ChannelIds:
+                _channels.Add(Resolve(reader.GetString()!));
+                break;
+            case Frame.EncodedTable when _property == Property.Data:
+                if (!reader.TryGetBytesFromBase64(out _encodedData))
+                    throw new JsonException($"Invalid Data in {EncodedTabularData.PropertyName}");
+                break;
+            case Frame.Row when _property == Property.TimeStamp:
+                _row.TimeStamp = Iso8601.Read(ref reader);
+                break;
+            case Frame.RowValues:
+                _row.Values.Add(reader.GetString()!);
+                break;
+            case Frame.RowQuality:
+                _row.Quality!.Add(reader.GetString()!);
+                break;
+            case Frame.Event:
+                switch (_property)
+                {
+                    case Property.TimeStamp:
+                        _eventTimeStamp = Iso8601.Read(ref reader);
+                        break;
+                    case Property.DataChannelId:
+                        _eventChannelId = reader.GetString();
+                        break;
+                    case Property.Value:
+                        _eventValue = reader.GetString();
+                        break;
+                    case Property.Quality:
+                        _eventQuality = reader.GetString();
+                        break;
+                }
+                break;
+        }
+    }
+
+    private void End()
+    {
+        var frame = Current;
+        _frames.RemoveAt(_frames.Count - 1);
+        _property = Property.Unknown;
+
+        switch (frame)
+        {
+            case Frame.ChannelIds:
+                _channelsComplete = true;
+                break;
+            case Frame.Row:
+                if (_row.TimeStamp is null)
+                    throw new JsonException("Missing TimeStamp in tabular data set");
+                if (_bufferedRows is not null)
+                    BufferRow(_row);
+                else
+                    ValidateRow(_row);
+                break;
+            case Frame.Table:
+                EndTable();
+                break;
+            case Frame.EncodedTable:
+                EndEncodedTable();
+                break;
+            case Frame.Event:
+                _eventCount++;
+                ValidateEvent();
+                break;
+            case Frame.TimeSeriesData:
+                if (_tableCount == 0 && (!_hasEventData || (_hasEventDataSet && _eventCount == 0)))
+                    _result = new ValidateResult.Invalid(["Can't ingest timeseries data without data"]);
+                break;
+        }
+    }
+
+    private void BufferRow(Row row)
+    {
+        // Counting the row itself as well, so rows without values are bounded too
+        _bufferedValues += row.Values.Count + 1;
+        if (_bufferedValues > MaxBufferedValues)
+        {
+            _result = new ValidateResult.Invalid(
+                [$"Tabular data has more than {MaxBufferedValues} values before its DataChannelID"]
+            );
+            return;
+        }
+        _bufferedRows!.Add(row);
+    }
+
+    private void EndTable()
+    {
+        // Like the domain model, tables without data sets or data channels are ignored
+        if (!_hasRows || !_hasChannels)
+            return;
+
+        if (_bufferedRows is not null)
+        {
+            ValidateTableHeader();
+            foreach (var row in _bufferedRows)
+            {
+                if (_result is not null)
+                    return;
+                ValidateRow(row);
+            }
+        }
+        if (_result is not null)
+            return;
+
+        if (_rowCount == 0)
+            _result = new ValidateResult.Invalid(["Tabular data has no data"]);
+    }
+
+    private void EndEncodedTable()
+    {
+        if (!_hasChannels || _expectedRowCount is null || _encodedData is null)
+            throw new JsonException(
+                $"Missing DataChannelID, NumberOfDataSet or Data in {EncodedTabularData.PropertyName}"
+            );
+
+        List<Domain.TabularDataSet> dataSets;
+        try
+        {
+            // Like the domain model, the counts are checked before anything is decoded
+            var (rowCount, channelCount) = Domain.TabularDataCodec.ReadCounts(_encodedData);
+            if (rowCount != _expectedRowCount)
+            {
+                _result = new ValidateResult.Invalid(
+                    [$"Tabular data has {_expectedRowCount} data sets, but {rowCount} data sets are provided"]
+                );
+                return;
+            }
+            if (rowCount > 0 && channelCount != _channels.Count)
+            {
+                _result = new ValidateResult.Invalid(
+                    [
+                        $"Tabular data has {_channels.Count} data channels, but {channelCount} data channels are provided"
+                    ]
+                );
+                return;
+            }
+            dataSets = Domain.TabularDataCodec.Decode(_encodedData);
+        }
+        catch (Exception ex) when (ex is InvalidDataException or EndOfStreamException)
+        {
+            _result = new ValidateResult.Invalid([$"Invalid {EncodedTabularData.PropertyName}: {ex.Message}"]);
+            return;
+        }
+
+        // The decoded data sets take the same path as data sets that come before their data channel IDs
+        _hasRows = true;
+        _bufferedRows = new List<Row>(dataSets.Count);
+        foreach (var dataSet in dataSets)
+        {
+            var row = new Row { TimeStamp = dataSet.TimeStamp, Quality = dataSet.Quality };
+            row.Values.AddRange(dataSet.Value);
+            _bufferedRows.Add(row);
+        }
+        EndTable();
+    }
+
+    private void ValidateTableHeader()
+    {
+        if (_channels.Count == 0)
+            _result = new ValidateResult.Invalid(["Tabular data has no data channels"]);
+    }
+
+    private void ValidateRow(Row row)
+    {
+        if (_result is not null)
+            return;
+
+        var index = _rowCount++;
+        if (row.Values.Count != _channels.Count)
+        {
+            _result = new ValidateResult.Invalid(
+                [
+                    $"Tabular data set {index} expects {_channels.Count} values, but {row.Values.Count} values are provided"
+                ]
+            );
+            return;
+        }
+
+        for (var j = 0; j < _channels.Count; j++)
+        {
+            var channel = _channels[j];
+            var quality = row.Quality is not null && j < row.Quality.Count ? row.Quality[j] : null;
+            Validate(channel, row.TimeStamp!.Value, row.Values[j], quality, _onTabularData);
+        }
+    }
+
+    private void ValidateEvent()
+    {
+        if (_eventChannelId is null || _eventValue is null || _eventTimeStamp is null)
+            throw new JsonException("Missing TimeStamp, DataChannelID or Value in event data set");
+
+        Validate(Resolve(_eventChannelId), _eventTimeStamp.Value, _eventValue, _eventQuality, _onEventData);
+    }
+
+    private void Validate(
+        ResolvedChannel channel,
+        DateTimeOffset timeStamp,
+        string value,
+        string? quality,
+        ValidateData callback
+    )
+    {
+        if (channel.DataChannel is null)
+        {
+            if (CountError())
+                _errors.Add((channel.Id, channel.Error!));
+            return;
+        }
+
+        var typeValidation = channel.Validator!.Validate(value, out var parsedValue);
+        if (typeValidation is ValidateResult.Invalid invalid)
+        {
+            if (CountError())
+                _errors.Add((channel.Id, string.Join(", ", invalid.Messages)));
+            return;
+        }
+
+        var result = callback(timeStamp, channel.DataChannel, parsedValue!, quality);
+        if (result is not ValidateResult.Ok && CountError())
+            _errors.Add((channel.Id, result.ToString()));
+    }
+
+    /// <returns>Whether the error is one of the first <see cref="MaxErrors"/>, which are reported</returns>
+    private bool CountError() => ++_errorCount <= MaxErrors;
+
+    private ResolvedChannel Resolve(string dataChannelId)
+    {
+        if (_resolved.TryGetValue(dataChannelId, out var resolved))
+            return resolved;
+
+        var id = DataChannelId.Parse(dataChannelId);
+        var dataChannelList = _dcPackage.Package.DataChannelList;
+        resolved = id.Match(
+            onLocalId: localId =>
+                dataChannelList.TryGetByLocalId(localId, out var dc) && dc is not null
+                    ? new ResolvedChannel(id, dc, dataChannelList.GetValidator(dc), null)
+                    : new ResolvedChannel(id, null, null, $"Data channel with localId '{localId}' not found"),
+            onShortId: shortId =>
+                dataChannelList.TryGetByShortId(shortId, out var dc) && dc is not null
+                    ? new ResolvedChannel(id, dc, dataChannelList.GetValidator(dc), null)
+                    : new ResolvedChannel(id, null, null, $"Data channel with short id '{shortId}' not found")
+        );
+
+        if (_resolved.Count < MaxResolvedChannels)
+            _resolved.Add(dataChannelId, resolved);
+        return resolved;
+    }
+}
@@ -0,0 +1,30 @@
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using Vista.SDK.Transport.Json;
+
+namespace Vista.SDK.Transport.Json.TimeSeriesData;
+
+/// <summary>
+/// Source-generated metadata for the TimeSeriesData DTOs, resolved through <see cref="Serializer.Options"/>
+/// and usable directly for trimmed or NativeAOT applications.
+/// The extension data types cover the values deserialization produces, the JSON primitives
+/// and <see cref="EncodedTabularData"/>.
+/// </summary>
+#if NET8_0_OR_GREATER
+[JsonSourceGenerationOptions(
+    DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull,
+    Converters = new[] { typeof(DateTimeConverter), typeof(DatetimeOffsetConverter) }
+)]
+#else
+// System.Text.Json 6 has no converters in the generation options, construct the context with a copy of Serializer.Options
+[JsonSourceGenerationOptions(DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull)]
+#endif
+[JsonSerializable(typeof(TimeSeriesDataPackage))]
+[JsonSerializable(typeof(List<EncodedTabularData>))]
+[JsonSerializable(typeof(JsonElement))]
+[JsonSerializable(typeof(string))]
+[JsonSerializable(typeof(bool))]
+[JsonSerializable(typeof(long))]
+[JsonSerializable(typeof(double))]
+[JsonSerializable(typeof(decimal))]
+public sealed partial class TimeSeriesDataSerializerContext : JsonSerializerContext { }
@@ -1,11 +1,13 @@
 using System.Collections;
+using System.Diagnostics.CodeAnalysis;
+using Vista.SDK.Internal;
 
 namespace Vista.SDK;
 
 public sealed record class Codebook
 {
     public CodebookName Name { get; private init; }
-    private readonly Dictionary<string, string> _groupMap;
+    private readonly ChdDictionary<string, ChdStringHasher> _groupMap;
     private readonly CodebookStandardValues _standardValues;
     private readonly CodebookGroups _groups;
 
@@ -29,8 +31,6 @@ internal Codebook(CodebookDto dto)
             _ => throw new ArgumentException("Unknown metadata tag: " + dto.Name, nameof(dto.Name)),
         };
 
-        _groupMap = new();
-
         var data = dto.Values
             .SelectMany(kvp => kvp.Value.Select(v => (Group: kvp.Key.Trim(), Value: v.Trim())))
             .Where(v => v.Value != "<number>")
@@ -38,13 +38,14 @@ internal Codebook(CodebookDto dto)
 
         RawData = dto.Values.ToDictionary(kvp => kvp.Key, kvp => (IReadOnlyList<string>)kvp.Value.ToArray());
 
+        // The last group listed for a value wins
+        var groupMap = new Dictionary<string, string>();
         foreach (var t in data)
-            _groupMap[t.Value] = t.Group;
+            groupMap[t.Value] = t.Group;
+        _groupMap = new ChdDictionary<string, ChdStringHasher>(groupMap.Select(kvp => (kvp.Key, kvp.Value)).ToArray());
 
-        var valueSet = new HashSet<string>(data.Select(t => t.Value));
-        var groupSet = new HashSet<string>(data.Select(t => t.Group));
-        _standardValues = new CodebookStandardValues(Name, valueSet);
-        _groups = new CodebookGroups(groupSet);
+        _standardValues = new CodebookStandardValues(Name, new ChdSet(data.Select(t => t.Value)));
+        _groups = new CodebookGroups(new ChdSet(data.Select(t => t.Group)));
     }
 
     public CodebookGroups Groups => _groups;
@@ -53,33 +54,48 @@ internal Codebook(CodebookDto dto)
 
     public bool HasGroup(string group) => _groups.Contains(group);
 
+    public bool HasGroup(ReadOnlySpan<char> group) => _groups.Contains(group);
+
     public bool HasStandardValue(string value) => _standardValues.Contains(value);
 
-    public MetadataTag? TryCreateTag(string? value)
+    public bool HasStandardValue(ReadOnlySpan<char> value) => _standardValues.Contains(value);
+
+    public MetadataTag? TryCreateTag(string? value) => TryCreateTag(value.AsSpan(), value);
+
+    /// <summary>
+    /// Like <see cref="TryCreateTag(string?)"/>, standard values reuse the codebook's string
+    /// so only custom values are copied out of <paramref name="value"/>
+    /// </summary>
+    public MetadataTag? TryCreateTag(ReadOnlySpan<char> value) => TryCreateTag(value, null);
+
+    private MetadataTag? TryCreateTag(ReadOnlySpan<char> value, string? valueString)
     {
-        if (value is null || string.IsNullOrWhiteSpace(value))
+        // Whitespace is rejected by the ISO string check below
+        if (value.IsEmpty)
             return null;
 
         var isCustom = false;
+        string? tagValue;
 
         if (Name == CodebookName.Position)
         {
-            var positionValidity = ValidatePosition(value);
+            var positionValidity = ValidatePosition(value, valueString);
             if ((int)positionValidity < 100)
                 return null;
 
             if (positionValidity == PositionValidationResult.Custom)
                 isCustom = true;
+            _standardValues.TryGetValue(value, out tagValue);
         }
         else
         {
             if (!VIS.IsISOString(value))
                 return null;
-            if (Name != CodebookName.Detail && !StandardValues.Contains(value))
+            if (!_standardValues.TryGetValue(value, out tagValue) && Name != CodebookName.Detail)
                 isCustom = true;
         }
 
-        return new MetadataTag(Name, value, isCustom);
+        return new MetadataTag(Name, tagValue ?? valueString ?? value.ToString(), isCustom);
     }
 
     public MetadataTag CreateTag(string value)
@@ -91,23 +107,30 @@ public MetadataTag CreateTag(string value)
         return tag.Value;
     }
 
-    public PositionValidationResult ValidatePosition(string position)
-    {
-        if (string.IsNullOrWhiteSpace(position) || !VIS.IsISOString(position))
-            return PositionValidationResult.Invalid;
+    public PositionValidationResult ValidatePosition(string position) => ValidatePosition(position.AsSpan(), position);
 
-        if (position.Trim().Length != position.Length)
+    public PositionValidationResult ValidatePosition(ReadOnlySpan<char> position) => ValidatePosition(position, null);
+
+    private PositionValidationResult ValidatePosition(ReadOnlySpan<char> position, string? positionString)
+    {
+        // Whitespace is rejected by the ISO string check
+        if (position.IsEmpty || !VIS.IsISOString(position))
             return PositionValidationResult.Invalid;
 
-        if (StandardValues.Contains(position))
+        if (_standardValues.Contains(position))
             return PositionValidationResult.Valid;
 
-        if (int.TryParse(position, out _))
+        if (CodebookStandardValues.IsInteger(position))
             return PositionValidationResult.Valid;
 
-        if (!position.Contains('-'))
+        if (position.IndexOf('-') == -1)
             return PositionValidationResult.Custom;
 
+        return ValidateCompositePosition(positionString ?? position.ToString());
+    }
+
+    private PositionValidationResult ValidateCompositePosition(string position)
+    {
         var positions = position.Split('-');
         var validations = new List<PositionValidationResult>();
         foreach (var positionStr in positions)
@@ -131,7 +154,7 @@ public PositionValidationResult ValidatePosition(string position)
 
         if (validations.All(v => (int)v == (int)PositionValidationResult.Valid))
         {
-            var groups = positions.Select(p => int.TryParse(p, out _) ? "<number>" : _groupMap[p]).ToArray();
+            var groups = positions.Select(p => int.TryParse(p, out _) ? "<number>" : _groupMap[p.AsSpan()]).ToArray();
 
             var groupsSet = new HashSet<string>(groups);
             if (!groups.Contains("DEFAULT_GROUP") && groupsSet.Count != groups.Length)
@@ -169,24 +192,38 @@ public enum PositionValidationResult
 public sealed class CodebookStandardValues : IEnumerable<string>
 {
     private readonly CodebookName _name;
-    private readonly HashSet<string> _standardValues;
+    private readonly ChdSet _standardValues;
 
     public int Count => _standardValues.Count;
 
-    internal CodebookStandardValues(CodebookName name, HashSet<string> standardValues)
+    internal CodebookStandardValues(CodebookName name, ChdSet standardValues)
     {
         _name = name;
         _standardValues = standardValues;
     }
 
-    public bool Contains(string tagValue)
+    public bool Contains(string tagValue) => Contains(tagValue.AsSpan());
+
+    public bool Contains(ReadOnlySpan<char> tagValue)
     {
-        if (_name == CodebookName.Position && int.TryParse(tagValue, out _))
+        if (_name == CodebookName.Position && IsInteger(tagValue))
             return true;
 
         return _standardValues.Contains(tagValue);
     }
 
+    internal bool TryGetValue(ReadOnlySpan<char> tagValue, [NotNullWhen(true)] out string? value) =>
+        _standardValues.TryGetValue(tagValue, out value);
+
+    internal static bool IsInteger(ReadOnlySpan<char> value)
+    {
+#if NET8_0_OR_GREATER
+        return int.TryParse(value, out _);
+#else
+        return int.TryParse(value.ToString(), out _);
+#endif
+    }
+
     public Enumerator GetEnumerator() => new Enumerator(this);
 
     IEnumerator<string> IEnumerable<string>.GetEnumerator() => new Enumerator(this);
@@ -195,37 +232,41 @@ public bool Contains(string tagValue)
 
     public struct Enumerator : IEnumerator<string>
     {
-        private HashSet<string>.Enumerator _inner;
+        private readonly string[] _items;
+        private int _index;
 
         public Enumerator(CodebookStandardValues parent)
         {
-            _inner = parent._standardValues.GetEnumerator();
+            _items = parent._standardValues.Items;
+            _index = -1;
         }
 
-        public string Current => _inner.Current;
+        public string Current => _items[_index];
 
         object IEnumerator.Current => Current;
 
-        public void Dispose() => _inner.Dispose();
+        public void Dispose() { }
 
-        public bool MoveNext() => _inner.MoveNext();
+        public bool MoveNext() => ++_index < _items.Length;
 
-        public void Reset() { }
+        public void Reset() => _index = -1;
     }
 }
 
 public sealed class CodebookGroups : IEnumerable<string>
 {
-    private readonly HashSet<string> _groups;
+    private readonly ChdSet _groups;
 
-    internal CodebookGroups(HashSet<string> groups)
+    internal CodebookGroups(ChdSet groups)
     {
         _groups = groups;
     }
 
     public int Count => _groups.Count;
 
-    public bool Contains(string group) => _groups.Contains(group);
+    public bool Contains(string group) => _groups.Contains(group.AsSpan());
+
+    public bool Contains(ReadOnlySpan<char> group) => _groups.Contains(group);
 
     public Enumerator GetEnumerator() => new Enumerator(this);
 
@@ -235,21 +276,23 @@ internal CodebookGroups(HashSet<string> groups)
 
     public struct Enumerator : IEnumerator<string>
     {
-        private HashSet<string>.Enumerator _inner;
+        private readonly string[] _items;
+        private int _index;
 
         public Enumerator(CodebookGroups parent)
         {
-            _inner = parent._groups.GetEnumerator();
+            _items = parent._groups.Items;
+            _index = -1;
         }
 
-        public string Current => _inner.Current;
+        public string Current => _items[_index];
 
         object IEnumerator.Current => Current;
 
-        public void Dispose() => _inner.Dispose();
+        public void Dispose() { }
 
-        public bool MoveNext() => _inner.MoveNext();
+        public bool MoveNext() => ++_index < _items.Length;
 
-        public void Reset() { }
+        public void Reset() => _index = -1;
     }
 }
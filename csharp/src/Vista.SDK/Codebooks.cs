@@ -40,6 +40,8 @@ internal Codebooks(VisVersion version, CodebooksDto dto)
 
     public MetadataTag? TryCreateTag(CodebookName name, string? value) => this[name].TryCreateTag(value);
 
+    public MetadataTag? TryCreateTag(CodebookName name, ReadOnlySpan<char> value) => this[name].TryCreateTag(value);
+
     public MetadataTag CreateTag(CodebookName name, string value) => this[name].CreateTag(value);
 
     public Codebook GetCodebook(CodebookName name) => this[name];
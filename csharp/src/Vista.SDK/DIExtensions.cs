@@ -10,4 +10,16 @@ public static IServiceCollection AddVIS(this IServiceCollection services)
         services.AddSingleton<IVIS>(VIS.Instance);
         return services;
     }
+
+    /// <summary>
+    /// Configures <see cref="VIS.Instance"/>, which is also used internally when parsing paths and local IDs,
+    /// and registers it
+    /// </summary>
+    public static IServiceCollection AddVIS(this IServiceCollection services, Action<VisOptions> configure)
+    {
+        var options = new VisOptions();
+        configure(options);
+        VIS.Instance.Configure(options);
+        return services.AddVIS();
+    }
 }
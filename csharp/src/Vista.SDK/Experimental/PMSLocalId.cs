@@ -1,3 +1,4 @@
+using System.Diagnostics.CodeAnalysis;
 using Vista.SDK.Internal;
 
 namespace Vista.SDK.Experimental;
@@ -65,6 +66,28 @@ public static bool TryParse(string localIdStr, out ParsingErrors errors, out PMS
         return true;
     }
 
+    /// <inheritdoc cref="PMSLocalIdBuilder.TryParse(ReadOnlySpan{char}, out PMSLocalIdBuilder)"/>
+    public static bool TryParse(ReadOnlySpan<char> localIdStr, [NotNullWhen(true)] out PMSLocalId? localId)
+    {
+        // Parsing accepts IDs without an activity type, which can't be built
+        localId =
+            PMSLocalIdBuilder.TryParse(localIdStr, out var localIdBuilder) && localIdBuilder.IsValid
+                ? localIdBuilder.Build()
+                : null;
+        return localId is not null;
+    }
+
+    /// <inheritdoc cref="PMSLocalIdBuilder.TryParse(ReadOnlySpan{char}, out PMSLocalIdBuilder)"/>
+    public static bool TryParse(ReadOnlySpan<byte> utf8, [NotNullWhen(true)] out PMSLocalId? localId)
+    {
+        // Parsing accepts IDs without an activity type, which can't be built
+        localId =
+            PMSLocalIdBuilder.TryParse(utf8, out var localIdBuilder) && localIdBuilder.IsValid
+                ? localIdBuilder.Build()
+                : null;
+        return localId is not null;
+    }
+
     public sealed override bool Equals(object? obj) => Equals(obj as PMSLocalId);
 
     public bool Equals(PMSLocalId? other)
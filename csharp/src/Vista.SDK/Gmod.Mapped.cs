@@ -0,0 +1,60 @@
+using System.Diagnostics.CodeAnalysis;
+using System.Runtime.CompilerServices;
+using Vista.SDK.Internal;
+
+namespace Vista.SDK;
+
+public sealed partial class Gmod
+{
+    private static readonly IReadOnlyDictionary<string, string> EmptyNormalAssignmentNames =
+        new Dictionary<string, string>(0);
+
+    private static GmodNodeMetadata ReadMetadata(GmodStore store, in GmodSnapshotNode nodeData)
+    {
+        var normalAssignmentNames = EmptyNormalAssignmentNames;
+        if (nodeData.NormalAssignmentNamesCount > 0)
+        {
+            var names = new Dictionary<string, string>(nodeData.NormalAssignmentNamesCount);
+            for (int i = 0; i < nodeData.NormalAssignmentNamesCount; i++)
+            {
+                var (key, value) = store.GetNormalAssignmentName(nodeData.NormalAssignmentNamesOffset + i);
+                names.Add(key, value);
+            }
+            normalAssignmentNames = names;
+        }
+
+        return new GmodNodeMetadata(
+            store.GetString(nodeData.Category)!,
+            store.GetString(nodeData.Type)!,
+            store.GetString(nodeData.Name)!,
+            store.GetString(nodeData.CommonName),
+            store.GetString(nodeData.Definition),
+            store.GetString(nodeData.CommonDefinition),
+            nodeData.GetInstallSubstructure(),
+            normalAssignmentNames
+        );
+    }
+
+    private bool TryGetMappedNode(ReadOnlySpan<char> code, [MaybeNullWhen(false)] out GmodNode node)
+    {
+        if (!_store!.TryGetNodeIndex(code, out var index))
+        {
+            node = null;
+            return false;
+        }
+
+        node = GetNodeAt(index);
+        return true;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private GmodNode MaterializeNode(int index)
+    {
+        var store = _store!;
+        ref readonly var nodeData = ref store.GetNode(index);
+        var node = new GmodNode(this, index, store.GetString(nodeData.Code)!, ReadMetadata(store, in nodeData));
+
+        // Concurrent readers may race to materialize the same node, all of them observe the first one published
+        return Interlocked.CompareExchange(ref _nodes[index], node, null) ?? node;
+    }
+}
@@ -0,0 +1,215 @@
+using System.Collections.Concurrent;
+using System.Runtime.ExceptionServices;
+
+namespace Vista.SDK;
+
+public sealed record ParallelTraversalOptions : TraversalOptions
+{
+    /// <summary>The maximum number of workers traversing concurrently</summary>
+    /// <remarks>The default value is <see cref="Environment.ProcessorCount"/>.</remarks>
+    public int MaxDegreeOfParallelism { get; set; } = Environment.ProcessorCount;
+
+    /// <summary>Subtrees are only split off for other workers up to this depth below the root of the traversal</summary>
+    public int MaxSplitDepth { get; set; } = 16;
+}
+
+public sealed partial class Gmod
+{
+    /// <summary>
+    /// Traverses the Gmod like <see cref="Traverse{TState}(TState, TraverseHandlerWithState{TState}, TraversalOptions?)"/>,
+    /// but visits subtrees concurrently on multiple workers.
+    /// Each worker gets its own state from <paramref name="stateFactory"/> and its own parents list,
+    /// so the handler can accumulate results without locks and the caller merges the returned <paramref name="states"/>.
+    /// Nodes are visited in no particular order across workers, but every node sees the same parents as with
+    /// <c>Traverse</c>. <see cref="TraversalHandlerResult.SkipSubtree"/> skips the subtree of the node,
+    /// <see cref="TraversalHandlerResult.Stop"/> stops all workers as soon as they observe it.
+    /// </summary>
+    /// <returns>False if the traversal was stopped</returns>
+    public bool TraverseParallel<TState>(
+        Func<TState> stateFactory,
+        TraverseHandlerWithState<TState> handler,
+        out IReadOnlyList<TState> states,
+        ParallelTraversalOptions? options = null
+    ) => TraverseParallel(_rootNode, stateFactory, handler, out states, options);
+
+    /// <inheritdoc cref="TraverseParallel{TState}(Func{TState}, TraverseHandlerWithState{TState}, out IReadOnlyList{TState}, ParallelTraversalOptions?)"/>
+    public bool TraverseParallel<TState>(
+        GmodNode rootNode,
+        Func<TState> stateFactory,
+        TraverseHandlerWithState<TState> handler,
+        out IReadOnlyList<TState> states,
+        ParallelTraversalOptions? options = null
+    )
+    {
+        if (!ReferenceEquals(rootNode._gmod, this))
+            return rootNode._gmod.TraverseParallel(rootNode, stateFactory, handler, out states, options);
+
+        var opts = options ?? new ParallelTraversalOptions();
+        if (opts.MaxDegreeOfParallelism < 1)
+            throw new ArgumentOutOfRangeException(nameof(options), "MaxDegreeOfParallelism must be at least 1");
+
+        var work = new ParallelTraversalWork(opts.MaxDegreeOfParallelism, opts.MaxSplitDepth);
+        work.Add(Array.Empty<GmodNode>(), rootNode);
+
+        var workerStates = new ConcurrentQueue<TState>();
+        var parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = opts.MaxDegreeOfParallelism };
+        Parallel.For(
+            0,
+            opts.MaxDegreeOfParallelism,
+            parallelOptions,
+            _ =>
+            {
+                try
+                {
+                    if (!work.TryTake(out var item))
+                        return;
+
+                    var state = stateFactory();
+                    workerStates.Enqueue(state);
+
+                    var context = new TraversalContext<ParallelHandler<TState>>
+                    {
+                        Parents = new Parents(_graph.NodeCount),
+                        Handler = new ParallelHandler<TState>(state, handler, work),
+                        MaxTraversalOccurrence = opts.MaxTraversalOccurrence,
+                        Work = work,
+                    };
+                    try
+                    {
+                        do
+                        {
+                            try
+                            {
+                                foreach (var parent in item.Parents)
+                                    context.Parents.Push(parent, parent._handle);
+                                TraverseNode(ref context, item.Node, item.Node._handle);
+                            }
+                            finally
+                            {
+                                context.Parents.Clear();
+                                work.Complete();
+                            }
+                        } while (work.TryTake(out item));
+                    }
+                    finally
+                    {
+                        context.Parents.Release();
+                    }
+                }
+                catch (Exception ex)
+                {
+                    work.Fail(ex);
+                }
+            }
+        );
+
+        work.Exception?.Throw();
+
+        states = workerStates.ToArray();
+        return !work.Stopped;
+    }
+
+    private readonly struct ParallelHandler<TState> : ITraversalHandler
+    {
+        private readonly TState _state;
+        private readonly TraverseHandlerWithState<TState> _handler;
+        private readonly ParallelTraversalWork _work;
+
+        public ParallelHandler(TState state, TraverseHandlerWithState<TState> handler, ParallelTraversalWork work)
+        {
+            _state = state;
+            _handler = handler;
+            _work = work;
+        }
+
+        public TraversalHandlerResult Handle(IReadOnlyList<GmodNode> parents, GmodNode node, int handle)
+        {
+            if (_work.Stopped)
+                return TraversalHandlerResult.Stop;
+
+            var result = _handler(_state, parents, node);
+            if (result == TraversalHandlerResult.Stop)
+                _work.Stop();
+            return result;
+        }
+    }
+
+    /// <summary>
+    /// Pending subtrees of a parallel traversal. Workers take from a ConcurrentBag, which prefers the subtrees the
+    /// worker split off itself and otherwise steals from other workers. A worker only splits the children of a node
+    /// off into separate items while other workers are idle, so the partitioning adapts to how unbalanced the tree is.
+    /// </summary>
+    internal sealed class ParallelTraversalWork
+    {
+        private readonly ConcurrentBag<(GmodNode[] Parents, GmodNode Node)> _items = new();
+        private readonly int _workers;
+        private readonly int _maxSplitDepth;
+
+        // Items in the bag, and items in the bag or being traversed
+        private int _queued;
+        private int _pending;
+        private volatile bool _stopped;
+        private ExceptionDispatchInfo? _exception;
+
+        public ParallelTraversalWork(int workers, int maxSplitDepth)
+        {
+            _workers = workers;
+            _maxSplitDepth = maxSplitDepth;
+        }
+
+        public bool Stopped => _stopped;
+
+        public ExceptionDispatchInfo? Exception => _exception;
+
+        public void Stop() => _stopped = true;
+
+        public void Fail(Exception ex)
+        {
+            Interlocked.CompareExchange(ref _exception, ExceptionDispatchInfo.Capture(ex), null);
+            _stopped = true;
+        }
+
+        public void Add(GmodNode[] parents, GmodNode node)
+        {
+            Interlocked.Increment(ref _pending);
+            Interlocked.Increment(ref _queued);
+            _items.Add((parents, node));
+        }
+
+        /// <summary>Hands the children of the last of <paramref name="parents"/> to other workers if any are idle</summary>
+        public bool TrySplit(IReadOnlyList<GmodNode> parents, ReadOnlySpan<int> children)
+        {
+            if (children.Length < 2 || parents.Count > _maxSplitDepth || _stopped)
+                return false;
+            if (Volatile.Read(ref _queued) >= _workers)
+                return false;
+
+            var gmod = parents[parents.Count - 1]._gmod;
+            var prefix = parents.ToArray();
+            for (int i = children.Length - 1; i >= 0; i--)
+                Add(prefix, gmod.GetNodeAt(children[i]));
+            return true;
+        }
+
+        public bool TryTake(out (GmodNode[] Parents, GmodNode Node) item)
+        {
+            var spinner = new SpinWait();
+            while (true)
+            {
+                if (_items.TryTake(out item))
+                {
+                    Interlocked.Decrement(ref _queued);
+                    return true;
+                }
+
+                // Items still being traversed may be split into more work
+                if (Volatile.Read(ref _pending) == 0)
+                    return false;
+
+                spinner.SpinOnce();
+            }
+        }
+
+        public void Complete() => Interlocked.Decrement(ref _pending);
+    }
+}
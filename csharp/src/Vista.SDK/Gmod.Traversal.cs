@@ -24,6 +24,15 @@ public record TraversalOptions()
     public int MaxTraversalOccurrence { get; set; } = DEFAULT_MAX_TRAVERSAL_OCCURRENCE;
 }
 
+/// <summary>
+/// Handler for the internal traversal, implemented by structs so that calls are devirtualized.
+/// The handle is the node's handle in the traversed Gmod's <see cref="Internal.GmodGraph"/>.
+/// </summary>
+internal interface ITraversalHandler
+{
+    TraversalHandlerResult Handle(IReadOnlyList<GmodNode> parents, GmodNode node, int handle);
+}
+
 public sealed partial class Gmod
 {
     public bool Traverse(TraverseHandler handler, TraversalOptions? options = null) =>
@@ -43,45 +52,77 @@ public sealed partial class Gmod
         GmodNode rootNode,
         TraverseHandlerWithState<TState> handler,
         TraversalOptions? options = null
-    )
+    ) => Traverse(rootNode, new StateHandler<TState>(state, handler), options);
+
+    internal bool Traverse<THandler>(GmodNode rootNode, THandler handler, TraversalOptions? options = null)
+        where THandler : struct, ITraversalHandler
     {
+        // Handles are only meaningful within the Gmod that owns the node
+        if (!ReferenceEquals(rootNode._gmod, this))
+            return rootNode._gmod.Traverse(rootNode, handler, options);
+
         var opts = options ?? new TraversalOptions();
-        var context = new TraversalContext<TState>(new Parents(), handler, state, opts.MaxTraversalOccurrence);
-        return TraverseNode(in context, rootNode) == TraversalHandlerResult.Continue;
+        var context = new TraversalContext<THandler>
+        {
+            Parents = new Parents(_graph.NodeCount),
+            Handler = handler,
+            MaxTraversalOccurrence = opts.MaxTraversalOccurrence,
+        };
+        try
+        {
+            return TraverseNode(ref context, rootNode, rootNode._handle) == TraversalHandlerResult.Continue;
+        }
+        finally
+        {
+            context.Parents.Release();
+        }
     }
 
-    private TraversalHandlerResult TraverseNode<TState>(in TraversalContext<TState> context, GmodNode node)
+    private TraversalHandlerResult TraverseNode<THandler>(
+        ref TraversalContext<THandler> context,
+        GmodNode node,
+        int handle
+    )
+        where THandler : struct, ITraversalHandler
     {
         // note: installSubstructure doesn't work - martinothamar
         // if (node.Metadata.InstallSubstructure == false)
         //     return TraversalHandlerResult.Continue;
-        var result = context.Handler(context.State, context.Parents.AsList, node);
+        var result = context.Handler.Handle(context.Parents.AsList, node, handle);
         if (result is TraversalHandlerResult.Stop or TraversalHandlerResult.SkipSubtree)
             return result;
 
-        var skipOccurenceCheck = IsProductSelectionAssignment(context.Parents.LastOrDefault(), node);
+        var parent = context.Parents.LastOrDefault();
+        var skipOccurenceCheck = parent is not null && _graph.IsProductSelectionAssignment(parent._handle, handle);
         // Skip the occurence check for "hidden" nodes such as selections, etc.
         if (!skipOccurenceCheck)
         {
-            var occ = context.Parents.Occurrences(node);
+            var occ = context.Parents.Occurrences(handle);
             if (occ == context.MaxTraversalOccurrence)
                 return TraversalHandlerResult.SkipSubtree;
             if (occ > context.MaxTraversalOccurrence)
                 throw new Exception("Invalid state - node occured more than expected");
         }
-        context.Parents.Push(node);
+        context.Parents.Push(node, handle);
 
-        for (int i = 0; i < node.Children.Count; i++)
+        var children = _graph.GetChildren(handle);
+        if (context.Work is not null && context.Work.TrySplit(context.Parents.AsList, children))
         {
-            var child = node.Children[i];
-            result = TraverseNode(in context, child);
+            context.Parents.Pop(handle);
+            return TraversalHandlerResult.Continue;
+        }
+
+        for (int i = 0; i < children.Length; i++)
+        {
+            var child = children[i];
+            result = TraverseNode(ref context, GetNodeAt(child), child);
             if (result is TraversalHandlerResult.Stop)
                 return result;
             else if (result is TraversalHandlerResult.SkipSubtree)
                 continue;
         }
 
-        context.Parents.Pop();
+        context.Parents.Pop(handle);
         return TraversalHandlerResult.Continue;
     }
 
@@ -95,108 +136,156 @@ private TraversalHandlerResult TraverseNode<TState>(in TraversalContext<TState>
         remainingParents =  [];
 
         var state = new PathExistsContext(to) { RemainingParents = remainingParents, FromPath =  [.. fromPath] };
+        var start = lastAssetFunction ?? RootNode;
+        if (!start._gmod.TryGetHandle(to.Code.AsSpan(), out var toHandle))
+            return false;
 
-        var reachedEnd = Traverse(
-            state,
-            lastAssetFunction ?? RootNode,
-            (state, parents, node) =>
-            {
-                if (node.Code != state.To.Code)
-                    return TraversalHandlerResult.Continue;
-                List<GmodNode>? actualParents = null;
-                while (!parents[0].IsRoot)
-                {
-                    if (actualParents is null)
-                    {
-                        actualParents =  [.. parents];
-                        parents = actualParents;
-                    }
+        var reachedEnd = Traverse(start, new PathExistsHandler(state, toHandle));
 
-                    var parent = parents[0];
-                    if (parent.Parents.Count != 1)
-                        throw new Exception("Invalid state - expected one parent");
+        remainingParents = state.RemainingParents;
 
-                    actualParents.Insert(0, parent.Parents[0]);
-                }
+        return !reachedEnd;
+    }
 
-                // Validate parents
-                if (parents.Count < state.FromPath.Count)
-                    return TraversalHandlerResult.Continue;
-                // Must have same start order
-                var match = true;
-                for (int i = 0; i < state.FromPath.Count; i++)
-                {
-                    if (parents[i].Code != state.FromPath[i].Code)
-                    {
-                        match = false;
-                        break;
-                    }
-                }
+    record PathExistsContext(GmodNode To)
+    {
+        public IEnumerable<GmodNode> RemainingParents = Enumerable.Empty<GmodNode>();
+        public required IReadOnlyList<GmodNode> FromPath { get; init; }
+    }
+
+    private readonly struct PathExistsHandler : ITraversalHandler
+    {
+        private readonly PathExistsContext _state;
+        private readonly int _to;
+
+        public PathExistsHandler(PathExistsContext state, int to)
+        {
+            _state = state;
+            _to = to;
+        }
 
-                if (match)
+        public TraversalHandlerResult Handle(IReadOnlyList<GmodNode> parents, GmodNode node, int handle)
+        {
+            if (handle != _to)
+                return TraversalHandlerResult.Continue;
+            List<GmodNode>? actualParents = null;
+            while (!parents[0].IsRoot)
+            {
+                if (actualParents is null)
                 {
-                    state.RemainingParents = parents.Where(p => !state.FromPath.Any(pp => pp.Code == p.Code)).ToArray();
-                    return TraversalHandlerResult.Stop;
+                    actualParents =  [.. parents];
+                    parents = actualParents;
                 }
 
+                var parent = parents[0];
+                if (parent.Parents.Count != 1)
+                    throw new Exception("Invalid state - expected one parent");
+
+                actualParents.Insert(0, parent.Parents[0]);
+            }
+
+            var state = _state;
+            // Validate parents
+            if (parents.Count < state.FromPath.Count)
                 return TraversalHandlerResult.Continue;
+            // Must have same start order
+            var match = true;
+            for (int i = 0; i < state.FromPath.Count; i++)
+            {
+                if (parents[i].Code != state.FromPath[i].Code)
+                {
+                    match = false;
+                    break;
+                }
             }
-        );
 
-        remainingParents = state.RemainingParents;
+            if (match)
+            {
+                state.RemainingParents = parents.Where(p => !state.FromPath.Any(pp => pp.Code == p.Code)).ToArray();
+                return TraversalHandlerResult.Stop;
+            }
 
-        return !reachedEnd;
+            return TraversalHandlerResult.Continue;
+        }
     }
 
-    record PathExistsContext(GmodNode To)
+    private readonly struct StateHandler<TState> : ITraversalHandler
     {
-        public IEnumerable<GmodNode> RemainingParents = Enumerable.Empty<GmodNode>();
-        public required IReadOnlyList<GmodNode> FromPath { get; init; }
+        private readonly TState _state;
+        private readonly TraverseHandlerWithState<TState> _handler;
+
+        public StateHandler(TState state, TraverseHandlerWithState<TState> handler)
+        {
+            _state = state;
+            _handler = handler;
+        }
+
+        public TraversalHandlerResult Handle(IReadOnlyList<GmodNode> parents, GmodNode node, int handle) =>
+            _handler(_state, parents, node);
     }
 
-    private readonly record struct TraversalContext<TState>(
-        Parents Parents,
-        TraverseHandlerWithState<TState> Handler,
-        TState State,
-        int MaxTraversalOccurrence
-    );
+    private struct TraversalContext<THandler>
+        where THandler : struct, ITraversalHandler
+    {
+        public Parents Parents;
+        public THandler Handler;
+        public int MaxTraversalOccurrence;
+
+        /// <summary>Set for parallel traversals, see Gmod.Traversal.Parallel.cs</summary>
+        public ParallelTraversalWork? Work;
+    }
 
     private readonly struct Parents
     {
-        private readonly Dictionary<string, int> _occurrences = new(4);
+        // Occurrence counts per node handle, only nonzero for nodes currently in _parents.
+        // The array is reused by the next traversal on the same thread once those entries are reset
+        [ThreadStatic]
+        private static int[]? _cachedOccurrences;
+
+        private readonly int[] _occurrences;
         private readonly List<GmodNode> _parents = new(64);
 
-        public Parents() { }
+        public Parents(int nodeCount)
+        {
+            var occurrences = _cachedOccurrences;
+            _cachedOccurrences = null;
+            _occurrences =
+                occurrences is not null && occurrences.Length >= nodeCount ? occurrences : new int[nodeCount];
+        }
 
-        public readonly void Push(GmodNode parent)
+        public readonly void Push(GmodNode parent, int handle)
         {
             _parents.Add(parent);
-            if (_occurrences.ContainsKey(parent.Code))
-                _occurrences[parent.Code]++;
-            else
-                _occurrences.Add(parent.Code, 1);
+            _occurrences[handle]++;
         }
 
-        public readonly void Pop()
+        public readonly void Pop(int handle)
         {
-            var parent = _parents[_parents.Count - 1];
             _parents.RemoveAt(_parents.Count - 1);
-
-            if (_occurrences.TryGetValue(parent.Code, out var occ))
-            {
-                if (occ == 1)
-                    _occurrences.Remove(parent.Code);
-                else
-                    _occurrences[parent.Code]--;
-            }
+            _occurrences[handle]--;
         }
 
-        public readonly int Occurrences(GmodNode node) => _occurrences.TryGetValue(node.Code, out var occ) ? occ : 0;
+        public readonly int Occurrences(int handle) => _occurrences[handle];
 
         public readonly GmodNode? LastOrDefault() => _parents.Count > 0 ? _parents[_parents.Count - 1] : null;
 
         public readonly IReadOnlyList<GmodNode> ToList() => _parents.ToList();
 
         public readonly IReadOnlyList<GmodNode> AsList => _parents;
+
+        public readonly int Count => _parents.Count;
+
+        public readonly void Clear()
+        {
+            for (int i = 0; i < _parents.Count; i++)
+                _occurrences[_parents[i]._handle] = 0;
+            _parents.Clear();
+        }
+
+        public readonly void Release()
+        {
+            Clear();
+            _cachedOccurrences = _occurrences;
+        }
     }
 }
@@ -15,7 +15,19 @@ public sealed partial class Gmod : IEnumerable<GmodNode>
 
     private readonly GmodNode _rootNode;
 
-    private readonly ChdDictionary<GmodNode> _nodeMap;
+    private readonly ChdDictionary<GmodNode>? _nodeMap;
+
+    // Nodes by handle, see GmodGraph for the adjacency
+    private readonly GmodNode?[] _nodes;
+    private readonly GmodGraph _graph;
+
+    // Individualized nodes, shared by the paths and nodes that use the same location.
+    // Direct mapped like LocalIdInternTable, so the cache doesn't grow with the locations that are seen
+    private const int LocatedNodeSlots = 1024;
+    private readonly GmodNode?[] _locatedNodes = new GmodNode?[LocatedNodeSlots];
+
+    // Set when the Gmod reads from a memory mapped GmodStore instead of owning its nodes, see Gmod.Mapped.cs
+    private readonly GmodStore? _store;
 
     public GmodNode RootNode => _rootNode;
 
@@ -94,56 +106,147 @@ internal Gmod(VisVersion version, GmodDto dto)
     {
         VisVersion = version;
 
-        var nodeMap = new Dictionary<string, GmodNode>(dto.Items.Length);
-
-        foreach (var nodeDto in dto.Items)
+        var handles = new Dictionary<string, int>(dto.Items.Length);
+        var nodes = new GmodNode[dto.Items.Length];
+        var metadata = new GmodNodeMetadata[dto.Items.Length];
+        for (int i = 0; i < dto.Items.Length; i++)
         {
-            var node = new GmodNode(VisVersion, nodeDto);
-            nodeMap.Add(nodeDto.Code, node);
+            var nodeDto = dto.Items[i];
+            metadata[i] = new GmodNodeMetadata(
+                nodeDto.Category,
+                nodeDto.Type,
+                nodeDto.Name,
+                nodeDto.CommonName,
+                nodeDto.Definition,
+                nodeDto.CommonDefinition,
+                nodeDto.InstallSubstructure,
+                nodeDto.NormalAssignmentNames ?? EmptyNormalAssignmentNames
+            );
+            nodes[i] = new GmodNode(this, i, nodeDto.Code, metadata[i]);
+            handles.Add(nodeDto.Code, i);
         }
 
-        foreach (var relation in dto.Relations)
+        var relations = new (int Parent, int Child)[dto.Relations.Length];
+        for (int i = 0; i < dto.Relations.Length; i++)
+            relations[i] = (handles[dto.Relations[i][0]], handles[dto.Relations[i][1]]);
+
+        _nodes = nodes;
+        _graph = GmodGraph.Create(metadata, relations);
+        _nodeMap = new ChdDictionary<GmodNode>(nodes.Select(n => (n.Code, n)).ToArray());
+        _rootNode = _nodeMap["VE".AsSpan()];
+    }
+
+    /// <summary>
+    /// Reads a Gmod from <paramref name="store"/>.
+    /// By default all nodes are copied onto the managed heap and the store can be disposed afterwards,
+    /// if <paramref name="mapped"/> is set nodes are materialized on first access and lookups, children and parents
+    /// are read from the store which is kept alive for the lifetime of the Gmod.
+    /// </summary>
+    internal Gmod(VisVersion version, GmodStore store, bool mapped = false)
+    {
+        VisVersion = version;
+        _graph = GmodGraph.Create(store, inPlace: mapped);
+
+        if (mapped)
         {
-            var parentCode = relation[0];
-            var childCode = relation[1];
+            _store = store;
+            _nodes = new GmodNode?[store.NodeCount];
+            if (!store.TryGetNodeIndex("VE".AsSpan(), out var root))
+                throw new InvalidDataException("Gmod snapshot has no root node");
+            _rootNode = GetNodeAt(root);
+            return;
+        }
 
-            var parentNode = nodeMap[parentCode];
-            var childNode = nodeMap[childCode];
+        var nodes = new GmodNode[store.NodeCount];
+        for (int i = 0; i < nodes.Length; i++)
+        {
+            ref readonly var nodeData = ref store.GetNode(i);
+            nodes[i] = new GmodNode(this, i, store.GetString(nodeData.Code)!, ReadMetadata(store, in nodeData));
+        }
+        _nodes = nodes;
 
-            parentNode.AddChild(childNode);
-            childNode.AddParent(parentNode);
+        if (store.HasUsableLookupTable)
+        {
+            var chdTable = store.ChdTable;
+            var table = new (string Key, GmodNode Value)[chdTable.Length];
+            for (int i = 0; i < table.Length; i++)
+            {
+                var index = chdTable[i];
+                if (index >= 0)
+                    table[i] = (nodes[index].Code, nodes[index]);
+            }
+            _nodeMap = new ChdDictionary<GmodNode>(table, store.ChdSeeds.ToArray());
         }
+        else
+        {
+            _nodeMap = new ChdDictionary<GmodNode>(nodes.Select(n => (n.Code, n)).ToArray());
+        }
+
+        _rootNode = _nodeMap["VE".AsSpan()];
+    }
 
-        foreach (var node in nodeMap.Values)
-            node.Trim();
+    internal GmodGraph Graph => _graph;
 
-        _rootNode = nodeMap["VE"];
-        _nodeMap = new ChdDictionary<GmodNode>(nodeMap.Select(kvp => (kvp.Key, kvp.Value)).ToArray());
+    /// <summary>Gets the node with handle <paramref name="handle"/>, materializing it first if the Gmod is mapped</summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    internal GmodNode GetNodeAt(int handle) => _nodes[handle] ?? MaterializeNode(handle);
+
+    /// <summary>Gets the node with handle <paramref name="handle"/> individualized by <paramref name="location"/></summary>
+    internal GmodNode GetNodeAt(int handle, in Location location)
+    {
+        var slot = HashCode.Combine(handle, location) & (LocatedNodeSlots - 1);
+        var node = Volatile.Read(ref _locatedNodes[slot]);
+        if (node is not null && node._handle == handle && node.Location == location)
+            return node;
+
+        // A colliding location replaces the previous node, which its paths keep using
+        node = GetNodeAt(handle) with { Location = location };
+        Volatile.Write(ref _locatedNodes[slot], node);
+        return node;
     }
 
-    internal Gmod(VisVersion version, IReadOnlyDictionary<string, GmodNode> nodeMap)
+    internal bool TryGetHandle(ReadOnlySpan<char> code, out int handle)
     {
-        VisVersion = version;
-        foreach (var node in nodeMap.Values)
-            node.Trim();
+        if (_nodeMap is null)
+            return _store!.TryGetNodeIndex(code, out handle);
+
+        if (_nodeMap.TryGetValue(code, out var node))
+        {
+            handle = node._handle;
+            return true;
+        }
 
-        _rootNode = nodeMap["VE"];
-        _nodeMap = new ChdDictionary<GmodNode>(nodeMap.Select(kvp => (kvp.Key, kvp.Value)).ToArray());
+        handle = -1;
+        return false;
     }
 
-    public GmodNode this[string key] => _nodeMap[key.AsSpan()];
+    public GmodNode this[string key]
+    {
+        get
+        {
+            if (_nodeMap is not null)
+                return _nodeMap[key.AsSpan()];
+
+            if (!TryGetMappedNode(key.AsSpan(), out var node))
+                ChdDictionary<GmodNode>.ThrowHelper.ThrowKeyNotFoundException(key.AsSpan());
+            return node;
+        }
+    }
 
     public bool TryGetNode(string code, [MaybeNullWhen(false)] out GmodNode node) =>
-        _nodeMap.TryGetValue(code.AsSpan(), out node);
+        TryGetNode(code.AsSpan(), out node);
 
     public bool TryGetNode(ReadOnlySpan<char> code, [MaybeNullWhen(false)] out GmodNode node) =>
-        _nodeMap.TryGetValue(code, out node);
+        _nodeMap is not null ? _nodeMap.TryGetValue(code, out node) : TryGetMappedNode(code, out node);
 
     public GmodPath ParsePath(string item) => GmodPath.Parse(item, VisVersion);
 
     public bool TryParsePath(string item, [NotNullWhen(true)] out GmodPath? path) =>
         GmodPath.TryParse(item, VisVersion, out path);
 
+    /// <inheritdoc cref="GmodPath.ParsePaths(ReadOnlySpan{string}, VisVersion)"/>
+    public GmodPath[] ParsePaths(ReadOnlySpan<string> items) => GmodPath.ParsePaths(items, VisVersion);
+
     public GmodPath ParseFromFullPath(string item) => GmodPath.ParseFullPath(item, VisVersion);
 
     public bool TryParseFromFullPath(string item, [NotNullWhen(true)] out GmodPath? path) =>
@@ -151,6 +254,9 @@ internal Gmod(VisVersion version, IReadOnlyDictionary<string, GmodNode> nodeMap)
 
     public Enumerator GetEnumerator()
     {
+        if (_nodeMap is null)
+            return new Enumerator(this);
+
         var enumerator = new Enumerator { Inner = _nodeMap.GetEnumerator() };
         return enumerator;
     }
@@ -159,18 +265,86 @@ public Enumerator GetEnumerator()
 
     IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
 
+    /// <summary>Children or parents of a node, read from the <see cref="GmodGraph"/> on every access</summary>
+    internal sealed class NodeList : IReadOnlyList<GmodNode>
+    {
+        private readonly Gmod _gmod;
+        private readonly int _node;
+        private readonly bool _parents;
+
+        public NodeList(Gmod gmod, int node, bool parents)
+        {
+            _gmod = gmod;
+            _node = node;
+            _parents = parents;
+        }
+
+        internal ReadOnlySpan<int> Handles =>
+            _parents ? _gmod._graph.GetParents(_node) : _gmod._graph.GetChildren(_node);
+
+        public int Count => Handles.Length;
+
+        public GmodNode this[int index] => _gmod.GetNodeAt(Handles[index]);
+
+        public bool Contains(int handle) => Handles.IndexOf(handle) >= 0;
+
+        public bool Contains(string code) => _gmod.TryGetHandle(code.AsSpan(), out var handle) && Contains(handle);
+
+        public IEnumerator<GmodNode> GetEnumerator()
+        {
+            for (int i = 0; i < Count; i++)
+                yield return this[i];
+        }
+
+        IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+    }
+
     public struct Enumerator : IEnumerator<GmodNode>
     {
         internal ChdDictionary<GmodNode>.Enumerator Inner;
 
-        public GmodNode Current => Inner.Current.Value;
+        // Mapped Gmods enumerate the slots of the stored perfect hash table, which is the same order as Inner
+        private readonly Gmod? _mapped;
+        private int _slot;
+        private GmodNode? _current;
+
+        internal Enumerator(Gmod mapped)
+        {
+            _mapped = mapped;
+            _slot = -1;
+        }
+
+        public GmodNode Current => _mapped is null ? Inner.Current.Value : _current!;
 
-        object IEnumerator.Current => Inner.Current.Value;
+        object IEnumerator.Current => Current;
 
         public void Dispose() => Inner.Dispose();
 
-        public bool MoveNext() => Inner.MoveNext();
+        public bool MoveNext()
+        {
+            if (_mapped is null)
+                return Inner.MoveNext();
+
+            var table = _mapped._store!.ChdTable;
+            while (++_slot < table.Length)
+            {
+                if (table[_slot] >= 0)
+                {
+                    _current = _mapped.GetNodeAt(table[_slot]);
+                    return true;
+                }
+            }
+
+            _slot = table.Length;
+            _current = null;
+            return false;
+        }
 
-        public void Reset() => Inner.Reset();
+        public void Reset()
+        {
+            Inner.Reset();
+            _slot = -1;
+            _current = null;
+        }
     }
 }
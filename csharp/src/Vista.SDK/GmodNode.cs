@@ -1,7 +1,5 @@
 using System.Text;
-#if NET8_0_OR_GREATER
-using System.Collections.Frozen;
-#endif
+using Vista.SDK.Internal;
 
 namespace Vista.SDK;
 
@@ -14,37 +12,35 @@ public record class GmodNode
 
     public GmodNodeMetadata Metadata { get; }
 
-    internal readonly List<GmodNode> _children;
-#if NET8_0_OR_GREATER
-    internal FrozenSet<string> _childrenSet;
-#endif
-    internal readonly List<GmodNode> _parents;
+    // Owning Gmod and the handle of this node in its GmodGraph
+    internal readonly Gmod _gmod;
+    internal readonly int _handle;
+
+    private readonly Gmod.NodeList _children;
+    private readonly Gmod.NodeList _parents;
 
     public IReadOnlyList<GmodNode> Children => _children;
 
     public IReadOnlyList<GmodNode> Parents => _parents;
 
-    internal GmodNode(VisVersion version, GmodNodeDto dto)
+    internal GmodNode(Gmod gmod, int handle, string code, GmodNodeMetadata metadata)
     {
-        VisVersion = version;
-        Code = dto.Code;
-        Metadata = new(
-            dto.Category,
-            dto.Type,
-            dto.Name,
-            dto.CommonName,
-            dto.Definition,
-            dto.CommonDefinition,
-            dto.InstallSubstructure,
-            dto.NormalAssignmentNames ?? new Dictionary<string, string>(0)
-        );
-        _children = new List<GmodNode>();
-#if NET8_0_OR_GREATER
-        _childrenSet = FrozenSet<string>.Empty;
-#endif
-        _parents = new List<GmodNode>();
+        VisVersion = gmod.VisVersion;
+        Code = code;
+        Metadata = metadata;
+        _gmod = gmod;
+        _handle = handle;
+        _children = new Gmod.NodeList(gmod, handle, parents: false);
+        _parents = new Gmod.NodeList(gmod, handle, parents: true);
     }
 
+    internal GmodNodeCategory Category => _gmod.Graph.GetCategory(_handle);
+
+    internal GmodNodeType NodeType => _gmod.Graph.GetNodeType(_handle);
+
+    /// <summary>Equivalent of <see cref="Gmod.IsPotentialParent(string)"/></summary>
+    internal bool IsPotentialParent => NodeType is GmodNodeType.Selection or GmodNodeType.Group or GmodNodeType.Leaf;
+
     internal GmodNode WithoutLocation() => Location is null ? this : this with { Location = null };
 
     internal GmodNode WithLocation(string location)
@@ -88,13 +84,14 @@ internal GmodNode TryWithLocation(in Location? location)
 
     internal bool IsIndividualizable(bool isTargetNode = false, bool isInSet = false)
     {
-        if (Metadata.Type == "GROUP")
+        var type = NodeType;
+        if (type == GmodNodeType.Group)
             return false;
-        if (Metadata.Type == "SELECTION")
+        if (type == GmodNodeType.Selection)
             return false;
         if (IsProductType)
             return false;
-        if (Metadata.Category == "ASSET" && Metadata.Type == "TYPE")
+        if (Category == GmodNodeCategory.Asset && type == GmodNodeType.Type)
             return false;
         if (IsFunctionComposition)
             return Code[Code.Length - 1] == 'i' || isInSet || isTargetNode;
@@ -102,8 +99,8 @@ internal bool IsIndividualizable(bool isTargetNode = false, bool isInSet = false
     }
 
     public bool IsFunctionComposition =>
-        (Metadata.Category == "ASSET FUNCTION" || Metadata.Category == "PRODUCT FUNCTION")
-        && Metadata.Type == "COMPOSITION";
+        Category is GmodNodeCategory.AssetFunction or GmodNodeCategory.ProductFunction
+        && NodeType == GmodNodeType.Composition;
 
     public bool IsMappable
     {
@@ -123,11 +120,11 @@ public bool IsMappable
         }
     }
 
-    public bool IsProductSelection => Gmod.IsProductSelection(Metadata);
+    public bool IsProductSelection => Category == GmodNodeCategory.Product && NodeType == GmodNodeType.Selection;
 
-    public bool IsProductType => Gmod.IsProductType(Metadata);
+    public bool IsProductType => Category == GmodNodeCategory.Product && NodeType == GmodNodeType.Type;
 
-    public bool IsAsset => Gmod.IsAsset(Metadata);
+    public bool IsAsset => Category == GmodNodeCategory.Asset;
 
     public GmodNode? ProductType
     {
@@ -136,14 +133,14 @@ public bool IsMappable
             if (_children.Count != 1)
                 return null;
 
-            if (!Metadata.Category.Contains("FUNCTION"))
+            if ((Category & GmodNodeCategory.Function) == 0)
                 return null;
 
             var child = _children[0];
-            if (child.Metadata.Category != "PRODUCT")
+            if (child.Category != GmodNodeCategory.Product)
                 return null;
 
-            if (child.Metadata.Type != "TYPE")
+            if (child.NodeType != GmodNodeType.Type)
                 return null;
 
             return child;
@@ -157,36 +154,24 @@ public bool IsMappable
             if (_children.Count != 1)
                 return null;
 
-            if (!Metadata.Category.Contains("FUNCTION"))
+            if ((Category & GmodNodeCategory.Function) == 0)
                 return null;
 
             var child = _children[0];
-            if (!child.Metadata.Category.Contains("PRODUCT"))
+            if ((child.Category & GmodNodeCategory.Product) == 0)
                 return null;
 
-            if (child.Metadata.Type != "SELECTION")
+            if (child.NodeType != GmodNodeType.Selection)
                 return null;
 
             return child;
         }
     }
 
-    public bool IsChild(GmodNode node) => IsChild(node.Code);
-
-    public bool IsChild(string code)
-    {
-#if NET8_0_OR_GREATER
-        return _childrenSet.Contains(code);
-#else
-        for (int i = 0; i < _children.Count; i++)
-        {
-            if (_children[i].Code == code)
-                return true;
-        }
+    public bool IsChild(GmodNode node) =>
+        ReferenceEquals(node._gmod, _gmod) ? _children.Contains(node._handle) : _children.Contains(node.Code);
 
-        return false;
-#endif
-    }
+    public bool IsChild(string code) => _children.Contains(code);
 
     public virtual bool Equals(GmodNode? other) => Code == other?.Code && Location == other?.Location;
 
@@ -208,24 +193,11 @@ public void ToString(StringBuilder builder)
         }
     }
 
-    internal void AddChild(GmodNode child) => _children.Add(child);
-
-    internal void AddParent(GmodNode parent) => _parents.Add(parent);
-
-    internal void Trim()
-    {
-        _children.TrimExcess();
-        _parents.TrimExcess();
-#if NET8_0_OR_GREATER
-        _childrenSet = _children.Select(c => c.Code).ToFrozenSet(StringComparer.Ordinal);
-#endif
-    }
-
-    public bool IsLeafNode => Gmod.IsLeafNode(Metadata);
+    public bool IsLeafNode => _gmod.Graph.IsLeafNode(_handle);
 
-    public bool IsFunctionNode => Gmod.IsFunctionNode(Metadata);
+    public bool IsFunctionNode => Category is not GmodNodeCategory.Product and not GmodNodeCategory.Asset;
 
-    public bool IsAssetFunctionNode => Gmod.IsAssetFunctionNode(Metadata);
+    public bool IsAssetFunctionNode => Category == GmodNodeCategory.AssetFunction;
 
     public bool IsRoot => Code == "VE";
 }
@@ -241,5 +213,6 @@ public sealed record class GmodNodeMetadata(
     IReadOnlyDictionary<string, string> NormalAssignmentNames
 )
 {
-    public string FullType { get; } = $"{Category} {Type}";
+    // There is only a handful of distinct category/type combinations, so share the strings between nodes
+    public string FullType { get; } = string.Intern($"{Category} {Type}");
 }
@@ -1,3 +1,4 @@
+using System.Buffers;
 using System.Collections;
 using System.Diagnostics;
 using System.Diagnostics.CodeAnalysis;
@@ -8,15 +9,22 @@ namespace Vista.SDK;
 
 public sealed record GmodIndividualizableSet
 {
-    private readonly List<int> _nodes;
+    private readonly IReadOnlyList<int> _nodes;
     private GmodPath _path;
 
     public IReadOnlyList<GmodNode> Nodes => _nodes.Select(i => _path[i]).ToArray();
 
     public IReadOnlyList<int> NodeIndices => _nodes;
 
-    internal GmodIndividualizableSet(List<int> nodes, GmodPath path)
+    internal GmodIndividualizableSet(IReadOnlyList<int> nodes, GmodPath path, bool validate = true)
     {
+        if (!validate)
+        {
+            _nodes = nodes;
+            _path = path;
+            return;
+        }
+
         if (nodes.Count == 0)
             throw new Exception("GmodIndividualizableSet cant be empty");
         if (nodes.Any(i => !path[i].IsIndividualizable(i == path.Length - 1, nodes.Count > 1)))
@@ -27,22 +35,14 @@ internal GmodIndividualizableSet(List<int> nodes, GmodPath path)
             throw new Exception("GmodIndividualizableSet has no nodes that are part of short path");
 
         _nodes = nodes;
-        _path = path with { _parents = path._parents.ToList(), Node = path.Node with { } };
+        // Paths are immutable, setting the location derives a new path sharing the nodes of this one
+        _path = path;
     }
 
     public Location? Location
     {
         get => _path[_nodes[0]].Location;
-        set
-        {
-            for (int i = 0; i < _nodes.Count; i++)
-            {
-                if (value is null)
-                    _path[_nodes[i]] = _path[_nodes[i]].WithoutLocation();
-                else
-                    _path[_nodes[i]] = _path[_nodes[i]].WithLocation(value.Value);
-            }
-        }
+        set => _path = _path.WithLocation(_nodes, value);
     }
 
     public GmodPath Build()
@@ -60,13 +60,37 @@ public GmodPath Build()
 }
 
 public sealed record GmodPath
+#if NET8_0_OR_GREATER
+    : ISpanFormattable,
+        IUtf8SpanFormattable
+#endif
 {
-    internal List<GmodNode> _parents { get; init; }
-    public IReadOnlyList<GmodNode> Parents => _parents;
-    public VisVersion VisVersion { get; private set; }
-    public GmodNode Node { get; internal set; }
+    // The full path as handles into the graph of _gmod, root first and the end node last.
+    // Never mutated, so paths that only differ in locations share it
+    private readonly int[] _handles;
+
+    // The individualized nodes by ascending depth, empty when the path has no locations.
+    // The nodes come from the bounded cache of Gmod.GetNodeAt(int, Location)
+    private readonly (int Depth, GmodNode Node)[] _locatedNodes;
+
+    private readonly Gmod _gmod;
+    private readonly GmodNode _node;
+    private ParentList? _parents;
+
+    // Computed on first use, 0 until then
+    private int _hashCode;
+
+    // Node indices of each individualizable set, computed on first use.
+    // The sets only depend on the nodes and not on their locations,
+    // so paths derived by changing locations share them instead of visiting the path again
+    private int[][]? _sets;
+    private bool _setsValidated;
 
-    public int Length => _parents.Count + 1;
+    public IReadOnlyList<GmodNode> Parents => _parents ??= new ParentList(this);
+    public VisVersion VisVersion => _gmod.VisVersion;
+    public GmodNode Node => _node;
+
+    public int Length => _handles.Length;
 
     public bool IsMappable => Node.IsMappable;
 
@@ -76,72 +100,71 @@ public sealed record GmodPath
         {
             if (depth < 0)
                 throw new IndexOutOfRangeException("Index out of range for GmodPath indexer");
-            if (depth > _parents.Count)
+            if (depth >= _handles.Length)
                 throw new IndexOutOfRangeException("Index out of range for GmodPath indexer");
 
-            return depth < _parents.Count ? _parents[depth] : Node;
+            return GetNode(depth);
         }
-        internal set
+    }
+
+    private GmodNode GetNode(int depth)
+    {
+        foreach (var (locatedDepth, node) in _locatedNodes)
         {
-            if (depth < _parents.Count)
-                _parents[depth] = value;
-            else
-                Node = value;
+            if (locatedDepth == depth)
+                return node;
+            if (locatedDepth > depth)
+                break;
         }
+        return _gmod.GetNodeAt(_handles[depth]);
     }
 
+    /// <remarks>Computed once per path, each access returns new sets that can be individualized independently</remarks>
     public IReadOnlyList<GmodIndividualizableSet> IndividualizableSets
     {
         get
         {
-            var result = new List<GmodIndividualizableSet>();
-            var visitor = new LocationSetsVisitor();
-            for (int i = 0; i < Length; i++)
-            {
-                var node = this[i];
-                var set = visitor.Visit(node, i, _parents, Node);
-                if (set is null)
-                    continue;
-
-                var (start, end, _) = set.Value;
-                if (start == end)
-                {
-                    result.Add(new GmodIndividualizableSet(new List<int>() { start }, this));
-                    continue;
-                }
-
-                var nodes = new List<int>(end - start);
-                for (int j = start; j <= end; j++)
-                    nodes.Add(j);
-
-                result.Add(new GmodIndividualizableSet(nodes, this));
-            }
+            var sets = GetSets();
+            // The path is immutable, so the sets only need to be validated the first time
+            var validate = !_setsValidated;
+            var result = new GmodIndividualizableSet[sets.Length];
+            for (int i = 0; i < sets.Length; i++)
+                result[i] = new GmodIndividualizableSet(sets[i], this, validate);
+            _setsValidated = true;
             return result;
         }
     }
 
-    public bool IsIndividualizable
+    public bool IsIndividualizable => GetSets().Length > 0;
+
+    private int[][] GetSets()
     {
-        get
-        {
-            var visitor = new LocationSetsVisitor();
-            for (int i = 0; i < Length; i++)
-            {
-                var node = this[i];
-                var set = visitor.Visit(node, i, _parents, Node);
-                if (set is null)
-                    continue;
+        var sets = _sets;
+        if (sets is not null)
+            return sets;
 
-                return true;
-            }
+        var result = new List<int[]>();
+        var visitor = new LocationSetsVisitor();
+        for (int i = 0; i < Length; i++)
+        {
+            var set = visitor.Visit(GetNode(i), i, Parents, Node);
+            if (set is null)
+                continue;
 
-            return false;
+            var (start, end, _) = set.Value;
+            var nodes = new int[end - start + 1];
+            for (int j = start; j <= end; j++)
+                nodes[j - start] = j;
+            result.Add(nodes);
         }
+
+        sets = result.ToArray();
+        _sets = sets;
+        return sets;
     }
 
-    internal GmodPath(List<GmodNode> parents, GmodNode node, bool skipVerify = true)
+    internal GmodPath(IReadOnlyList<GmodNode> parents, GmodNode node, bool skipVerify = true)
     {
-        VisVersion = node.VisVersion;
         if (!skipVerify)
         {
             if (parents.Count == 0)
@@ -178,8 +201,30 @@ internal GmodPath(List<GmodNode> parents, GmodNode node, bool skipVerify = true)
             }
         }
 
-        _parents = parents;
-        Node = node;
+        _gmod = node._gmod;
+        _handles = new int[parents.Count + 1];
+        List<(int Depth, GmodNode Node)>? locatedNodes = null;
+        for (var i = 0; i < _handles.Length; i++)
+        {
+            var n = i < parents.Count ? parents[i] : node;
+            var handle = n._handle;
+            if (!ReferenceEquals(n._gmod, _gmod) && !_gmod.TryGetHandle(n.Code.AsSpan(), out handle))
+                throw new ArgumentException($"Invalid gmod path - {n.Code} is not in the Gmod of {node.Code}");
+            _handles[i] = handle;
+            if (n.Location is not null)
+                (locatedNodes ??= new()).Add((i, _gmod.GetNodeAt(handle, n.Location.Value)));
+        }
+        _locatedNodes = locatedNodes?.ToArray() ?? [];
+        _node = GetNode(_handles.Length - 1);
+    }
+
+    private GmodPath(Gmod gmod, int[] handles, (int Depth, GmodNode Node)[] locatedNodes, int[][]? sets)
+    {
+        _gmod = gmod;
+        _handles = handles;
+        _locatedNodes = locatedNodes;
+        _node = GetNode(handles.Length - 1);
+        _sets = sets;
     }
 
     public static bool IsValid(IReadOnlyList<GmodNode> parents, GmodNode node) => IsValid(parents, node, out _);
@@ -221,8 +266,30 @@ internal static bool IsValid(IReadOnlyList<GmodNode> parents, GmodNode node, out
     public GmodPath(List<GmodNode> parents, GmodNode node)
         : this(parents, node, false) { }
 
+    // Uses the shared node instances of the Gmod instead of copying the node
+    private static GmodNode SetLocation(GmodNode node, Location? location) =>
+        location is null ? node._gmod.GetNodeAt(node._handle) : node._gmod.GetNodeAt(node._handle, location.Value);
+
     public GmodPath WithoutLocations() =>
-        new GmodPath(_parents.Select(n => n.WithoutLocation()).ToList(), Node.WithoutLocation());
+        _locatedNodes.Length == 0 ? this : new GmodPath(_gmod, _handles, [], _sets);
+
+    /// <summary>Returns this path with the nodes at <paramref name="depths"/> individualized by <paramref name="location"/></summary>
+    internal GmodPath WithLocation(IReadOnlyList<int> depths, Location? location)
+    {
+        var locatedNodes = new List<(int Depth, GmodNode Node)>(_locatedNodes.Length + depths.Count);
+        foreach (var located in _locatedNodes)
+        {
+            if (!depths.Contains(located.Depth))
+                locatedNodes.Add(located);
+        }
+        if (location is not null)
+        {
+            foreach (var depth in depths)
+                locatedNodes.Add((depth, _gmod.GetNodeAt(_handles[depth], location.Value)));
+            locatedNodes.Sort((a, b) => a.Depth.CompareTo(b.Depth));
+        }
+        return new GmodPath(_gmod, _handles, locatedNodes.ToArray(), _sets);
+    }
 
     public override string ToString()
     {
@@ -233,18 +300,110 @@ public override string ToString()
 
     public void ToString(StringBuilder builder, char separator = '/')
     {
-        foreach (var parent in _parents)
+        for (var i = 0; i < _handles.Length - 1; i++)
         {
-            if (!Gmod.IsLeafNode(parent.Metadata))
+            if (!_gmod.Graph.IsLeafNode(_handles[i]))
                 continue;
 
-            parent.ToString(builder);
+            GetNode(i).ToString(builder);
             builder.Append(separator);
         }
 
         Node.ToString(builder);
     }
 
+    /// <summary>Writes the short path, the same as <see cref="ToString()"/>, the format is ignored</summary>
+    public bool TryFormat(
+        Span<char> destination,
+        out int charsWritten,
+        ReadOnlySpan<char> format = default,
+        IFormatProvider? provider = null
+    )
+    {
+        var written = 0;
+        for (var i = 0; i < _handles.Length - 1; i++)
+        {
+            if (!_gmod.Graph.IsLeafNode(_handles[i]))
+                continue;
+
+            if (!TryWrite(GetNode(i), destination, ref written) || !SpanFormatting.TryWrite('/', destination, ref written))
+            {
+                charsWritten = 0;
+                return false;
+            }
+        }
+
+        if (!TryWrite(Node, destination, ref written))
+        {
+            charsWritten = 0;
+            return false;
+        }
+        charsWritten = written;
+        return true;
+
+        static bool TryWrite(GmodNode node, Span<char> destination, ref int written) =>
+            SpanFormatting.TryWrite(node.Code, destination, ref written)
+            && (
+                node.Location is not { } location
+                || SpanFormatting.TryWrite('-', destination, ref written)
+                    && SpanFormatting.TryWrite(location.Value, destination, ref written)
+            );
+    }
+
+    /// <summary>Writes the short path as UTF-8, the same as <see cref="ToString()"/></summary>
+    public bool TryFormatUtf8(Span<byte> destination, out int bytesWritten)
+    {
+        var written = 0;
+        for (var i = 0; i < _handles.Length - 1; i++)
+        {
+            if (!_gmod.Graph.IsLeafNode(_handles[i]))
+                continue;
+
+            if (!TryWrite(GetNode(i), destination, ref written) || !SpanFormatting.TryWrite('/', destination, ref written))
+            {
+                bytesWritten = 0;
+                return false;
+            }
+        }
+
+        if (!TryWrite(Node, destination, ref written))
+        {
+            bytesWritten = 0;
+            return false;
+        }
+        bytesWritten = written;
+        return true;
+
+        static bool TryWrite(GmodNode node, Span<byte> destination, ref int written) =>
+            SpanFormatting.TryWrite(node.Code, destination, ref written)
+            && (
+                node.Location is not { } location
+                || SpanFormatting.TryWrite('-', destination, ref written)
+                    && SpanFormatting.TryWrite(location.Value, destination, ref written)
+            );
+    }
+
+    /// <summary>Writes the short path as UTF-8 into <paramref name="writer"/></summary>
+    public void WriteTo(IBufferWriter<byte> writer) =>
+        SpanFormatting.WriteTo(
+            this,
+            writer,
+            _handles.Length * 8,
+            static (GmodPath path, Span<byte> destination, out int written) =>
+                path.TryFormatUtf8(destination, out written)
+        );
+
+#if NET8_0_OR_GREATER
+    string IFormattable.ToString(string? format, IFormatProvider? formatProvider) => ToString();
+
+    bool IUtf8SpanFormattable.TryFormat(
+        Span<byte> utf8Destination,
+        out int bytesWritten,
+        ReadOnlySpan<char> format,
+        IFormatProvider? provider
+    ) => TryFormatUtf8(utf8Destination, out bytesWritten);
+#endif
+
     public string ToFullPathString()
     {
         using var lease = StringBuilderPool.Get();
@@ -307,27 +466,74 @@ public bool Equals(GmodPath? other)
     {
         if (other is null)
             return false;
+        if (ReferenceEquals(this, other))
+            return true;
 
-        if (_parents.Count != other._parents.Count)
+        if (_handles.Length != other._handles.Length)
+            return false;
+        if (_hashCode != 0 && other._hashCode != 0 && _hashCode != other._hashCode)
             return false;
 
-        for (int i = 0; i < _parents.Count; i++)
+        if (!ReferenceEquals(_gmod, other._gmod))
         {
-            if (_parents[i] != other._parents[i])
-                return false;
+            for (int i = 0; i < _handles.Length; i++)
+            {
+                if (GetNode(i) != other.GetNode(i))
+                    return false;
+            }
+            return true;
         }
 
-        return Node == other.Node;
+        // Within a Gmod a handle identifies the code of a node
+        if (!_handles.AsSpan().SequenceEqual(other._handles))
+            return false;
+        if (_locatedNodes.Length != other._locatedNodes.Length)
+            return false;
+        for (int i = 0; i < _locatedNodes.Length; i++)
+        {
+            var (depth, node) = _locatedNodes[i];
+            var (otherDepth, otherNode) = other._locatedNodes[i];
+            if (depth != otherDepth || node.Location != otherNode.Location)
+                return false;
+        }
+        return true;
     }
 
     public override int GetHashCode()
     {
-        var hashCode = new HashCode();
-        for (int i = 0; i < _parents.Count; i++)
-            hashCode.Add(_parents[i]);
+        var hashCode = _hashCode;
+        if (hashCode != 0)
+            return hashCode;
+
+        var hash = new HashCode();
+        for (int i = 0; i < _handles.Length; i++)
+            hash.Add(GetNode(i));
+
+        hashCode = hash.ToHashCode();
+        if (hashCode == 0)
+            hashCode = 1;
+        _hashCode = hashCode;
+        return hashCode;
+    }
+
+    private sealed class ParentList : IReadOnlyList<GmodNode>
+    {
+        private readonly GmodPath _path;
+
+        public ParentList(GmodPath path) => _path = path;
+
+        public int Count => _path._handles.Length - 1;
 
-        hashCode.Add(Node);
-        return hashCode.ToHashCode();
+        public GmodNode this[int index] =>
+            (uint)index < (uint)Count ? _path.GetNode(index) : throw new ArgumentOutOfRangeException(nameof(index));
+
+        public IEnumerator<GmodNode> GetEnumerator()
+        {
+            for (var i = 0; i < Count; i++)
+                yield return _path.GetNode(i);
+        }
+
+        IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
     }
 
     public Enumerator GetFullPath() => new Enumerator(this);
@@ -350,7 +556,7 @@ public Enumerator(GmodPath path, int? fromDepth = null)
             Current = (-1, null!);
             if (fromDepth is not null)
             {
-                if (fromDepth < 0 || fromDepth > _path._parents.Count)
+                if (fromDepth < 0 || fromDepth > _path.Length - 1)
                     throw new ArgumentOutOfRangeException(nameof(fromDepth));
 
                 Current = (fromDepth.Value - 1, fromDepth == 0 ? null! : _path[fromDepth.Value - 1]);
@@ -359,12 +565,9 @@ public Enumerator(GmodPath path, int? fromDepth = null)
 
         public bool MoveNext()
         {
-            if (Current.Depth < _path._parents.Count)
+            if (Current.Depth < _path.Length - 1)
             {
-                Current =
-                    Current.Depth == _path._parents.Count - 1
-                        ? (Current.Depth + 1, _path.Node)
-                        : (Current.Depth + 1, _path._parents[Current.Depth + 1]);
+                Current = (Current.Depth + 1, _path.GetNode(Current.Depth + 1));
                 return true;
             }
 
@@ -399,7 +602,7 @@ public IEnumerable<(int Depth, string Name)> GetCommonNames()
     {
         foreach (var (depth, node) in this.GetFullPath())
         {
-            var isTarget = depth == _parents.Count;
+            var isTarget = depth == Length - 1;
             if (!(node.IsLeafNode || isTarget) || !node.IsFunctionNode)
                 continue;
 
@@ -412,9 +615,9 @@ public IEnumerable<(int Depth, string Name)> GetCommonNames()
                     if (normalAssignmentNames.TryGetValue(Node.Code, out var assignment))
                         name = assignment;
                 }
-                for (int i = _parents.Count - 1; i >= depth; i--)
+                for (int i = Length - 2; i >= depth; i--)
                 {
-                    if (!normalAssignmentNames.TryGetValue(_parents[i].Code, out var assignment))
+                    if (!normalAssignmentNames.TryGetValue(GetNode(i).Code, out var assignment))
                         continue;
 
                     name = assignment;
@@ -427,11 +630,23 @@ public IEnumerable<(int Depth, string Name)> GetCommonNames()
 
     private readonly record struct PathNode(string Code, Location? Location = null);
 
+    /// <summary>Scratch state of a parse, reused across the items of <see cref="TryParsePaths"/></summary>
     private sealed record ParseContext(Queue<PathNode> Parts)
     {
         public PathNode ToFind;
+        public int ToFindHandle;
+
+        // Nodes that lead down to ToFind, the traversal skips every other subtree
+        public ulong[] ToFindAncestors = [];
         public Dictionary<string, Location>? Locations;
         public GmodPath? Path;
+
+        public void Reset()
+        {
+            Parts.Clear();
+            Locations?.Clear();
+            Path = null;
+        }
     }
 
     public static GmodPath Parse(string item, VisVersion visVersion)
@@ -474,7 +689,7 @@ internal record struct LocationSetsVisitor
             GmodNode target
         )
         {
-            var isParent = Gmod.IsPotentialParent(node.Metadata.Type);
+            var isParent = node.IsPotentialParent;
             var isTargetNode = i == parents.Count;
             if (currentParentStart == -1)
             {
@@ -570,7 +785,78 @@ public static bool TryParse(string? item, Gmod gmod, Locations locations, [NotNu
         return false;
     }
 
-    private static GmodParsePathResult ParseInternal(string? item, Gmod gmod, Locations locations)
+    /// <summary>
+    /// Parses <paramref name="items"/> with shared scratch state, see <see cref="Parse(string, Gmod, Locations)"/>.
+    /// </summary>
+    /// <exception cref="ArgumentException">If any of the items is not a valid path</exception>
+    public static GmodPath[] ParsePaths(ReadOnlySpan<string> items, VisVersion visVersion)
+    {
+        var gmod = VIS.Instance.GetGmod(visVersion);
+        var locations = VIS.Instance.GetLocations(visVersion);
+        return ParsePaths(items, gmod, locations);
+    }
+
+    /// <inheritdoc cref="ParsePaths(ReadOnlySpan{string}, VisVersion)"/>
+    public static GmodPath[] ParsePaths(ReadOnlySpan<string> items, Gmod gmod, Locations locations)
+    {
+        var paths = new GmodPath[items.Length];
+        var context = new ParseContext(new Queue<PathNode>());
+        for (var i = 0; i < items.Length; i++)
+        {
+            paths[i] = ParseInternal(items[i], gmod, locations, context) switch
+            {
+                GmodParsePathResult.Ok r => r.Path,
+                GmodParsePathResult.Err e => throw new ArgumentException(e.Error),
+                _ => throw new Exception("Unexpected result")
+            };
+        }
+        return paths;
+    }
+
+    /// <summary>
+    /// Parses <paramref name="items"/> into <paramref name="paths"/> with shared scratch state,
+    /// items that are not valid paths are set to null.
+    /// </summary>
+    /// <returns>The number of items that were parsed</returns>
+    public static int TryParsePaths(
+        ReadOnlySpan<string?> items,
+        Gmod gmod,
+        Locations locations,
+        Span<GmodPath?> paths
+    )
+    {
+        if (paths.Length < items.Length)
+            throw new ArgumentException("Output span is shorter than the items", nameof(paths));
+
+        var parsed = 0;
+        var context = new ParseContext(new Queue<PathNode>());
+        for (var i = 0; i < items.Length; i++)
+        {
+            paths[i] = ParseInternal(items[i], gmod, locations, context) is GmodParsePathResult.Ok r ? r.Path : null;
+            if (paths[i] is not null)
+                parsed++;
+        }
+        return parsed;
+    }
+
+    private static GmodParsePathResult ParseInternal(
+        string? item,
+        Gmod gmod,
+        Locations locations,
+        ParseContext? context = null
+    )
+    {
+        var result = ParsePathCore(item, gmod, locations, context);
+        VisTelemetry.GmodPathParsed(VisTelemetry.ShortPath, result is GmodParsePathResult.Ok);
+        return result;
+    }
+
+    private static GmodParsePathResult ParsePathCore(
+        string? item,
+        Gmod gmod,
+        Locations locations,
+        ParseContext? context
+    )
     {
         if (gmod.VisVersion != locations.VisVersion)
             throw new ArgumentException("Got different VIS versions for Gmod and Locations arguments");
@@ -580,127 +866,156 @@ private static GmodParsePathResult ParseInternal(string? item, Gmod gmod, Locati
 
         item = item!.Trim().TrimStart('/');
 
-        var parts = new Queue<PathNode>();
-        foreach (var partStr in item.Split('/'))
+        context?.Reset();
+        context ??= new ParseContext(new Queue<PathNode>());
+        var parts = context.Parts;
+        var span = item.AsSpan();
+        while (true)
         {
-            if (partStr.Contains('-'))
+            var slash = span.IndexOf('/');
+            var part = slash < 0 ? span : span.Slice(0, slash);
+            var dash = part.IndexOf('-');
+            if (!gmod.TryGetNode(dash < 0 ? part : part.Slice(0, dash), out var node))
+                return new GmodParsePathResult.Err($"Failed to get GmodNode for {part.ToString()}");
+
+            if (dash < 0)
             {
-                var split = partStr.Split('-');
-                if (!gmod.TryGetNode(split[0], out _))
-                    return new GmodParsePathResult.Err($"Failed to get GmodNode for {partStr}");
-                if (!locations.TryParse(split[1], out var location))
-                    return new GmodParsePathResult.Err($"Failed to parse location {split[1]}");
-                parts.Enqueue(new PathNode(split[0], location));
+                parts.Enqueue(new PathNode(node.Code));
             }
             else
             {
-                if (!gmod.TryGetNode(partStr, out _))
-                    return new GmodParsePathResult.Err($"Failed to get GmodNode for {partStr}");
-                parts.Enqueue(new PathNode(partStr));
+                var locationStr = part.Slice(dash + 1);
+                var nextDash = locationStr.IndexOf('-');
+                if (nextDash >= 0)
+                    locationStr = locationStr.Slice(0, nextDash);
+                if (!locations.TryParse(locationStr, out var location))
+                    return new GmodParsePathResult.Err($"Failed to parse location {locationStr.ToString()}");
+                parts.Enqueue(new PathNode(node.Code, location));
             }
+
+            if (slash < 0)
+                break;
+            span = span.Slice(slash + 1);
         }
 
         if (parts.Count == 0)
             return new GmodParsePathResult.Err("Failed find any parts");
-        if (parts.Any(p => string.IsNullOrWhiteSpace(p.Code)))
-            return new GmodParsePathResult.Err("Failed find any parts");
 
         var toFind = parts.Dequeue();
         if (!gmod.TryGetNode(toFind.Code, out var baseNode))
             return new GmodParsePathResult.Err("Failed to find base node");
 
-        var context = new ParseContext(parts) { ToFind = toFind };
+        context.ToFind = toFind;
+        context.ToFindHandle = baseNode._handle;
 
-        gmod.Traverse(
-            context,
-            baseNode,
-            (context, parents, current) =>
-            {
-                ref var toFind = ref context.ToFind;
-                var found = current.Code == toFind.Code;
+        gmod.Traverse(baseNode, new ParseHandler(context, gmod));
 
-                if (!found && Gmod.IsLeafNode(current.Metadata))
-                    return TraversalHandlerResult.SkipSubtree;
+        if (context.Path is null)
+            return new GmodParsePathResult.Err("Failed to find path after travesal");
 
-                if (!found)
-                    return TraversalHandlerResult.Continue;
+        return new GmodParsePathResult.Ok(context.Path);
+    }
 
-                if (toFind.Location is not null)
-                {
-                    context.Locations ??= new();
-                    context.Locations.Add(toFind.Code, toFind.Location.Value);
-                }
+    private readonly struct ParseHandler : ITraversalHandler
+    {
+        private readonly ParseContext _context;
+        private readonly Gmod _gmod;
 
-                if (context.Parts.Count > 0)
-                {
-                    toFind = context.Parts.Dequeue();
-                    return TraversalHandlerResult.Continue;
-                }
+        public ParseHandler(ParseContext context, Gmod gmod)
+        {
+            _context = context;
+            _gmod = gmod;
+        }
 
-                var pathParents = new List<GmodNode>(parents.Count + 1);
-                foreach (var parent in parents)
-                {
-                    if (context.Locations?.TryGetValue(parent.Code, out var location) ?? false)
-                        pathParents.Add(parent.WithLocation(location));
-                    else
-                        pathParents.Add(parent);
-                }
-                var endNode = toFind.Location is not null ? current.WithLocation(toFind.Location) : current;
+        public TraversalHandlerResult Handle(IReadOnlyList<GmodNode> parents, GmodNode current, int handle)
+        {
+            var context = _context;
+            var gmod = _gmod;
+            ref var toFind = ref context.ToFind;
+            var found = handle == context.ToFindHandle;
 
-                var startNode =
-                    pathParents.Count > 0 && pathParents[0].Parents.Count == 1
-                        ? pathParents[0].Parents[0]
-                        : endNode.Parents.Count == 1
-                            ? endNode.Parents[0]
-                            : null;
+            if (!found && gmod.Graph.IsLeafNode(handle))
+                return TraversalHandlerResult.SkipSubtree;
 
-                if (startNode is null || startNode.Parents.Count > 1)
+            // Nothing below a node that isn't an ancestor can be found, so skipping it yields the same path
+            if (!found)
+                return GmodGraph.IsAncestor(context.ToFindAncestors, handle)
+                    ? TraversalHandlerResult.Continue
+                    : TraversalHandlerResult.SkipSubtree;
+
+            if (toFind.Location is not null)
+            {
+                context.Locations ??= new();
+                context.Locations.Add(toFind.Code, toFind.Location.Value);
+            }
+
+            if (context.Parts.Count > 0)
+            {
+                toFind = context.Parts.Dequeue();
+                if (!gmod.TryGetHandle(toFind.Code.AsSpan(), out context.ToFindHandle))
                     return TraversalHandlerResult.Stop;
+                context.ToFindAncestors = gmod.Graph.GetAncestors(context.ToFindHandle);
+                return TraversalHandlerResult.Continue;
+            }
+
+            var pathParents = new List<GmodNode>(parents.Count + 1);
+            foreach (var parent in parents)
+            {
+                if (context.Locations?.TryGetValue(parent.Code, out var location) ?? false)
+                    pathParents.Add(parent.WithLocation(location));
+                else
+                    pathParents.Add(parent);
+            }
+            var endNode = toFind.Location is not null ? current.WithLocation(toFind.Location) : current;
+
+            var startNode =
+                pathParents.Count > 0 && pathParents[0].Parents.Count == 1
+                    ? pathParents[0].Parents[0]
+                    : endNode.Parents.Count == 1
+                        ? endNode.Parents[0]
+                        : null;
+
+            if (startNode is null || startNode.Parents.Count > 1)
+                return TraversalHandlerResult.Stop;
+
+            while (startNode.Parents.Count == 1)
+            {
+                pathParents.Insert(0, startNode);
+                startNode = startNode.Parents[0];
+                if (startNode.Parents.Count > 1)
+                    return TraversalHandlerResult.Stop;
+            }
+
+            pathParents.Insert(0, gmod.RootNode);
 
-                while (startNode.Parents.Count == 1)
+            var visitor = new LocationSetsVisitor();
+            for (var i = 0; i < pathParents.Count + 1; i++)
+            {
+                var n = i < pathParents.Count ? pathParents[i] : endNode;
+                var set = visitor.Visit(n, i, pathParents, endNode);
+                if (set is null)
                 {
-                    pathParents.Insert(0, startNode);
-                    startNode = startNode.Parents[0];
-                    if (startNode.Parents.Count > 1)
+                    if (n.Location is not null)
                         return TraversalHandlerResult.Stop;
+                    continue;
                 }
 
-                pathParents.Insert(0, gmod.RootNode);
+                var (start, end, location) = set.Value;
+                if (start == end)
+                    continue;
 
-                var visitor = new LocationSetsVisitor();
-                for (var i = 0; i < pathParents.Count + 1; i++)
+                for (int j = start; j <= end; j++)
                 {
-                    var n = i < pathParents.Count ? pathParents[i] : endNode;
-                    var set = visitor.Visit(n, i, pathParents, endNode);
-                    if (set is null)
-                    {
-                        if (n.Location is not null)
-                            return TraversalHandlerResult.Stop;
-                        continue;
-                    }
-
-                    var (start, end, location) = set.Value;
-                    if (start == end)
-                        continue;
-
-                    for (int j = start; j <= end; j++)
-                    {
-                        if (j < pathParents.Count)
-                            pathParents[j] = pathParents[j] with { Location = location };
-                        else
-                            endNode = endNode with { Location = location };
-                    }
+                    if (j < pathParents.Count)
+                        pathParents[j] = SetLocation(pathParents[j], location);
+                    else
+                        endNode = SetLocation(endNode, location);
                 }
-
-                context.Path = new GmodPath(pathParents, endNode);
-                return TraversalHandlerResult.Stop;
             }
-        );
 
-        if (context.Path is null)
-            return new GmodParsePathResult.Err("Failed to find path after travesal");
-
-        return new GmodParsePathResult.Ok(context.Path);
+            context.Path = new GmodPath(pathParents, endNode);
+            return TraversalHandlerResult.Stop;
+        }
     }
 
     public static GmodPath ParseFullPath(string pathStr, VisVersion visVersion)
@@ -767,6 +1082,13 @@ public static GmodPath ParseFullPath(string pathStr, VisVersion visVersion)
     }
 
     private static GmodParsePathResult ParseFullPathInternal(ReadOnlySpan<char> span, Gmod gmod, Locations locations)
+    {
+        var result = ParseFullPathCore(span, gmod, locations);
+        VisTelemetry.GmodPathParsed(VisTelemetry.FullPath, result is GmodParsePathResult.Ok);
+        return result;
+    }
+
+    private static GmodParsePathResult ParseFullPathCore(ReadOnlySpan<char> span, Gmod gmod, Locations locations)
     {
         Debug.Assert(gmod.VisVersion == locations.VisVersion);
 
@@ -797,7 +1119,7 @@ private static GmodParsePathResult ParseFullPathInternal(ReadOnlySpan<char> span
                 if (!locations.TryParse(locationStr, out var location))
                     return new GmodParsePathResult.Err($"Failed to parse location - {locationStr.ToString()}");
 
-                node = node.WithLocation(location);
+                node = SetLocation(node, location);
             }
 
             nodes.Add(node);
@@ -847,9 +1169,9 @@ private static GmodParsePathResult ParseFullPathInternal(ReadOnlySpan<char> span
             for (int j = start; j <= end; j++)
             {
                 if (j < nodes.Count)
-                    nodes[j] = nodes[j] with { Location = location };
+                    nodes[j] = SetLocation(nodes[j], location);
                 else
-                    endNode = endNode with { Location = location };
+                    endNode = SetLocation(endNode, location);
             }
         }
 
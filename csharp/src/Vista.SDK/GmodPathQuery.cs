@@ -18,6 +18,8 @@ private GmodPathQueryBuilder()
 
     private readonly Dictionary<string, NodeItem> _filter;
 
+    internal IReadOnlyDictionary<string, NodeItem> Filter => _filter;
+
     public static Nodes Empty() => new Nodes();
 
     public static Path From(GmodPath path) => new(path);
@@ -36,7 +38,8 @@ internal Path(GmodPath path)
 
             foreach (var set in path.IndividualizableSets)
             {
-                var setNode = set.Nodes[set.Nodes.Count - 1];
+                var nodes = set.Nodes;
+                var setNode = nodes[nodes.Count - 1];
                 _setNodes.Add(setNode.Code, setNode);
                 HashSet<Location> locations = [];
                 if (set.Location is not null)
@@ -151,7 +154,7 @@ private static GmodPath EnsurePathVersion(GmodPath path)
         return p;
     }
 
-    private static GmodNode EnsureNodeVersion(GmodNode node)
+    internal static GmodNode EnsureNodeVersion(GmodNode node)
     {
         GmodNode n = node;
         if (n.VisVersion < VIS.LatestVisVersion)
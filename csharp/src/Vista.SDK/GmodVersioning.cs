@@ -1,3 +1,4 @@
+using System.Collections.Concurrent;
 using System.Diagnostics.CodeAnalysis;
 
 namespace Vista.SDK;
@@ -5,6 +6,8 @@ namespace Vista.SDK;
 internal sealed class GmodVersioning
 {
     private readonly Dictionary<VisVersion, GmodVersioningNode> _versioningsMap = new();
+    private readonly ConcurrentDictionary<(VisVersion Source, VisVersion Target), NodeConversionMap> _conversionMaps =
+        new();
 
     internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
     {
@@ -20,6 +23,28 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
     {
         ValidateSourceAndTargetVersions(sourceVersion, targetVersion);
 
+        return ConvertNode(GetConversionMap(sourceVersion, targetVersion), sourceNode);
+    }
+
+    private GmodNode? ConvertNode(NodeConversionMap map, GmodNode sourceNode)
+    {
+        ValidateSourceAndTargetVersionPair(sourceNode.VisVersion, map.SourceVersion + 1);
+
+        if (!map.TryConvert(sourceNode, out var targetNode))
+            return ConvertNodeStepwise(map.SourceVersion, sourceNode, map.TargetVersion);
+        if (targetNode is null)
+            return null;
+
+        // Stepping through the versions checks the location at every intermediate node, but each step sets the
+        // location parsed for the source node as is, so the check at the target node covers the intermediate ones
+        var result = targetNode.TryWithLocation(sourceNode.Location);
+        if (sourceNode.Location is not null && result.Location != sourceNode.Location)
+            throw new Exception("Failed to set location");
+        return result;
+    }
+
+    private GmodNode? ConvertNodeStepwise(VisVersion sourceVersion, GmodNode sourceNode, VisVersion targetVersion)
+    {
         GmodNode? node = sourceNode;
         var source = sourceVersion;
 
@@ -61,7 +86,26 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
         return result;
     }
 
-    public LocalIdBuilder? ConvertLocalId(LocalIdBuilder sourceLocalId, VisVersion targetVersion)
+    public LocalIdBuilder? ConvertLocalId(LocalIdBuilder sourceLocalId, VisVersion targetVersion) =>
+        ConvertLocalId(sourceLocalId, targetVersion, null);
+
+    public LocalId? ConvertLocalId(LocalId sourceLocalId, VisVersion targetVersion) =>
+        ConvertLocalId(sourceLocalId.Builder, targetVersion)?.Build();
+
+    public IReadOnlyList<LocalId?> ConvertLocalIds(IEnumerable<LocalId> sourceLocalIds, VisVersion targetVersion)
+    {
+        var cache = new PathConversionCache();
+        var result = new List<LocalId?>();
+        foreach (var sourceLocalId in sourceLocalIds)
+            result.Add(ConvertLocalId(sourceLocalId.Builder, targetVersion, cache)?.Build());
+        return result;
+    }
+
+    internal LocalIdBuilder? ConvertLocalId(
+        LocalIdBuilder sourceLocalId,
+        VisVersion targetVersion,
+        PathConversionCache? cache
+    )
     {
         if (sourceLocalId.VisVersion is null)
             throw new InvalidOperationException("Cant convert local ID without a specific VIS version");
@@ -73,7 +117,8 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
             var targetPrimaryitem = ConvertPath(
                 sourceLocalId.VisVersion.Value,
                 sourceLocalId.PrimaryItem,
-                targetVersion
+                targetVersion,
+                cache
             );
             if (targetPrimaryitem is null)
                 return null;
@@ -84,7 +129,8 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
             var targetSecondaryitem = ConvertPath(
                 sourceLocalId.VisVersion.Value,
                 sourceLocalId.SecondaryItem,
-                targetVersion
+                targetVersion,
+                cache
             );
             if (targetSecondaryitem is null)
                 return null;
@@ -103,24 +149,51 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
             .TryWithMetadataTag(sourceLocalId.Detail);
     }
 
-    public LocalId? ConvertLocalId(LocalId sourceLocalId, VisVersion targetVersion) =>
-        ConvertLocalId(sourceLocalId.Builder, targetVersion)?.Build();
+    public IReadOnlyList<GmodPath?> ConvertPaths(IEnumerable<GmodPath> sourcePaths, VisVersion targetVersion)
+    {
+        var cache = new PathConversionCache();
+        var result = new List<GmodPath?>();
+        foreach (var sourcePath in sourcePaths)
+            result.Add(ConvertPath(sourcePath.VisVersion, sourcePath, targetVersion, cache));
+        return result;
+    }
+
+    private GmodPath? ConvertPath(
+        VisVersion sourceVersion,
+        GmodPath sourcePath,
+        VisVersion targetVersion,
+        PathConversionCache? cache
+    )
+    {
+        if (cache is null)
+            return ConvertPath(sourceVersion, sourcePath, targetVersion);
+
+        var key = (sourceVersion, targetVersion, sourcePath);
+        if (!cache.TryGetValue(key, out var targetPath))
+        {
+            targetPath = ConvertPath(sourceVersion, sourcePath, targetVersion);
+            cache.Add(key, targetPath);
+        }
+        return targetPath;
+    }
 
     public GmodPath? ConvertPath(VisVersion sourceVersion, GmodPath sourcePath, VisVersion targetVersion)
     {
-        var targetEndNode = ConvertNode(sourceVersion, sourcePath.Node, targetVersion);
+        ValidateSourceAndTargetVersions(sourceVersion, targetVersion);
+        var map = GetConversionMap(sourceVersion, targetVersion);
+
+        var targetEndNode = ConvertNode(map, sourcePath.Node);
         if (targetEndNode is null)
             return null;
 
         if (targetEndNode.IsRoot)
-            return new GmodPath(targetEndNode._parents, targetEndNode, skipVerify: true);
+            return new GmodPath(new List<GmodNode>(), targetEndNode, skipVerify: true);
 
-        var targetGmod = VIS.Instance.GetGmod(targetVersion);
-        var sourceGmod = VIS.Instance.GetGmod(sourceVersion);
+        var targetGmod = map.TargetGmod;
 
         var qualifyingNodes = sourcePath
             .GetFullPath()
-            .Select((t, i) => (SourceNode: t.Node, TargetNode: ConvertNode(sourceVersion, t.Node, targetVersion)!))
+            .Select((t, i) => (SourceNode: t.Node, TargetNode: ConvertNode(map, t.Node)!))
             .ToArray();
         if (qualifyingNodes.Any(t => t.TargetNode is null))
             throw new Exception("Could convert node forward");
@@ -332,6 +405,113 @@ static void AddToPath(Gmod targetGmod, List<GmodNode> path, GmodNode node)
         return new GmodPath(potentialParents, targetEndNode);
     }
 
+    /// <summary>
+    /// Gets the direct node conversion from <paramref name="sourceVersion"/> to <paramref name="targetVersion"/>,
+    /// composed once from the single version steps in between and cached.
+    /// </summary>
+    private NodeConversionMap GetConversionMap(VisVersion sourceVersion, VisVersion targetVersion)
+    {
+        var sourceGmod = VIS.Instance.GetGmod(sourceVersion);
+        var targetGmod = VIS.Instance.GetGmod(targetVersion);
+
+        var key = (sourceVersion, targetVersion);
+        // The Gmods are cached with expiration, rebuild if they have been reloaded since
+        if (
+            _conversionMaps.TryGetValue(key, out var map)
+            && ReferenceEquals(map.SourceGmod, sourceGmod)
+            && ReferenceEquals(map.TargetGmod, targetGmod)
+        )
+            return map;
+
+        if (targetVersion - sourceVersion == 1)
+        {
+            GmodVersioningNode? versioningNode = TryGetVersioningNode(targetVersion, out var node) ? node : null;
+            map = NodeConversionMap.Step(sourceGmod, targetGmod, versioningNode);
+        }
+        else
+        {
+            map = NodeConversionMap.Compose(
+                GetConversionMap(sourceVersion, targetVersion - 1),
+                GetConversionMap(targetVersion - 1, targetVersion)
+            );
+        }
+
+        _conversionMaps[key] = map;
+        return map;
+    }
+
+    /// <summary>Node handle mapping from one Gmod to another, -1 for nodes that don't exist in the target Gmod</summary>
+    private sealed class NodeConversionMap
+    {
+        private readonly int[] _targetHandles;
+
+        public Gmod SourceGmod { get; }
+        public Gmod TargetGmod { get; }
+
+        public VisVersion SourceVersion => SourceGmod.VisVersion;
+        public VisVersion TargetVersion => TargetGmod.VisVersion;
+
+        private NodeConversionMap(Gmod sourceGmod, Gmod targetGmod, int[] targetHandles)
+        {
+            SourceGmod = sourceGmod;
+            TargetGmod = targetGmod;
+            _targetHandles = targetHandles;
+        }
+
+        public static NodeConversionMap Step(Gmod sourceGmod, Gmod targetGmod, GmodVersioningNode? versioningNode)
+        {
+            var targetHandles = new int[sourceGmod.Graph.NodeCount];
+            for (var handle = 0; handle < targetHandles.Length; handle++)
+            {
+                var code = sourceGmod.GetNodeAt(handle).Code;
+                // Naive approach as we dont have any context of the path
+                if (
+                    versioningNode is not null
+                    && versioningNode.Value.TryGetCodeChanges(code, out var change)
+                    && change.Target is not null
+                )
+                    code = change.Target;
+
+                targetHandles[handle] = targetGmod.TryGetHandle(code.AsSpan(), out var targetHandle)
+                    ? targetHandle
+                    : -1;
+            }
+            return new NodeConversionMap(sourceGmod, targetGmod, targetHandles);
+        }
+
+        public static NodeConversionMap Compose(NodeConversionMap first, NodeConversionMap second)
+        {
+            var targetHandles = new int[first._targetHandles.Length];
+            for (var handle = 0; handle < targetHandles.Length; handle++)
+            {
+                var intermediate = first._targetHandles[handle];
+                targetHandles[handle] = intermediate < 0 ? -1 : second._targetHandles[intermediate];
+            }
+            return new NodeConversionMap(first.SourceGmod, second.TargetGmod, targetHandles);
+        }
+
+        /// <returns>False if <paramref name="sourceNode"/> is not a node of the source Gmod</returns>
+        public bool TryConvert(GmodNode sourceNode, out GmodNode? targetNode)
+        {
+            targetNode = null;
+            var handle = sourceNode._handle;
+            if (
+                !ReferenceEquals(sourceNode._gmod, SourceGmod)
+                && !SourceGmod.TryGetHandle(sourceNode.Code.AsSpan(), out handle)
+            )
+                return false;
+
+            var targetHandle = _targetHandles[handle];
+            if (targetHandle >= 0)
+                targetNode = TargetGmod.GetNodeAt(targetHandle);
+            return true;
+        }
+    }
+
+    /// <summary>Converted paths of a bulk conversion, so that paths shared by many items are only converted once</summary>
+    internal sealed class PathConversionCache
+        : Dictionary<(VisVersion Source, VisVersion Target, GmodPath Path), GmodPath?> { }
+
     private bool TryGetVersioningNode(
         VisVersion visVersion,
         [MaybeNullWhen(false)] out GmodVersioningNode versioningNode
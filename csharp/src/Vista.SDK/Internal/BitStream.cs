@@ -0,0 +1,242 @@
+using System.Buffers;
+using System.Text;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>Most significant bit first writer into an <see cref="IBufferWriter{T}"/></summary>
+internal ref struct BitWriter
+{
+    private const int ChunkSize = 256;
+
+    private readonly IBufferWriter<byte> _destination;
+    private Span<byte> _span;
+    private int _position;
+    private ulong _bits;
+    private int _count;
+
+    public BitWriter(IBufferWriter<byte> destination)
+    {
+        _destination = destination;
+        _span = destination.GetSpan(ChunkSize);
+        _position = 0;
+        _bits = 0;
+        _count = 0;
+    }
+
+    public void WriteBit(bool value) => WriteBits(value ? 1UL : 0UL, 1);
+
+    /// <summary>Writes the low <paramref name="count"/> bits of <paramref name="value"/>, 1 to 64 of them</summary>
+    public void WriteBits(ulong value, int count)
+    {
+        if (count < 64)
+            value &= (1UL << count) - 1;
+
+        var free = 64 - _count;
+        if (count < free)
+        {
+            _bits = (_bits << count) | value;
+            _count += count;
+            return;
+        }
+
+        var rest = count - free;
+        WriteWord(free == 64 ? value : (_bits << free) | (value >> rest));
+        _bits = rest == 0 ? 0 : value & ((1UL << rest) - 1);
+        _count = rest;
+    }
+
+    public void WriteVarUInt(ulong value)
+    {
+        while (value >= 0x80)
+        {
+            WriteBits((value & 0x7F) | 0x80, 8);
+            value >>= 7;
+        }
+        WriteBits(value, 8);
+    }
+
+    public void WriteVarInt(long value) => WriteVarUInt(ZigZag(value));
+
+    public void WriteString(string value)
+    {
+        var length = Encoding.UTF8.GetByteCount(value);
+        WriteVarUInt((ulong)length);
+        if (length == 0)
+            return;
+
+        var bytes = ArrayPool<byte>.Shared.Rent(length);
+        Encoding.UTF8.GetBytes(value, 0, value.Length, bytes, 0);
+        for (var i = 0; i < length; i++)
+            WriteBits(bytes[i], 8);
+        ArrayPool<byte>.Shared.Return(bytes);
+    }
+
+    /// <summary>
+    /// Writes a delta of deltas in buckets, a single 0 bit when values advance by a constant step
+    /// </summary>
+    public void WriteDeltaOfDelta(long value)
+    {
+        if (value == 0)
+        {
+            WriteBits(0, 1);
+            return;
+        }
+
+        var zigZag = ZigZag(value);
+        if (zigZag < 1UL << 8)
+        {
+            WriteBits(0b10, 2);
+            WriteBits(zigZag, 8);
+        }
+        else if (zigZag < 1UL << 16)
+        {
+            WriteBits(0b110, 3);
+            WriteBits(zigZag, 16);
+        }
+        else if (zigZag < 1UL << 32)
+        {
+            WriteBits(0b1110, 4);
+            WriteBits(zigZag, 32);
+        }
+        else
+        {
+            WriteBits(0b1111, 4);
+            WriteBits(zigZag, 64);
+        }
+    }
+
+    /// <summary>Pads the last byte with zero bits and commits everything to the destination</summary>
+    public void Complete()
+    {
+        while (_count > 0)
+        {
+            var take = Math.Min(_count, 8);
+            var b = (byte)((_bits >> (_count - take)) << (8 - take));
+            _count -= take;
+            if (_position == _span.Length)
+                NextChunk();
+            _span[_position++] = b;
+        }
+        _bits = 0;
+        _destination.Advance(_position);
+        _position = 0;
+        _span = default;
+    }
+
+    private void WriteWord(ulong word)
+    {
+        if (_span.Length - _position < sizeof(ulong))
+            NextChunk();
+        System.Buffers.Binary.BinaryPrimitives.WriteUInt64BigEndian(_span.Slice(_position), word);
+        _position += sizeof(ulong);
+    }
+
+    private void NextChunk()
+    {
+        _destination.Advance(_position);
+        _span = _destination.GetSpan(ChunkSize);
+        _position = 0;
+    }
+
+    public static ulong ZigZag(long value) => (ulong)((value << 1) ^ (value >> 63));
+}
+
+/// <summary>Reader of what <see cref="BitWriter"/> writes</summary>
+internal ref struct BitReader
+{
+    private readonly ReadOnlySpan<byte> _source;
+    private int _index;
+    private ulong _bits;
+    private int _count;
+
+    public BitReader(ReadOnlySpan<byte> source)
+    {
+        _source = source;
+        _index = 0;
+        _bits = 0;
+        _count = 0;
+    }
+
+    public bool ReadBit() => ReadBits(1) != 0;
+
+    /// <summary>Number of bits left to read</summary>
+    public long RemainingBits => (long)(_source.Length - _index) * 8 + _count;
+
+    /// <summary>Reads <paramref name="count"/> bits, 1 to 64 of them</summary>
+    /// <exception cref="EndOfStreamException">Reading past the end of the source</exception>
+    public ulong ReadBits(int count)
+    {
+        if (count > 32)
+            return (ReadBits(count - 32) << 32) | ReadBits(32);
+
+        while (_count < count)
+        {
+            if (_index == _source.Length)
+                throw new EndOfStreamException("Unexpected end of encoded data");
+            _bits = (_bits << 8) | _source[_index++];
+            _count += 8;
+        }
+        _count -= count;
+        return (_bits >> _count) & ((1UL << count) - 1);
+    }
+
+    public ulong ReadVarUInt()
+    {
+        ulong result = 0;
+        for (var shift = 0; shift < 64; shift += 7)
+        {
+            var b = ReadBits(8);
+            result |= (b & 0x7F) << shift;
+            if (b < 0x80)
+                return result;
+        }
+        throw new InvalidDataException("Variable length integer is too long");
+    }
+
+    public long ReadVarInt() => UnZigZag(ReadVarUInt());
+
+    /// <summary>Reads a length or count, bounded like arrays are</summary>
+    public int ReadLength()
+    {
+        var value = ReadVarUInt();
+        if (value > int.MaxValue)
+            throw new InvalidDataException($"Invalid length {value}");
+        return (int)value;
+    }
+
+    public string ReadString()
+    {
+        var length = ReadLength();
+        if (length == 0)
+            return string.Empty;
+        if (length > _source.Length - _index + _count / 8)
+            throw new EndOfStreamException("Unexpected end of encoded data");
+
+        var bytes = ArrayPool<byte>.Shared.Rent(length);
+        try
+        {
+            for (var i = 0; i < length; i++)
+                bytes[i] = (byte)ReadBits(8);
+            return Encoding.UTF8.GetString(bytes, 0, length);
+        }
+        finally
+        {
+            ArrayPool<byte>.Shared.Return(bytes);
+        }
+    }
+
+    public long ReadDeltaOfDelta()
+    {
+        if (!ReadBit())
+            return 0;
+        if (!ReadBit())
+            return UnZigZag(ReadBits(8));
+        if (!ReadBit())
+            return UnZigZag(ReadBits(16));
+        if (!ReadBit())
+            return UnZigZag(ReadBits(32));
+        return UnZigZag(ReadBits(64));
+    }
+
+    public static long UnZigZag(ulong value) => (long)(value >> 1) ^ -(long)(value & 1);
+}
@@ -2,14 +2,38 @@
 using System.Diagnostics;
 using System.Diagnostics.CodeAnalysis;
 using System.Runtime.CompilerServices;
-using System.Runtime.InteropServices;
-#if NET6_0_OR_GREATER
-using System.Runtime.Intrinsics.X86;
-#endif
 
 namespace Vista.SDK.Internal;
 
-internal sealed class ChdDictionary<TValue>
+internal enum ChdHashAlgorithm : byte
+{
+    Fnv = 1,
+    Crc32 = 2,
+}
+
+/// <summary>Perfect hash dictionary keyed by Gmod codes, hashed by <see cref="ChdCodeHasher"/></summary>
+internal sealed class ChdDictionary<TValue> : ChdDictionary<TValue, ChdCodeHasher>
+{
+    public ChdDictionary(IReadOnlyList<(string Key, TValue Value)> items)
+        : base(items) { }
+
+    /// <summary>
+    /// Creates a dictionary from a table and seeds computed ahead of time, i.e. read from a Gmod snapshot.
+    /// The layout is only valid if it was computed with the same <see cref="HashAlgorithm"/> as the current process uses.
+    /// </summary>
+    internal ChdDictionary((string Key, TValue Value)[] table, int[] seeds)
+        : base(table, seeds) { }
+
+    /// <summary>The hash function used for keys in this process, the seeds of a table depends on it</summary>
+    internal static ChdHashAlgorithm HashAlgorithm => ChdCodeHasher.Algorithm;
+}
+
+/// <summary>
+/// Compress, hash and displace perfect hash dictionary, looked up by spans without allocating.
+/// Keys must be unique and non-empty.
+/// </summary>
+internal class ChdDictionary<TValue, THasher>
+    where THasher : struct, IChdHasher
 {
     internal readonly (string Key, TValue Value)[] _table;
     internal readonly int[] _seeds;
@@ -53,7 +77,7 @@ public ChdDictionary(IReadOnlyList<(string Key, TValue Value)> items)
 
                 foreach (var k in subKeys)
                 {
-                    var hash = Hashing.Seed(seed, k.Hash, size);
+                    var hash = ChdHashing.Seed(seed, k.Hash, size);
 
                     if (!entries.ContainsKey(hash) && indices[hash] == 0)
                     {
@@ -102,6 +126,15 @@ public ChdDictionary(IReadOnlyList<(string Key, TValue Value)> items)
         _seeds = seeds;
     }
 
+    protected ChdDictionary((string Key, TValue Value)[] table, int[] seeds)
+    {
+        Debug.Assert(table.Length == seeds.Length);
+        Debug.Assert((table.Length & (table.Length - 1)) == 0);
+
+        _table = table;
+        _seeds = seeds;
+    }
+
     public TValue this[ReadOnlySpan<char> key]
     {
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
@@ -144,7 +177,7 @@ public bool TryGetValue(ReadOnlySpan<char> key, [MaybeNullWhen(false)] out TValu
         }
         else
         {
-            index = Hashing.Seed((uint)seed, hash, (ulong)size);
+            index = ChdHashing.Seed((uint)seed, hash, (ulong)size);
             ref readonly var kvp = ref _table[index];
             if (!key.SequenceEqual(kvp.Key.AsSpan()))
             {
@@ -203,55 +236,7 @@ public bool MoveNext()
     }
 
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
-    internal static uint Hash(ReadOnlySpan<char> key)
-    {
-        Debug.Assert(sizeof(char) == 2);
-        var length = key.Length * sizeof(char);
-        ref var curr = ref Unsafe.As<char, byte>(ref MemoryMarshal.GetReference(key));
-
-        uint hash = 0x811C9DC5;
-        while (length > 0)
-        {
-#if NET6_0_OR_GREATER
-            if (Sse42.IsSupported)
-                hash = Hashing.Crc32(hash, curr);
-            else
-                hash = Hashing.Fnv(hash, curr);
-#else
-            hash = Hashing.Fnv(hash, curr);
-#endif
-
-            curr = ref Unsafe.Add(ref curr, 2);
-            length -= 2;
-        }
-
-        return hash;
-    }
-
-    internal static class Hashing
-    {
-        [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        internal static uint LarssonHash(uint hash, byte ch) => 37 * hash + ch;
-
-        [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        internal static uint Fnv(uint hash, byte ch) => (ch ^ hash) * 0x01000193;
-
-#if NET6_0_OR_GREATER
-        [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        internal static uint Crc32(uint hash, byte ch) => Sse42.Crc32(hash, ch);
-#endif
-
-        [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        internal static uint Seed(uint seed, uint hash, ulong size)
-        {
-            var x = seed + hash;
-            x ^= x >> 12;
-            x ^= x << 25;
-            x ^= x >> 27;
-
-            return (uint)((x * 0x2545F4914F6CDD1DUL) & (size - 1));
-        }
-    }
+    internal static uint Hash(ReadOnlySpan<char> key) => default(THasher).Hash(key);
 
     internal static class ThrowHelper
     {
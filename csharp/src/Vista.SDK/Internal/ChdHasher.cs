@@ -0,0 +1,319 @@
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+#if NET6_0_OR_GREATER
+using System.Runtime.Intrinsics.X86;
+using ArmCrc32 = System.Runtime.Intrinsics.Arm.Crc32;
+#endif
+#if NET8_0_OR_GREATER
+using System.Runtime.Intrinsics;
+using System.Runtime.Intrinsics.Arm;
+#endif
+
+namespace Vista.SDK.Internal;
+
+/// <summary>Hash function for the keys of a <see cref="ChdDictionary{TValue, THasher}"/></summary>
+internal interface IChdHasher
+{
+    uint Hash(ReadOnlySpan<char> key);
+}
+
+/// <summary>
+/// Hashes the low byte of each char with CRC32C where the CPU has an instruction for it, FNV-1a otherwise.
+/// Fastest for short keys like Gmod codes, and the hash Gmod snapshots precompute their lookup tables with,
+/// so it must not change without a new <see cref="ChdHashAlgorithm"/>.
+/// </summary>
+internal readonly struct ChdCodeHasher : IChdHasher
+{
+    /// <summary>The variant used in this process</summary>
+    public static ChdHashAlgorithm Algorithm =>
+        ChdHashing.IsCrc32Supported ? ChdHashAlgorithm.Crc32 : ChdHashAlgorithm.Fnv;
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public uint Hash(ReadOnlySpan<char> key)
+    {
+        Debug.Assert(sizeof(char) == 2);
+        var length = key.Length * sizeof(char);
+        ref var curr = ref Unsafe.As<char, byte>(ref MemoryMarshal.GetReference(key));
+
+        uint hash = 0x811C9DC5;
+        while (length > 0)
+        {
+#if NET6_0_OR_GREATER
+            if (ChdHashing.IsCrc32Supported)
+                hash = ChdHashing.Crc32(hash, curr);
+            else
+                hash = ChdHashing.Fnv(hash, curr);
+#else
+            hash = ChdHashing.Fnv(hash, curr);
+#endif
+
+            curr = ref Unsafe.Add(ref curr, 2);
+            length -= 2;
+        }
+
+        return hash;
+    }
+}
+
+/// <summary>
+/// Hashes keys of any length, such as local IDs or codebook values.
+/// Short keys use <see cref="ChdCodeHasher"/>, longer ones a multiply-mix hash in the style of xxHash3 over
+/// all bits of the key, vectorized with SSE2 or AdvSimd where available.
+/// Results are only stable within a process, never persist them.
+/// </summary>
+internal readonly struct ChdStringHasher : IChdHasher
+{
+    /// <summary>Keys shorter than this, in chars, are hashed by <see cref="ChdCodeHasher"/></summary>
+    public const int LongKeyLength = 16;
+
+    private const int StripeLength = 64;
+
+    private const ulong Prime1 = 0x9E3779B185EBCA87UL;
+    private const ulong Prime2 = 0xC2B2AE3D27D4EB4FUL;
+    private const ulong Prime3 = 0x165667B19E3779F9UL;
+    private const ulong Prime4 = 0x85EBCA77C2B2AE63UL;
+    private const ulong Prime5 = 0x27D4EB2F165667C5UL;
+
+    private const ulong Key0 = 0xBE4BA423396CFEB8UL;
+    private const ulong Key1 = 0x1CAD21F72C81017CUL;
+    private const ulong Key2 = 0xDB979083E96DD4DEUL;
+    private const ulong Key3 = 0x1F67B3B7A4A44072UL;
+    private const ulong Key4 = 0x78E5C0CC4EE679CBUL;
+    private const ulong Key5 = 0x2172FFCC7DD05A82UL;
+    private const ulong Key6 = 0x8E2443F7744608B8UL;
+    private const ulong Key7 = 0x4C263A81E69035E0UL;
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public uint Hash(ReadOnlySpan<char> key) =>
+        key.Length < LongKeyLength ? default(ChdCodeHasher).Hash(key) : HashLong(MemoryMarshal.AsBytes(key));
+
+    /// <summary>Same as <see cref="Hash"/> without vectorization, for tests and benchmarks</summary>
+    internal static uint HashScalar(ReadOnlySpan<char> key)
+    {
+        if (key.Length < LongKeyLength)
+            return default(ChdCodeHasher).Hash(key);
+
+        var data = MemoryMarshal.AsBytes(key);
+        return data.Length < StripeLength ? HashMedium(data) : HashStripes(data);
+    }
+
+    private static uint HashLong(ReadOnlySpan<byte> data)
+    {
+        if (data.Length < StripeLength)
+            return HashMedium(data);
+#if NET8_0_OR_GREATER
+        if (Vector128.IsHardwareAccelerated)
+            return HashStripesVectorized(data);
+#endif
+        return HashStripes(data);
+    }
+
+    /// <summary>32 to 63 bytes, covered by four overlapping 16 byte blocks</summary>
+    private static uint HashMedium(ReadOnlySpan<byte> data)
+    {
+        var length = data.Length;
+        var hash = (ulong)length * Prime1;
+        hash += Mix(Read(data, 0) ^ Key0, Read(data, 8) ^ Key1);
+        hash += Mix(Read(data, 16) ^ Key2, Read(data, 24) ^ Key3);
+        hash += Mix(Read(data, length - 32) ^ Key4, Read(data, length - 24) ^ Key5);
+        hash += Mix(Read(data, length - 16) ^ Key6, Read(data, length - 8) ^ Key7);
+        return Fold(Avalanche(hash));
+    }
+
+    /// <summary>
+    /// Accumulates 64 byte stripes into eight lanes, the last stripe overlapping the one before it.
+    /// The reference for the vectorized version, which must give the same result.
+    /// </summary>
+    private static uint HashStripes(ReadOnlySpan<byte> data)
+    {
+        Debug.Assert(data.Length >= StripeLength);
+
+        ulong acc0 = Prime3 >> 32,
+            acc1 = Prime1,
+            acc2 = Prime2,
+            acc3 = Prime3,
+            acc4 = Prime4,
+            acc5 = Prime2 >> 32,
+            acc6 = Prime5,
+            acc7 = Prime1 >> 32;
+
+        var stripes = (data.Length - 1) / StripeLength;
+        for (var s = 0; s <= stripes; s++)
+        {
+            var offset = s == stripes ? data.Length - StripeLength : s * StripeLength;
+            Accumulate(ref acc0, ref acc1, Read(data, offset), Read(data, offset + 8), Key0, Key1);
+            Accumulate(ref acc2, ref acc3, Read(data, offset + 16), Read(data, offset + 24), Key2, Key3);
+            Accumulate(ref acc4, ref acc5, Read(data, offset + 32), Read(data, offset + 40), Key4, Key5);
+            Accumulate(ref acc6, ref acc7, Read(data, offset + 48), Read(data, offset + 56), Key6, Key7);
+        }
+
+        return Merge((ulong)data.Length, acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static void Accumulate(ref ulong acc0, ref ulong acc1, ulong data0, ulong data1, ulong key0, ulong key1)
+    {
+        var k0 = data0 ^ key0;
+        var k1 = data1 ^ key1;
+        acc0 += data1 + (k0 & 0xFFFFFFFF) * (k0 >> 32);
+        acc1 += data0 + (k1 & 0xFFFFFFFF) * (k1 >> 32);
+    }
+
+#if NET8_0_OR_GREATER
+    private static uint HashStripesVectorized(ReadOnlySpan<byte> data)
+    {
+        Debug.Assert(data.Length >= StripeLength);
+
+        var acc0 = Vector128.Create(Prime3 >> 32, Prime1);
+        var acc1 = Vector128.Create(Prime2, Prime3);
+        var acc2 = Vector128.Create(Prime4, Prime2 >> 32);
+        var acc3 = Vector128.Create(Prime5, Prime1 >> 32);
+        var key0 = Vector128.Create(Key0, Key1);
+        var key1 = Vector128.Create(Key2, Key3);
+        var key2 = Vector128.Create(Key4, Key5);
+        var key3 = Vector128.Create(Key6, Key7);
+
+        ref var source = ref MemoryMarshal.GetReference(data);
+        var stripes = (data.Length - 1) / StripeLength;
+        for (var s = 0; s <= stripes; s++)
+        {
+            var offset = (nuint)(s == stripes ? data.Length - StripeLength : s * StripeLength);
+            acc0 = Accumulate(acc0, Vector128.LoadUnsafe(ref source, offset).AsUInt64(), key0);
+            acc1 = Accumulate(acc1, Vector128.LoadUnsafe(ref source, offset + 16).AsUInt64(), key1);
+            acc2 = Accumulate(acc2, Vector128.LoadUnsafe(ref source, offset + 32).AsUInt64(), key2);
+            acc3 = Accumulate(acc3, Vector128.LoadUnsafe(ref source, offset + 48).AsUInt64(), key3);
+        }
+
+        return Merge(
+            (ulong)data.Length,
+            acc0.GetElement(0),
+            acc0.GetElement(1),
+            acc1.GetElement(0),
+            acc1.GetElement(1),
+            acc2.GetElement(0),
+            acc2.GetElement(1),
+            acc3.GetElement(0),
+            acc3.GetElement(1)
+        );
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static Vector128<ulong> Accumulate(Vector128<ulong> acc, Vector128<ulong> data, Vector128<ulong> key)
+    {
+        var k = data ^ key;
+        if (Sse2.IsSupported)
+        {
+            var product = Sse2.Multiply(k.AsUInt32(), Sse2.ShiftRightLogical(k, 32).AsUInt32());
+            var swapped = Sse2.Shuffle(data.AsUInt32(), 0b01_00_11_10).AsUInt64();
+            return acc + swapped + product;
+        }
+        if (AdvSimd.IsSupported)
+        {
+            var product = AdvSimd.MultiplyWideningLower(
+                AdvSimd.ExtractNarrowingLower(k),
+                AdvSimd.ShiftRightLogicalNarrowingLower(k, 32)
+            );
+            var swapped = AdvSimd.ExtractVector128(data, data, 1);
+            return acc + swapped + product;
+        }
+        return acc
+            + Vector128.Shuffle(data, Vector128.Create(1UL, 0UL))
+            + (k & Vector128.Create(0xFFFFFFFFUL)) * (k >> 32);
+    }
+#endif
+
+    private static uint Merge(
+        ulong length,
+        ulong acc0,
+        ulong acc1,
+        ulong acc2,
+        ulong acc3,
+        ulong acc4,
+        ulong acc5,
+        ulong acc6,
+        ulong acc7
+    )
+    {
+        var hash = length * Prime1;
+        hash += Mix(acc0 ^ Key0, acc1 ^ Key1);
+        hash += Mix(acc2 ^ Key2, acc3 ^ Key3);
+        hash += Mix(acc4 ^ Key4, acc5 ^ Key5);
+        hash += Mix(acc6 ^ Key6, acc7 ^ Key7);
+        return Fold(Avalanche(hash));
+    }
+
+    /// <summary>Folds the 128 bit product of <paramref name="a"/> and <paramref name="b"/></summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static ulong Mix(ulong a, ulong b)
+    {
+#if NET8_0_OR_GREATER
+        var high = Math.BigMul(a, b, out var low);
+        return high ^ low;
+#else
+        ulong aLow = (uint)a,
+            aHigh = a >> 32,
+            bLow = (uint)b,
+            bHigh = b >> 32;
+        var lowLow = aLow * bLow;
+        var highLow = aHigh * bLow;
+        var lowHigh = aLow * bHigh;
+        var cross = (lowLow >> 32) + (uint)highLow + lowHigh;
+        var high = aHigh * bHigh + (highLow >> 32) + (cross >> 32);
+        var low = (cross << 32) | (uint)lowLow;
+        return high ^ low;
+#endif
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static ulong Avalanche(ulong hash)
+    {
+        hash ^= hash >> 37;
+        hash *= 0x165667919E3779F9UL;
+        return hash ^ (hash >> 32);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static uint Fold(ulong hash) => (uint)(hash ^ (hash >> 32));
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static ulong Read(ReadOnlySpan<byte> data, int offset) =>
+        Unsafe.ReadUnaligned<ulong>(ref Unsafe.Add(ref MemoryMarshal.GetReference(data), offset));
+}
+
+internal static class ChdHashing
+{
+    internal static bool IsCrc32Supported
+    {
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+#if NET6_0_OR_GREATER
+        get => Sse42.IsSupported || ArmCrc32.IsSupported;
+#else
+        get => false;
+#endif
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    internal static uint LarssonHash(uint hash, byte ch) => 37 * hash + ch;
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    internal static uint Fnv(uint hash, byte ch) => (ch ^ hash) * 0x01000193;
+
+#if NET6_0_OR_GREATER
+    /// <summary>CRC32C of one byte, the SSE4.2 and ARMv8 instructions compute the same value</summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    internal static uint Crc32(uint hash, byte ch) =>
+        Sse42.IsSupported ? Sse42.Crc32(hash, ch) : ArmCrc32.ComputeCrc32C(hash, ch);
+#endif
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    internal static uint Seed(uint seed, uint hash, ulong size)
+    {
+        var x = seed + hash;
+        x ^= x >> 12;
+        x ^= x << 25;
+        x ^= x >> 27;
+
+        return (uint)((x * 0x2545F4914F6CDD1DUL) & (size - 1));
+    }
+}
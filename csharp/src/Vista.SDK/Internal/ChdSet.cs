@@ -0,0 +1,42 @@
+using System.Diagnostics.CodeAnalysis;
+using System.Runtime.CompilerServices;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// Perfect hash set of strings that can be queried by spans, see <see cref="ChdDictionary{TValue, THasher}"/>.
+/// Duplicates are ignored, items keep the order they were first added in.
+/// Empty strings are never contained.
+/// </summary>
+internal sealed class ChdSet
+{
+    private readonly ChdDictionary<string, ChdStringHasher> _dictionary;
+    private readonly string[] _items;
+
+    public ChdSet(IEnumerable<string> items)
+    {
+        var seen = new HashSet<string>(StringComparer.Ordinal);
+        var unique = new List<string>();
+        foreach (var item in items)
+        {
+            if (item.Length > 0 && seen.Add(item))
+                unique.Add(item);
+        }
+
+        _items = unique.ToArray();
+        _dictionary = new ChdDictionary<string, ChdStringHasher>(unique.Select(i => (i, i)).ToArray());
+    }
+
+    public int Count => _items.Length;
+
+    /// <summary>In the order they were added</summary>
+    public string[] Items => _items;
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public bool Contains(ReadOnlySpan<char> item) => _dictionary.TryGetValue(item, out _);
+
+    /// <summary>Gets the instance in the set equal to <paramref name="item"/>, so callers need no copy</summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public bool TryGetValue(ReadOnlySpan<char> item, [NotNullWhen(true)] out string? value) =>
+        _dictionary.TryGetValue(item, out value);
+}
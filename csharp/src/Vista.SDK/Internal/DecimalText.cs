@@ -0,0 +1,90 @@
+using System.Globalization;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// Plain decimal text, <c>-?(0|[1-9][0-9]*)(\.[0-9]+)?</c>, as a mantissa scaled down by a number of digits,
+/// for example 100.50 as 10050 and 2.
+/// Only text <see cref="Format"/> reproduces exactly is accepted, so no leading zeros, + or -0.
+/// </summary>
+internal static class DecimalText
+{
+    // Keeps the mantissa within a long
+    public const int MaxDigits = 18;
+
+    public static bool TryParse(string value, out long mantissa, out int scale)
+    {
+        mantissa = 0;
+        scale = 0;
+
+        var i = 0;
+        var negative = value.Length > 0 && value[0] == '-';
+        if (negative)
+            i++;
+
+        var integerStart = i;
+        while (i < value.Length && IsDigit(value[i]))
+            i++;
+        var integerDigits = i - integerStart;
+        if (integerDigits == 0 || (integerDigits > 1 && value[integerStart] == '0'))
+            return false;
+
+        if (i < value.Length)
+        {
+            if (value[i] != '.')
+                return false;
+            var fractionStart = ++i;
+            while (i < value.Length && IsDigit(value[i]))
+                i++;
+            if (i != value.Length || i == fractionStart)
+                return false;
+            scale = i - fractionStart;
+        }
+
+        if (integerDigits + scale > MaxDigits)
+            return false;
+
+        for (var j = integerStart; j < value.Length; j++)
+        {
+            if (value[j] != '.')
+                mantissa = mantissa * 10 + (value[j] - '0');
+        }
+        if (negative)
+        {
+            if (mantissa == 0)
+                return false;
+            mantissa = -mantissa;
+        }
+        return true;
+    }
+
+    public static string Format(long mantissa, int scale)
+    {
+        if (scale == 0)
+            return mantissa.ToString(CultureInfo.InvariantCulture);
+
+        var digits = (mantissa < 0 ? (ulong)-mantissa : (ulong)mantissa).ToString(CultureInfo.InvariantCulture);
+        if (digits.Length <= scale)
+            digits = digits.PadLeft(scale + 1, '0');
+        var text = digits.Insert(digits.Length - scale, ".");
+        return mantissa < 0 ? "-" + text : text;
+    }
+
+    /// <summary>Whether <paramref name="value"/> is exactly the round-trip formatting of a double</summary>
+    public static bool TryParseDouble(string value, out double result)
+    {
+        if (!double.TryParse(value, NumberStyles.Float, CultureInfo.InvariantCulture, out result))
+            return false;
+#if NET8_0_OR_GREATER
+        Span<char> buffer = stackalloc char[32];
+        return result.TryFormat(buffer, out var written, "R", CultureInfo.InvariantCulture)
+            && buffer.Slice(0, written).SequenceEqual(value.AsSpan());
+#else
+        return result.ToString("R", CultureInfo.InvariantCulture) == value;
+#endif
+    }
+
+    public static string FormatDouble(double value) => value.ToString("R", CultureInfo.InvariantCulture);
+
+    private static bool IsDigit(char ch) => ch is >= '0' and <= '9';
+}
@@ -0,0 +1,245 @@
+using System.Runtime.CompilerServices;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>Category of a Gmod node, each word of the category string is a flag</summary>
+[Flags]
+internal enum GmodNodeCategory : byte
+{
+    None = 0,
+    Product = 1 << 0,
+    Asset = 1 << 1,
+    Function = 1 << 2,
+
+    /// <summary>Set if the category string is not one of the known categories</summary>
+    Other = 1 << 3,
+
+    ProductFunction = Product | Function,
+    AssetFunction = Asset | Function,
+}
+
+internal enum GmodNodeType : byte
+{
+    Other,
+    Selection,
+    Group,
+    Leaf,
+    Type,
+    Composition,
+}
+
+/// <summary>
+/// Struct-of-arrays view of the Gmod graph, nodes are dense integer handles.
+/// Children and parents are stored in CSR form (offsets per node into a shared index array),
+/// in the same order as the relations of the Gmod, and category/type are enums
+/// so that traversal and path parsing don't need to chase node objects or compare strings.
+/// </summary>
+internal sealed class GmodGraph
+{
+    private readonly int[]? _childOffsets;
+    private readonly int[]? _children;
+    private readonly int[]? _parentOffsets;
+    private readonly int[]? _parents;
+
+    // Adjacency is read from the store instead of the arrays above when the Gmod is memory mapped
+    private readonly GmodStore? _store;
+
+    private readonly GmodNodeCategory[] _categories;
+    private readonly GmodNodeType[] _types;
+
+    // Lazily computed ancestor bitsets per node, see GetAncestors
+    private readonly ulong[]?[] _ancestors;
+
+    public int NodeCount => _categories.Length;
+
+    private GmodGraph(
+        GmodNodeCategory[] categories,
+        GmodNodeType[] types,
+        int[]? childOffsets,
+        int[]? children,
+        int[]? parentOffsets,
+        int[]? parents,
+        GmodStore? store
+    )
+    {
+        _categories = categories;
+        _types = types;
+        _childOffsets = childOffsets;
+        _children = children;
+        _parentOffsets = parentOffsets;
+        _parents = parents;
+        _store = store;
+        _ancestors = new ulong[]?[categories.Length];
+    }
+
+    /// <summary>Builds the graph from node metadata and (parent, child) handle pairs</summary>
+    public static GmodGraph Create(
+        IReadOnlyList<GmodNodeMetadata> metadata,
+        IReadOnlyList<(int Parent, int Child)> relations
+    )
+    {
+        var nodeCount = metadata.Count;
+        var categories = new GmodNodeCategory[nodeCount];
+        var types = new GmodNodeType[nodeCount];
+        for (int i = 0; i < nodeCount; i++)
+        {
+            categories[i] = ParseCategory(metadata[i].Category);
+            types[i] = ParseType(metadata[i].Type);
+        }
+
+        var childOffsets = new int[nodeCount + 1];
+        var parentOffsets = new int[nodeCount + 1];
+        foreach (var (parent, child) in relations)
+        {
+            childOffsets[parent + 1]++;
+            parentOffsets[child + 1]++;
+        }
+        for (int i = 0; i < nodeCount; i++)
+        {
+            childOffsets[i + 1] += childOffsets[i];
+            parentOffsets[i + 1] += parentOffsets[i];
+        }
+
+        var children = new int[relations.Count];
+        var parents = new int[relations.Count];
+        var childPositions = childOffsets.ToArray();
+        var parentPositions = parentOffsets.ToArray();
+        foreach (var (parent, child) in relations)
+        {
+            children[childPositions[parent]++] = child;
+            parents[parentPositions[child]++] = parent;
+        }
+
+        return new GmodGraph(categories, types, childOffsets, children, parentOffsets, parents, null);
+    }
+
+    /// <summary>
+    /// Builds the graph from <paramref name="store"/>, if <paramref name="inPlace"/> is set the adjacency is read
+    /// from the store which must then outlive the graph, otherwise it is copied
+    /// </summary>
+    public static GmodGraph Create(GmodStore store, bool inPlace)
+    {
+        var categories = new GmodNodeCategory[store.NodeCount];
+        var types = new GmodNodeType[store.NodeCount];
+        for (int i = 0; i < categories.Length; i++)
+        {
+            ref readonly var node = ref store.GetNode(i);
+            categories[i] = ParseCategory(store.GetString(node.Category));
+            types[i] = ParseType(store.GetString(node.Type));
+        }
+
+        if (inPlace)
+            return new GmodGraph(categories, types, null, null, null, null, store);
+
+        return new GmodGraph(
+            categories,
+            types,
+            store.ChildOffsets.ToArray(),
+            store.ChildIndices.ToArray(),
+            store.ParentOffsets.ToArray(),
+            store.ParentIndices.ToArray(),
+            null
+        );
+    }
+
+    internal static GmodNodeCategory ParseCategory(string? category) =>
+        category switch
+        {
+            "PRODUCT" => GmodNodeCategory.Product,
+            "ASSET" => GmodNodeCategory.Asset,
+            "PRODUCT FUNCTION" => GmodNodeCategory.ProductFunction,
+            "ASSET FUNCTION" => GmodNodeCategory.AssetFunction,
+            null => GmodNodeCategory.Other,
+            _
+                => GmodNodeCategory.Other
+                    | (category.Contains("PRODUCT") ? GmodNodeCategory.Product : 0)
+                    | (category.Contains("ASSET") ? GmodNodeCategory.Asset : 0)
+                    | (category.Contains("FUNCTION") ? GmodNodeCategory.Function : 0),
+        };
+
+    internal static GmodNodeType ParseType(string? type) =>
+        type switch
+        {
+            "SELECTION" => GmodNodeType.Selection,
+            "GROUP" => GmodNodeType.Group,
+            "LEAF" => GmodNodeType.Leaf,
+            "TYPE" => GmodNodeType.Type,
+            "COMPOSITION" => GmodNodeType.Composition,
+            _ => GmodNodeType.Other,
+        };
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public ReadOnlySpan<int> GetChildren(int node)
+    {
+        if (_children is null)
+            return _store!.GetChildren(node);
+
+        var start = _childOffsets![node];
+        return _children.AsSpan(start, _childOffsets[node + 1] - start);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public ReadOnlySpan<int> GetParents(int node)
+    {
+        if (_parents is null)
+            return _store!.GetParents(node);
+
+        var start = _parentOffsets![node];
+        return _parents.AsSpan(start, _parentOffsets[node + 1] - start);
+    }
+
+    public bool IsChild(int parent, int child) => GetChildren(parent).IndexOf(child) >= 0;
+
+    /// <summary>
+    /// Every node that has a path down to <paramref name="node"/>, as a bitset over handles:
+    /// test with <see cref="IsAncestor(ulong[], int)"/>. Computed on first use and cached.
+    /// </summary>
+    public ulong[] GetAncestors(int node)
+    {
+        var ancestors = Volatile.Read(ref _ancestors[node]);
+        if (ancestors is not null)
+            return ancestors;
+
+        ancestors = new ulong[(NodeCount + 63) >> 6];
+        var stack = new Stack<int>();
+        stack.Push(node);
+        while (stack.Count > 0)
+        {
+            foreach (var parent in GetParents(stack.Pop()))
+            {
+                ref var word = ref ancestors[parent >> 6];
+                var bit = 1UL << (parent & 63);
+                if ((word & bit) != 0)
+                    continue;
+                word |= bit;
+                stack.Push(parent);
+            }
+        }
+
+        // Racing threads compute the same set, whichever is published is fine
+        Volatile.Write(ref _ancestors[node], ancestors);
+        return ancestors;
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static bool IsAncestor(ulong[] ancestors, int node) => (ancestors[node >> 6] & (1UL << (node & 63))) != 0;
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public GmodNodeCategory GetCategory(int node) => _categories[node];
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public GmodNodeType GetNodeType(int node) => _types[node];
+
+    /// <summary>Equivalent of <see cref="Gmod.IsLeafNode(GmodNodeMetadata)"/></summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public bool IsLeafNode(int node) =>
+        _types[node] == GmodNodeType.Leaf
+        && _categories[node] is GmodNodeCategory.AssetFunction or GmodNodeCategory.ProductFunction;
+
+    /// <summary>Equivalent of <see cref="Gmod.IsProductSelectionAssignment(GmodNode?, GmodNode?)"/></summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public bool IsProductSelectionAssignment(int parent, int child) =>
+        (_categories[parent] & GmodNodeCategory.Function) != 0
+        && (_categories[child] & GmodNodeCategory.Product) != 0
+        && _types[child] == GmodNodeType.Selection;
+}
@@ -0,0 +1,304 @@
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// Compact binary representation of a Gmod, produced at build time by Vista.SDK.SnapshotGenerator
+/// from the gmod-vis-*.json.gz resources.
+/// It holds interned strings, the node table, children/parents adjacency and the prebuilt <see cref="ChdDictionary{TValue}"/>
+/// layout for node code lookups, so that a Gmod can be constructed without JSON parsing or rebuilding the perfect hash.
+/// The written layout is random access (see <see cref="GmodSnapshotHeader"/>) so that it can be read in place
+/// from the assembly image or a memory mapped file by GmodStore.
+/// </summary>
+internal sealed class GmodSnapshot
+{
+    internal const uint Magic = 0x534D4756; // "VGMS"
+    internal const ushort FormatVersion = 2;
+    internal const string FileExtension = ".snapshot";
+
+    public string VisVersion { get; }
+
+    public string[] Strings { get; }
+
+    public GmodSnapshotNode[] Nodes { get; }
+
+    /// <summary>Key and value string indices in pairs, <see cref="GmodSnapshotNode.NormalAssignmentNamesOffset"/> is a pair index</summary>
+    public int[] NormalAssignmentNames { get; }
+
+    /// <summary>Parent and child node indices in pairs, in the same order as the relations of the Gmod resource</summary>
+    public int[] Relations { get; }
+
+    public ChdHashAlgorithm HashAlgorithm { get; }
+
+    public int[] ChdSeeds { get; }
+
+    /// <summary>Node index per slot of the <see cref="ChdDictionary{TValue}"/> table, -1 for empty slots</summary>
+    public int[] ChdTable { get; }
+
+    private GmodSnapshot(
+        string visVersion,
+        string[] strings,
+        GmodSnapshotNode[] nodes,
+        int[] normalAssignmentNames,
+        int[] relations,
+        ChdHashAlgorithm hashAlgorithm,
+        int[] chdSeeds,
+        int[] chdTable
+    )
+    {
+        VisVersion = visVersion;
+        Strings = strings;
+        Nodes = nodes;
+        NormalAssignmentNames = normalAssignmentNames;
+        Relations = relations;
+        HashAlgorithm = hashAlgorithm;
+        ChdSeeds = chdSeeds;
+        ChdTable = chdTable;
+    }
+
+    public static GmodSnapshot Create(GmodDto dto)
+    {
+        var strings = new List<string>();
+        var stringIndices = new Dictionary<string, int>(StringComparer.Ordinal);
+
+        int Intern(string? value)
+        {
+            if (value is null)
+                return -1;
+            if (stringIndices.TryGetValue(value, out var index))
+                return index;
+
+            index = strings.Count;
+            strings.Add(value);
+            stringIndices.Add(value, index);
+            return index;
+        }
+
+        var visVersion = Intern(dto.VisVersion);
+        var nodes = new GmodSnapshotNode[dto.Items.Length];
+        var nodeIndices = new Dictionary<string, int>(dto.Items.Length, StringComparer.Ordinal);
+        var normalAssignmentNames = new List<int>();
+        for (int i = 0; i < dto.Items.Length; i++)
+        {
+            var item = dto.Items[i];
+            var offset = normalAssignmentNames.Count / 2;
+            if (item.NormalAssignmentNames is not null)
+            {
+                foreach (var kvp in item.NormalAssignmentNames)
+                {
+                    normalAssignmentNames.Add(Intern(kvp.Key));
+                    normalAssignmentNames.Add(Intern(kvp.Value));
+                }
+            }
+
+            nodes[i] = new GmodSnapshotNode(
+                Intern(item.Code),
+                Intern(item.Category),
+                Intern(item.Type),
+                Intern(item.Name),
+                Intern(item.CommonName),
+                Intern(item.Definition),
+                Intern(item.CommonDefinition),
+                item.InstallSubstructure switch
+                {
+                    null => 0,
+                    false => 1,
+                    true => 2,
+                },
+                offset,
+                normalAssignmentNames.Count / 2 - offset
+            );
+            nodeIndices.Add(item.Code, i);
+        }
+
+        var relations = new int[dto.Relations.Length * 2];
+        for (int i = 0; i < dto.Relations.Length; i++)
+        {
+            relations[i * 2] = nodeIndices[dto.Relations[i][0]];
+            relations[i * 2 + 1] = nodeIndices[dto.Relations[i][1]];
+        }
+
+        var chd = new ChdDictionary<int>(dto.Items.Select((item, i) => (item.Code, i)).ToArray());
+        var chdTable = new int[chd._table.Length];
+        for (int i = 0; i < chdTable.Length; i++)
+            chdTable[i] = chd._table[i].Key is null ? -1 : chd._table[i].Value;
+
+        return new GmodSnapshot(
+            strings[visVersion],
+            strings.ToArray(),
+            nodes,
+            normalAssignmentNames.ToArray(),
+            relations,
+            ChdDictionary<int>.HashAlgorithm,
+            chd._seeds.ToArray(),
+            chdTable
+        );
+    }
+
+    public void WriteTo(Stream stream)
+    {
+        var encoding = new UTF8Encoding(false);
+        var stringOffsets = new int[Strings.Length + 1];
+        var stringData = new MemoryStream();
+        for (int i = 0; i < Strings.Length; i++)
+        {
+            stringOffsets[i] = (int)stringData.Length;
+            var bytes = encoding.GetBytes(Strings[i]);
+            stringData.Write(bytes, 0, bytes.Length);
+        }
+        stringOffsets[Strings.Length] = (int)stringData.Length;
+        while (stringData.Length % sizeof(int) != 0)
+            stringData.WriteByte(0);
+
+        // Adjacency in CSR form, grouping is stable so children and parents keep the order of the relations
+        var relationCount = Relations.Length / 2;
+        var childOffsets = new int[Nodes.Length + 1];
+        var parentOffsets = new int[Nodes.Length + 1];
+        for (int i = 0; i < Relations.Length; i += 2)
+        {
+            childOffsets[Relations[i] + 1]++;
+            parentOffsets[Relations[i + 1] + 1]++;
+        }
+        for (int i = 0; i < Nodes.Length; i++)
+        {
+            childOffsets[i + 1] += childOffsets[i];
+            parentOffsets[i + 1] += parentOffsets[i];
+        }
+        var childIndices = new int[relationCount];
+        var parentIndices = new int[relationCount];
+        var childPositions = childOffsets.ToArray();
+        var parentPositions = parentOffsets.ToArray();
+        for (int i = 0; i < Relations.Length; i += 2)
+        {
+            var parent = Relations[i];
+            var child = Relations[i + 1];
+            childIndices[childPositions[parent]++] = child;
+            parentIndices[parentPositions[child]++] = parent;
+        }
+
+        var header = new GmodSnapshotHeader
+        {
+            Magic = Magic,
+            FormatVersion = FormatVersion,
+            HashAlgorithm = (byte)HashAlgorithm,
+            VisVersion = Array.IndexOf(Strings, VisVersion),
+            NodeCount = Nodes.Length,
+            StringCount = Strings.Length,
+            RelationCount = relationCount,
+            NormalAssignmentNameCount = NormalAssignmentNames.Length / 2,
+            ChdSize = ChdSeeds.Length,
+        };
+
+        var offset = Marshal.SizeOf<GmodSnapshotHeader>();
+        int Section(int size)
+        {
+            var start = offset;
+            offset += size;
+            return start;
+        }
+
+        header.StringOffsets = Section(stringOffsets.Length * sizeof(int));
+        header.StringData = Section((int)stringData.Length);
+        header.Nodes = Section(Nodes.Length * Marshal.SizeOf<GmodSnapshotNode>());
+        header.ChildOffsets = Section(childOffsets.Length * sizeof(int));
+        header.ChildIndices = Section(childIndices.Length * sizeof(int));
+        header.ParentOffsets = Section(parentOffsets.Length * sizeof(int));
+        header.ParentIndices = Section(parentIndices.Length * sizeof(int));
+        header.NormalAssignmentNames = Section(NormalAssignmentNames.Length * sizeof(int));
+        header.ChdSeeds = Section(ChdSeeds.Length * sizeof(int));
+        header.ChdTable = Section(ChdTable.Length * sizeof(int));
+        header.Length = offset;
+
+        if (!BitConverter.IsLittleEndian)
+            throw new PlatformNotSupportedException("Gmod snapshots can only be written on little endian platforms");
+
+        Write(stream, [header]);
+        Write(stream, stringOffsets);
+        stringData.Position = 0;
+        stringData.CopyTo(stream);
+        Write(stream, Nodes);
+        Write(stream, childOffsets);
+        Write(stream, childIndices);
+        Write(stream, parentOffsets);
+        Write(stream, parentIndices);
+        Write(stream, NormalAssignmentNames);
+        Write(stream, ChdSeeds);
+        Write(stream, ChdTable);
+    }
+
+    private static void Write<T>(Stream stream, T[] values)
+        where T : struct
+    {
+        var bytes = MemoryMarshal.AsBytes(values.AsSpan()).ToArray();
+        stream.Write(bytes, 0, bytes.Length);
+    }
+}
+
+/// <summary>
+/// Fixed size header of a written <see cref="GmodSnapshot"/>, followed by the sections it points to.
+/// Section offsets are relative to the start of the snapshot and 4 byte aligned, all values are little endian.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct GmodSnapshotHeader
+{
+    public uint Magic;
+    public ushort FormatVersion;
+    public byte HashAlgorithm;
+    public byte Reserved;
+    public int Length;
+
+    /// <summary>String index of the VIS version</summary>
+    public int VisVersion;
+    public int NodeCount;
+    public int StringCount;
+    public int RelationCount;
+    public int NormalAssignmentNameCount;
+    public int ChdSize;
+
+    /// <summary>StringCount + 1 byte offsets into StringData, string i is UTF-8 in [offset[i], offset[i + 1])</summary>
+    public int StringOffsets;
+    public int StringData;
+
+    /// <summary>NodeCount x <see cref="GmodSnapshotNode"/></summary>
+    public int Nodes;
+
+    /// <summary>NodeCount + 1 offsets into ChildIndices</summary>
+    public int ChildOffsets;
+    public int ChildIndices;
+
+    /// <summary>NodeCount + 1 offsets into ParentIndices</summary>
+    public int ParentOffsets;
+    public int ParentIndices;
+
+    /// <summary>NormalAssignmentNameCount x (key, value) string indices</summary>
+    public int NormalAssignmentNames;
+
+    /// <summary>ChdSize seeds followed by ChdSize node indices, -1 for empty slots</summary>
+    public int ChdSeeds;
+    public int ChdTable;
+}
+
+/// <summary>A node of a <see cref="GmodSnapshot"/>, strings are string indices where -1 means absent</summary>
+[StructLayout(LayoutKind.Sequential)]
+internal readonly record struct GmodSnapshotNode(
+    int Code,
+    int Category,
+    int Type,
+    int Name,
+    int CommonName,
+    int Definition,
+    int CommonDefinition,
+    int InstallSubstructure,
+    int NormalAssignmentNamesOffset,
+    int NormalAssignmentNamesCount
+)
+{
+    public bool? GetInstallSubstructure() =>
+        InstallSubstructure switch
+        {
+            0 => null,
+            1 => false,
+            _ => true,
+        };
+}
@@ -0,0 +1,310 @@
+using System.IO.MemoryMappedFiles;
+using System.Runtime.CompilerServices;
+using System.Text;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// Read-only view over a written <see cref="GmodSnapshot"/> that reads nodes, adjacency and strings in place.
+/// The memory is either a memory mapped file or the embedded resource inside the assembly image,
+/// so that the model is backed by pages the OS can share between processes rather than by managed heap objects.
+/// </summary>
+internal sealed unsafe class GmodStore : IDisposable
+{
+    private readonly byte* _data;
+    private readonly GmodSnapshotHeader _header;
+    private readonly string?[] _strings;
+    private readonly ChdDictionary<int>? _lookup;
+    private IDisposable? _owner;
+
+    public string VisVersion { get; }
+
+    public int NodeCount => _header.NodeCount;
+
+    public ChdHashAlgorithm HashAlgorithm => (ChdHashAlgorithm)_header.HashAlgorithm;
+
+    /// <summary>True if the stored perfect hash layout was computed with the hash function of this process</summary>
+    public bool HasUsableLookupTable => HashAlgorithm == ChdDictionary<int>.HashAlgorithm;
+
+    private GmodStore(byte* data, long length, IDisposable owner)
+    {
+        _owner = owner;
+        try
+        {
+            if (!BitConverter.IsLittleEndian)
+                throw new PlatformNotSupportedException("Gmod snapshots can only be read on little endian platforms");
+            if (length < sizeof(GmodSnapshotHeader))
+                throw new InvalidDataException("Gmod snapshot is truncated");
+
+            _data = data;
+            _header = Unsafe.ReadUnaligned<GmodSnapshotHeader>(data);
+            if (_header.Magic != GmodSnapshot.Magic)
+                throw new InvalidDataException("Invalid Gmod snapshot");
+            if (_header.FormatVersion != GmodSnapshot.FormatVersion)
+                throw new InvalidDataException("Unsupported Gmod snapshot format version: " + _header.FormatVersion);
+            if (_header.Length > length || _header.Length < sizeof(GmodSnapshotHeader))
+                throw new InvalidDataException("Gmod snapshot is truncated");
+            Validate();
+
+            _strings = new string?[_header.StringCount];
+            VisVersion = GetString(_header.VisVersion)!;
+
+            if (!HasUsableLookupTable)
+            {
+                var entries = new (string Key, int Value)[NodeCount];
+                for (int i = 0; i < entries.Length; i++)
+                    entries[i] = (GetString(GetNode(i).Code)!, i);
+                _lookup = new ChdDictionary<int>(entries);
+            }
+        }
+        catch
+        {
+            Dispose();
+            throw;
+        }
+    }
+
+    /// <summary>
+    /// Checks that every section lies within the snapshot and that every offset and index read from it
+    /// stays within its section, so that reading the store never goes outside the snapshot memory
+    /// </summary>
+    private void Validate()
+    {
+        var header = _header;
+        if (
+            header.NodeCount < 0
+            || header.StringCount < 0
+            || header.RelationCount < 0
+            || header.NormalAssignmentNameCount < 0
+            || header.ChdSize < 0
+        )
+            throw new InvalidDataException("Invalid Gmod snapshot counts");
+
+        CheckSection(header.StringOffsets, header.StringCount + 1L, sizeof(int));
+        CheckSection(header.Nodes, header.NodeCount, sizeof(GmodSnapshotNode));
+        CheckSection(header.ChildOffsets, header.NodeCount + 1L, sizeof(int));
+        CheckSection(header.ChildIndices, header.RelationCount, sizeof(int));
+        CheckSection(header.ParentOffsets, header.NodeCount + 1L, sizeof(int));
+        CheckSection(header.ParentIndices, header.RelationCount, sizeof(int));
+        CheckSection(header.NormalAssignmentNames, header.NormalAssignmentNameCount * 2L, sizeof(int));
+        CheckSection(header.ChdSeeds, header.ChdSize, sizeof(int));
+        CheckSection(header.ChdTable, header.ChdSize, sizeof(int));
+
+        var stringOffsets = Section<int>(header.StringOffsets, header.StringCount + 1);
+        CheckOffsets(stringOffsets);
+        CheckSection(header.StringData, stringOffsets[header.StringCount], 1);
+
+        CheckOffsets(ChildOffsets, header.RelationCount);
+        CheckOffsets(ParentOffsets, header.RelationCount);
+        CheckIndices(ChildIndices, header.NodeCount);
+        CheckIndices(ParentIndices, header.NodeCount);
+        CheckIndices(ChdTable, header.NodeCount, allowAbsent: true);
+        CheckIndices(Section<int>(header.NormalAssignmentNames, header.NormalAssignmentNameCount * 2), header.StringCount);
+        CheckIndices(new ReadOnlySpan<int>(&header.VisVersion, 1), header.StringCount);
+
+        foreach (ref readonly var node in Section<GmodSnapshotNode>(header.Nodes, header.NodeCount))
+        {
+            // Code is required, the other strings are -1 when absent
+            ReadOnlySpan<int> strings =
+            [
+                node.Code,
+                node.Category,
+                node.Type,
+                node.Name,
+                node.CommonName,
+                node.Definition,
+                node.CommonDefinition,
+            ];
+            CheckIndices(strings.Slice(0, 1), header.StringCount);
+            CheckIndices(strings.Slice(1), header.StringCount, allowAbsent: true);
+
+            if (
+                node.NormalAssignmentNamesOffset < 0
+                || node.NormalAssignmentNamesCount < 0
+                || (long)node.NormalAssignmentNamesOffset + node.NormalAssignmentNamesCount
+                    > header.NormalAssignmentNameCount
+            )
+                throw new InvalidDataException("Gmod snapshot normal assignment names are out of bounds");
+        }
+    }
+
+    private void CheckSection(int offset, long count, int size)
+    {
+        if (offset < sizeof(GmodSnapshotHeader) || count < 0 || offset + count * size > _header.Length)
+            throw new InvalidDataException("Gmod snapshot section is out of bounds");
+    }
+
+    // Offsets are ascending and end within their section
+    private static void CheckOffsets(ReadOnlySpan<int> offsets, long end = long.MaxValue)
+    {
+        var previous = 0;
+        foreach (var offset in offsets)
+        {
+            if (offset < previous)
+                throw new InvalidDataException("Gmod snapshot offsets are not ascending");
+            previous = offset;
+        }
+        if (previous > end)
+            throw new InvalidDataException("Gmod snapshot offsets are out of bounds");
+    }
+
+    private static void CheckIndices(ReadOnlySpan<int> indices, int count, bool allowAbsent = false)
+    {
+        foreach (var index in indices)
+        {
+            if (index >= count || index < (allowAbsent ? -1 : 0))
+                throw new InvalidDataException("Gmod snapshot index is out of bounds");
+        }
+    }
+
+    /// <summary>Maps the snapshot file at <paramref name="path"/> read-only</summary>
+    public static GmodStore Open(string path)
+    {
+        var file = MemoryMappedFile.CreateFromFile(
+            new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read),
+            null,
+            0,
+            MemoryMappedFileAccess.Read,
+            HandleInheritability.None,
+            false
+        );
+        MemoryMappedViewAccessor? accessor = null;
+        try
+        {
+            accessor = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+            // No reference is added to the view handle, so its finalizer unmaps the view
+            // once neither the store nor the nodes read from it are reachable anymore
+            var data = (byte*)accessor.SafeMemoryMappedViewHandle.DangerousGetHandle() + accessor.PointerOffset;
+            return new GmodStore(data, accessor.Capacity, new MappedView(file, accessor));
+        }
+        catch
+        {
+            accessor?.Dispose();
+            file.Dispose();
+            throw;
+        }
+    }
+
+    /// <summary>Reads the snapshot in place from an embedded resource, the store takes ownership of the stream</summary>
+    public static GmodStore FromResource(UnmanagedMemoryStream stream) =>
+        new GmodStore(stream.PositionPointer, stream.Length - stream.Position, stream);
+
+    /// <summary>Gets string <paramref name="index"/>, or null for negative indices. Strings are decoded once</summary>
+    public string? GetString(int index)
+    {
+        if (index < 0)
+            return null;
+
+        return _strings[index]
+            ?? Interlocked.CompareExchange(ref _strings[index], DecodeString(index), null)
+            ?? _strings[index];
+    }
+
+    private string DecodeString(int index)
+    {
+        var offsets = Section<int>(_header.StringOffsets, _header.StringCount + 1);
+        var start = offsets[index];
+        return Encoding.UTF8.GetString(_data + _header.StringData + start, offsets[index + 1] - start);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public ref readonly GmodSnapshotNode GetNode(int index) =>
+        ref Section<GmodSnapshotNode>(_header.Nodes, NodeCount)[index];
+
+    public ReadOnlySpan<int> GetChildren(int index) =>
+        Adjacency(_header.ChildOffsets, _header.ChildIndices, index);
+
+    public ReadOnlySpan<int> GetParents(int index) => Adjacency(_header.ParentOffsets, _header.ParentIndices, index);
+
+    public ReadOnlySpan<int> ChildOffsets => Section<int>(_header.ChildOffsets, NodeCount + 1);
+
+    public ReadOnlySpan<int> ChildIndices => Section<int>(_header.ChildIndices, _header.RelationCount);
+
+    public ReadOnlySpan<int> ParentOffsets => Section<int>(_header.ParentOffsets, NodeCount + 1);
+
+    public ReadOnlySpan<int> ParentIndices => Section<int>(_header.ParentIndices, _header.RelationCount);
+
+    public (string Key, string Value) GetNormalAssignmentName(int index)
+    {
+        var names = Section<int>(_header.NormalAssignmentNames, _header.NormalAssignmentNameCount * 2);
+        return (GetString(names[index * 2])!, GetString(names[index * 2 + 1])!);
+    }
+
+    /// <summary>Node index per slot of the stored perfect hash table, -1 for empty slots</summary>
+    public ReadOnlySpan<int> ChdTable => Section<int>(_header.ChdTable, _header.ChdSize);
+
+    public ReadOnlySpan<int> ChdSeeds => Section<int>(_header.ChdSeeds, _header.ChdSize);
+
+    /// <summary>Looks up the node index of <paramref name="code"/> without materializing any strings</summary>
+    public bool TryGetNodeIndex(ReadOnlySpan<char> code, out int index)
+    {
+        if (_lookup is not null)
+            return _lookup.TryGetValue(code, out index);
+
+        index = -1;
+        if (code.IsEmpty)
+            return false;
+
+        var seeds = ChdSeeds;
+        var size = seeds.Length;
+        var hash = ChdDictionary<int>.Hash(code);
+        var seed = seeds[(int)(hash & (size - 1))];
+        var slot = seed < 0 ? 0 - seed - 1 : (int)ChdHashing.Seed((uint)seed, hash, (ulong)size);
+
+        var candidate = ChdTable[slot];
+        if (candidate < 0 || !CodeEquals(GetNode(candidate).Code, code))
+            return false;
+
+        index = candidate;
+        return true;
+    }
+
+    private bool CodeEquals(int stringIndex, ReadOnlySpan<char> code)
+    {
+        var offsets = Section<int>(_header.StringOffsets, _header.StringCount + 1);
+        var start = offsets[stringIndex];
+        var bytes = new ReadOnlySpan<byte>(_data + _header.StringData + start, offsets[stringIndex + 1] - start);
+
+        // Codes are ASCII, compare the UTF-8 bytes directly and only decode if that assumption does not hold
+        for (int i = 0; i < bytes.Length; i++)
+        {
+            if (bytes[i] >= 0x80)
+                return GetString(stringIndex).AsSpan().SequenceEqual(code);
+            if (i >= code.Length || bytes[i] != code[i])
+                return false;
+        }
+
+        return bytes.Length == code.Length;
+    }
+
+    private ReadOnlySpan<int> Adjacency(int offsetsSection, int indicesSection, int index)
+    {
+        var offsets = Section<int>(offsetsSection, NodeCount + 1);
+        var start = offsets[index];
+        return new ReadOnlySpan<int>(_data + indicesSection + start * sizeof(int), offsets[index + 1] - start);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private ReadOnlySpan<T> Section<T>(int offset, int count)
+        where T : unmanaged => new ReadOnlySpan<T>(_data + offset, count);
+
+    public void Dispose() => Interlocked.Exchange(ref _owner, null)?.Dispose();
+
+    private sealed class MappedView : IDisposable
+    {
+        private readonly MemoryMappedFile _file;
+        private readonly MemoryMappedViewAccessor _accessor;
+
+        public MappedView(MemoryMappedFile file, MemoryMappedViewAccessor accessor)
+        {
+            _file = file;
+            _accessor = accessor;
+        }
+
+        public void Dispose()
+        {
+            _accessor.Dispose();
+            _file.Dispose();
+        }
+    }
+}
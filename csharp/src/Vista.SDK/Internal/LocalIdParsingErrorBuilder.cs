@@ -2,15 +2,31 @@ namespace Vista.SDK.Internal;
 
 internal sealed record LocalIdParsingErrorBuilder
 {
-    private readonly List<(LocalIdParsingState type, string message)> _errors;
+    private readonly List<(LocalIdParsingState type, string message)>? _errors;
+    private readonly bool _failed;
     private static Dictionary<LocalIdParsingState, string> _predefinedErrorMessages => SetPredefinedMessages();
 
     internal static readonly LocalIdParsingErrorBuilder Empty = new();
 
+    /// <summary>
+    /// Used in place of <see cref="Empty"/> when the caller doesn't want diagnostics,
+    /// parsing then only records that it failed and never allocates or formats messages
+    /// </summary>
+    internal static readonly LocalIdParsingErrorBuilder Silent = new(failed: false);
+
+    internal static readonly LocalIdParsingErrorBuilder SilentFailed = new(failed: true);
+
     internal LocalIdParsingErrorBuilder() => _errors = new List<(LocalIdParsingState, string)>();
 
+    private LocalIdParsingErrorBuilder(bool failed) => _failed = failed;
+
+    internal bool IsSilent => _errors is null;
+
     internal LocalIdParsingErrorBuilder AddError(LocalIdParsingState state)
     {
+        if (_errors is null)
+            return this;
+
         if (!_predefinedErrorMessages.TryGetValue(state, out var predefinedMessage))
             throw new Exception("Couldn't find predefined message for: " + state.ToString());
 
@@ -20,6 +36,8 @@ internal LocalIdParsingErrorBuilder AddError(LocalIdParsingState state)
 
     internal LocalIdParsingErrorBuilder AddError(LocalIdParsingState state, string? message)
     {
+        if (_errors is null)
+            return this;
         if (string.IsNullOrWhiteSpace(message))
             return AddError(state);
 
@@ -27,12 +45,12 @@ internal LocalIdParsingErrorBuilder AddError(LocalIdParsingState state, string?
         return this;
     }
 
-    internal bool HasError => _errors.Count > 0;
+    internal bool HasError => _failed || _errors?.Count > 0;
 
     internal static LocalIdParsingErrorBuilder Create() => new();
 
     public ParsingErrors Build() =>
-        _errors.Count == 0
+        _errors is null || _errors.Count == 0
             ? ParsingErrors.Empty
             : new ParsingErrors(_errors.Select((t, m) => (t.type.ToString(), t.message)).ToArray());
 
@@ -55,6 +73,9 @@ internal LocalIdParsingErrorBuilder AddError(LocalIdParsingState state, string?
             { LocalIdParsingState.MetaCalculation, "Invalid metadata tag: Calculation" },
             { LocalIdParsingState.MetaState, "Invalid metadata tag: State" },
             { LocalIdParsingState.MetaType, "Invalid metadata tag: Type" },
+            { LocalIdParsingState.MetaFunctionalServices, "Invalid metadata tag: Functional services" },
+            { LocalIdParsingState.MetaMaintenanceCategory, "Invalid metadata tag: Maintenance category" },
+            { LocalIdParsingState.MetaActivityType, "Invalid metadata tag: Activity type" },
             { LocalIdParsingState.MetaDetail, "Invalid metadata tag: Detail" },
             { LocalIdParsingState.EmptyState, "Missing primary path or metadata" }
         };
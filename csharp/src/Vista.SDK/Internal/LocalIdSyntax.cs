@@ -0,0 +1,761 @@
+using Vista.SDK.Experimental;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// A naming rule for local IDs, as in parsing/UniversalId.abnf, with the span based parser shared by
+/// <see cref="LocalIdBuilder"/> and <see cref="PMSLocalIdBuilder"/>.
+/// Naming rules only differ in their identifier and the metadata tags they allow,
+/// so each is a table of those built once, and the state machine is the same for all of them.
+/// </summary>
+internal sealed class LocalIdSyntax
+{
+    // The tags of every naming rule in the order they follow "/meta", each rule allows a subsequence of them.
+    // Tag i is parsed in state LocalIdParsingState.MetaQuantity + i
+    private static readonly (string Prefix, CodebookName Name)[] _tags =
+    [
+        ("qty", CodebookName.Quantity),
+        ("cnt", CodebookName.Content),
+        ("calc", CodebookName.Calculation),
+        ("state", CodebookName.State),
+        ("cmd", CodebookName.Command),
+        ("type", CodebookName.Type),
+        ("funct.svc", CodebookName.FunctionalServices),
+        ("maint.cat", CodebookName.MaintenanceCategory),
+        ("act.type", CodebookName.ActivityType),
+        ("pos", CodebookName.Position),
+        ("detail", CodebookName.Detail),
+    ];
+
+    /// <summary>The dnv-v2 naming rule of <see cref="LocalIdBuilder"/></summary>
+    public static readonly LocalIdSyntax LocalId =
+        new(
+            LocalIdBuilder.NamingRule,
+            CodebookName.Quantity,
+            CodebookName.Content,
+            CodebookName.Calculation,
+            CodebookName.State,
+            CodebookName.Command,
+            CodebookName.Type,
+            CodebookName.Position,
+            CodebookName.Detail
+        );
+
+    /// <summary>The experimental naming rule of <see cref="PMSLocalIdBuilder"/></summary>
+    public static readonly LocalIdSyntax PmsLocalId =
+        new(
+            PMSLocalIdBuilder.NamingRule,
+            CodebookName.Quantity,
+            CodebookName.Content,
+            CodebookName.State,
+            CodebookName.Command,
+            CodebookName.FunctionalServices,
+            CodebookName.MaintenanceCategory,
+            CodebookName.ActivityType,
+            CodebookName.Position,
+            CodebookName.Detail
+        );
+
+    private readonly string _namingRule;
+
+    // Indexed by tag, whether the rule allows it, and the next tag after it that the rule allows
+    private readonly bool[] _allowed;
+    private readonly LocalIdParsingState?[] _next;
+
+    private LocalIdSyntax(string namingRule, params CodebookName[] tags)
+    {
+        _namingRule = namingRule;
+        _allowed = new bool[_tags.Length];
+        _next = new LocalIdParsingState?[_tags.Length];
+
+        foreach (var name in tags)
+            _allowed[Array.FindIndex(_tags, t => t.Name == name)] = true;
+
+        LocalIdParsingState? next = null;
+        for (var i = _tags.Length - 1; i >= 0; i--)
+        {
+            _next[i] = next;
+            if (_allowed[i])
+                next = LocalIdParsingState.MetaQuantity + i;
+        }
+    }
+
+    /// <summary>
+    /// Reads the parts of a local ID, adding what's wrong with them to <paramref name="errorBuilder"/>.
+    /// </summary>
+    /// <returns>
+    /// False if the ID is too malformed to read on. Otherwise the ID is valid
+    /// if no errors were added and <see cref="LocalIdParts.InvalidSecondaryItem"/> is not set
+    /// </returns>
+    public bool TryReadParts(
+        ReadOnlySpan<char> span,
+        ref LocalIdParsingErrorBuilder errorBuilder,
+        out LocalIdParts parts
+    )
+    {
+        parts = default;
+        if (span.Length == 0)
+            return false;
+        if (span[0] != '/')
+        {
+            AddError(
+                ref errorBuilder,
+                LocalIdParsingState.Formatting,
+                "Invalid format: missing '/' as first character"
+            );
+            return false;
+        }
+
+        Gmod? gmod = null;
+        Codebooks? codebooks = null;
+        string? predefinedMessage = null;
+
+        var primaryItemStart = -1;
+        var secondaryItemStart = -1;
+
+        var state = LocalIdParsingState.NamingRule;
+        int i = 1;
+        while (state <= LocalIdParsingState.MetaDetail)
+        {
+            var nextStart = Math.Min(span.Length, i);
+            var nextSlash = span.Slice(nextStart).IndexOf('/');
+            var segment = nextSlash == -1 ? span.Slice(nextStart) : span.Slice(nextStart, nextSlash);
+            switch (state)
+            {
+                case LocalIdParsingState.NamingRule:
+                    if (segment.Length == 0)
+                    {
+                        AddError(ref errorBuilder, LocalIdParsingState.NamingRule, predefinedMessage);
+                        state++;
+                        break;
+                    }
+
+                    if (!segment.SequenceEqual(_namingRule.AsSpan()))
+                    {
+                        AddError(ref errorBuilder, LocalIdParsingState.NamingRule, predefinedMessage);
+                        return false;
+                    }
+                    AdvanceParser(ref i, in segment, ref state);
+                    break;
+                case LocalIdParsingState.VisVersion:
+                    if (segment.Length == 0)
+                    {
+                        AddError(ref errorBuilder, LocalIdParsingState.VisVersion, predefinedMessage);
+                        state++;
+                        break;
+                    }
+
+                    if (!segment.StartsWith("vis-".AsSpan()))
+                    {
+                        AddError(ref errorBuilder, LocalIdParsingState.VisVersion, predefinedMessage);
+                        return false;
+                    }
+
+                    if (!VisVersions.TryParse(segment.Slice("vis-".Length), out parts.VisVersion))
+                    {
+                        AddError(ref errorBuilder, LocalIdParsingState.VisVersion, predefinedMessage);
+                        return false;
+                    }
+
+                    gmod = VIS.Instance.GetGmod(parts.VisVersion);
+                    codebooks = VIS.Instance.GetCodebooks(parts.VisVersion);
+                    if (gmod is null || codebooks is null)
+                        return false;
+
+                    AdvanceParser(ref i, in segment, ref state);
+                    break;
+                case LocalIdParsingState.PrimaryItem:
+
+                    {
+                        if (segment.Length == 0)
+                        {
+                            if (primaryItemStart != -1)
+                            {
+                                if (gmod is null)
+                                    return false;
+
+                                var path = span.Slice(primaryItemStart, i - 1 - primaryItemStart);
+                                if (!gmod.TryParsePath(path.ToString(), out parts.PrimaryItem))
+                                {
+                                    // Displays the full GmodPath when first part of PrimaryItem is invalid
+                                    AddFormattedError(
+                                        ref errorBuilder,
+                                        LocalIdParsingState.PrimaryItem,
+                                        "Invalid GmodPath in Primary item: {0}",
+                                        path
+                                    );
+                                }
+                            }
+                            else
+                            {
+                                AddError(ref errorBuilder, LocalIdParsingState.PrimaryItem, predefinedMessage);
+                            }
+                            AddError(
+                                ref errorBuilder,
+                                LocalIdParsingState.PrimaryItem,
+                                "Invalid or missing '/meta' prefix after Primary item"
+                            );
+                            state++;
+                            break;
+                        }
+
+                        var dashIndex = segment.IndexOf('-');
+                        var code = dashIndex == -1 ? segment : segment.Slice(0, dashIndex);
+
+                        if (gmod is null)
+                            return false;
+
+                        if (primaryItemStart == -1)
+                        {
+                            if (!gmod.TryGetNode(code, out _))
+                                AddFormattedError(
+                                    ref errorBuilder,
+                                    LocalIdParsingState.PrimaryItem,
+                                    "Invalid start GmodNode in Primary item: {0}",
+                                    code
+                                );
+                            primaryItemStart = i;
+                            AdvanceParser(ref i, in segment);
+                        }
+                        else
+                        {
+                            var nextState = (
+                                segment.StartsWith("sec".AsSpan()),
+                                segment.StartsWith("meta".AsSpan()),
+                                segment[0] == '~'
+                            ) switch
+                            {
+                                (false, false, false) => state,
+                                (true, false, false) => LocalIdParsingState.SecondaryItem,
+                                (false, true, false) => LocalIdParsingState.MetaQuantity,
+                                (false, false, true) => LocalIdParsingState.ItemDescription,
+                                _ => throw new Exception("Inconsistent parsing state"),
+                            };
+
+                            if (nextState != state)
+                            {
+                                var path = span.Slice(primaryItemStart, i - 1 - primaryItemStart);
+                                if (!gmod.TryParsePath(path.ToString(), out parts.PrimaryItem))
+                                {
+                                    // Displays the full GmodPath when first part of PrimaryItem is invalid
+                                    AddFormattedError(
+                                        ref errorBuilder,
+                                        LocalIdParsingState.PrimaryItem,
+                                        "Invalid GmodPath in Primary item: {0}",
+                                        path
+                                    );
+
+                                    (var _, var endOfNextStateIndex) = GetNextStateIndexes(span, state);
+                                    i = endOfNextStateIndex;
+                                    AdvanceParser(ref state, nextState);
+                                    break;
+                                }
+
+                                if (segment[0] == '~')
+                                    AdvanceParser(ref state, nextState);
+                                else
+                                    AdvanceParser(ref i, in segment, ref state, nextState);
+                                break;
+                            }
+
+                            if (!gmod.TryGetNode(code, out _))
+                            {
+                                AddFormattedError(
+                                    ref errorBuilder,
+                                    LocalIdParsingState.PrimaryItem,
+                                    "Invalid GmodNode in Primary item: {0}",
+                                    code
+                                );
+                                (var nextStateIndex, var endOfNextStateIndex) = GetNextStateIndexes(span, state);
+
+                                if (nextStateIndex == -1)
+                                {
+                                    AddError(
+                                        ref errorBuilder,
+                                        LocalIdParsingState.PrimaryItem,
+                                        "Invalid or missing '/meta' prefix after Primary item"
+                                    );
+                                    return false;
+                                }
+
+                                var nextSegment = span.Slice(nextStateIndex + 1);
+
+                                nextState = (
+                                    nextSegment.StartsWith("sec".AsSpan()),
+                                    nextSegment.StartsWith("meta".AsSpan()),
+                                    nextSegment[0] == '~'
+                                ) switch
+                                {
+                                    (true, false, false) => LocalIdParsingState.SecondaryItem,
+                                    (false, true, false) => LocalIdParsingState.MetaQuantity,
+                                    (false, false, true) => LocalIdParsingState.ItemDescription,
+                                    _ => throw new Exception("Inconsistent parsing state"),
+                                };
+
+                                // Displays the invalid middle parts of PrimaryItem and not the whole GmodPath
+                                var invalidPrimaryItemPath = span.Slice(i, nextStateIndex - i);
+
+                                AddFormattedError(
+                                    ref errorBuilder,
+                                    LocalIdParsingState.PrimaryItem,
+                                    "Invalid GmodPath: Last part in Primary item: {0}",
+                                    invalidPrimaryItemPath
+                                );
+
+                                i = endOfNextStateIndex;
+                                AdvanceParser(ref state, nextState);
+                                break;
+                            }
+
+                            AdvanceParser(ref i, in segment);
+                        }
+                    }
+                    break;
+                case LocalIdParsingState.SecondaryItem:
+
+                    {
+                        if (segment.Length == 0)
+                        {
+                            state++;
+                            break;
+                        }
+
+                        var dashIndex = segment.IndexOf('-');
+                        var code = dashIndex == -1 ? segment : segment.Slice(0, dashIndex);
+                        if (gmod is null)
+                            return false;
+
+                        if (secondaryItemStart == -1)
+                        {
+                            if (!gmod.TryGetNode(code, out _))
+                                AddFormattedError(
+                                    ref errorBuilder,
+                                    LocalIdParsingState.SecondaryItem,
+                                    "Invalid start GmodNode in Secondary item: {0}",
+                                    code
+                                );
+
+                            secondaryItemStart = i;
+                            AdvanceParser(ref i, in segment);
+                        }
+                        else
+                        {
+                            var nextState = (segment.StartsWith("meta".AsSpan()), segment[0] == '~') switch
+                            {
+                                (false, false) => state,
+                                (true, false) => LocalIdParsingState.MetaQuantity,
+                                (false, true) => LocalIdParsingState.ItemDescription,
+                                _ => throw new Exception("Inconsistent parsing state"),
+                            };
+
+                            if (nextState != state)
+                            {
+                                var path = span.Slice(secondaryItemStart, i - 1 - secondaryItemStart);
+                                if (!gmod.TryParsePath(path.ToString(), out parts.SecondaryItem))
+                                {
+                                    // Displays the full GmodPath when first part of SecondaryItem is invalid
+                                    parts.InvalidSecondaryItem = true;
+                                    AddFormattedError(
+                                        ref errorBuilder,
+                                        LocalIdParsingState.SecondaryItem,
+                                        "Invalid GmodPath in Secondary item: {0}",
+                                        path
+                                    );
+
+                                    (var _, var endOfNextStateIndex) = GetNextStateIndexes(span, state);
+                                    i = endOfNextStateIndex;
+                                    AdvanceParser(ref state, nextState);
+                                    break;
+                                }
+
+                                if (segment[0] == '~')
+                                    AdvanceParser(ref state, nextState);
+                                else
+                                    AdvanceParser(ref i, in segment, ref state, nextState);
+                                break;
+                            }
+
+                            if (!gmod.TryGetNode(code, out _))
+                            {
+                                parts.InvalidSecondaryItem = true;
+                                AddFormattedError(
+                                    ref errorBuilder,
+                                    LocalIdParsingState.SecondaryItem,
+                                    "Invalid GmodNode in Secondary item: {0}",
+                                    code
+                                );
+
+                                (var nextStateIndex, var endOfNextStateIndex) = GetNextStateIndexes(span, state);
+                                if (nextStateIndex == -1)
+                                {
+                                    AddError(
+                                        ref errorBuilder,
+                                        LocalIdParsingState.SecondaryItem,
+                                        "Invalid or missing '/meta' prefix after Secondary item"
+                                    );
+                                    return false;
+                                }
+
+                                var nextSegment = span.Slice(nextStateIndex + 1);
+
+                                nextState = (nextSegment.StartsWith("meta".AsSpan()), nextSegment[0] == '~') switch
+                                {
+                                    (true, false) => LocalIdParsingState.MetaQuantity,
+                                    (false, true) => LocalIdParsingState.ItemDescription,
+                                    _ => throw new Exception("Inconsistent parsing state"),
+                                };
+
+                                var invalidSecondaryItemPath = span.Slice(i, nextStateIndex - i);
+
+                                AddFormattedError(
+                                    ref errorBuilder,
+                                    LocalIdParsingState.SecondaryItem,
+                                    "Invalid GmodPath: Last part in Secondary item: {0}",
+                                    invalidSecondaryItemPath
+                                );
+
+                                i = endOfNextStateIndex;
+
+                                AdvanceParser(ref state, nextState);
+                                break;
+                            }
+                            AdvanceParser(ref i, in segment);
+                        }
+                    }
+                    break;
+                case LocalIdParsingState.ItemDescription:
+                    if (segment.Length == 0)
+                    {
+                        state++;
+                        break;
+                    }
+
+                    parts.Verbose = true;
+
+                    var metaIndex = span.IndexOf("/meta".AsSpan());
+                    if (metaIndex == -1)
+                    {
+                        AddError(ref errorBuilder, LocalIdParsingState.ItemDescription, predefinedMessage);
+                        return false;
+                    }
+
+                    segment = span.Slice(i, (metaIndex + "/meta".Length) - i);
+
+                    AdvanceParser(ref i, in segment, ref state);
+                    break;
+                default:
+
+                    {
+                        // Metadata tags, passing by the ones this naming rule doesn't have
+                        var tag = state - LocalIdParsingState.MetaQuantity;
+                        if (segment.Length == 0 || !_allowed[tag])
+                        {
+                            state++;
+                            break;
+                        }
+
+                        var result = ParseMetatag(
+                            _tags[tag].Name,
+                            ref state,
+                            ref i,
+                            in segment,
+                            ref parts,
+                            codebooks,
+                            ref errorBuilder
+                        );
+                        if (!result)
+                            return false;
+                    }
+                    break;
+            }
+        }
+
+        if (parts.IsEmptyMetadata)
+        {
+            AddError(
+                ref errorBuilder,
+                LocalIdParsingState.Completeness,
+                "No metadata tags specified. Local IDs require atleast 1 metadata tag."
+            );
+        }
+
+        return true;
+    }
+
+    private bool ParseMetatag(
+        CodebookName codebookName,
+        ref LocalIdParsingState state,
+        ref int i,
+        in ReadOnlySpan<char> segment,
+        ref LocalIdParts parts,
+        Codebooks? codebooks,
+        ref LocalIdParsingErrorBuilder errorBuilder
+    )
+    {
+        if (codebooks is null)
+            return false;
+
+        var dashIndex = segment.IndexOf('-');
+        var tildeIndex = segment.IndexOf('~');
+        var prefixIndex = dashIndex == -1 ? tildeIndex : dashIndex;
+        if (prefixIndex == -1)
+        {
+            AddFormattedError(
+                ref errorBuilder,
+                state,
+                "Invalid metadata tag: missing prefix '-' or '~' in {0}",
+                segment
+            );
+            AdvanceParser(ref i, in segment, ref state);
+            return true;
+        }
+
+        var actualPrefix = segment.Slice(0, prefixIndex);
+
+        var actualState = MetaPrefixToState(actualPrefix);
+        if (actualState is null || actualState < state)
+        {
+            AddFormattedError(ref errorBuilder, state, "Invalid metadata tag: unknown prefix {0}", actualPrefix);
+            return false;
+        }
+
+        if (actualState > state)
+        {
+            AdvanceParser(ref state, actualState.Value);
+            return true;
+        }
+
+        var nextState = _next[actualState.Value - LocalIdParsingState.MetaQuantity];
+
+        var value = segment.Slice(prefixIndex + 1);
+        if (value.Length == 0)
+        {
+            AddFormattedCodebookError(ref errorBuilder, state, "Invalid {0} metadata tag: missing value", codebookName);
+            return false;
+        }
+
+        var tag = codebooks.TryCreateTag(codebookName, value);
+        parts[codebookName] = tag;
+        if (tag is null)
+        {
+            if (prefixIndex == tildeIndex)
+                AddFormattedCodebookError(
+                    ref errorBuilder,
+                    state,
+                    "Invalid custom {0} metadata tag: failed to create {1}",
+                    codebookName,
+                    value
+                );
+            else
+                AddFormattedCodebookError(
+                    ref errorBuilder,
+                    state,
+                    "Invalid {0} metadata tag: failed to create {1}",
+                    codebookName,
+                    value
+                );
+
+            AdvanceParser(ref i, in segment, ref state);
+            return true;
+        }
+
+        if (prefixIndex == dashIndex && tag.Value.Prefix == '~')
+            AddFormattedCodebookError(
+                ref errorBuilder,
+                state,
+                "Invalid {0} metadata tag: '{1}'. Use prefix '~' for custom values",
+                codebookName,
+                value
+            );
+        if (nextState is null)
+            AdvanceParser(ref i, in segment, ref state);
+        else
+            AdvanceParser(ref i, in segment, ref state, nextState.Value);
+        return true;
+    }
+
+    private LocalIdParsingState? MetaPrefixToState(ReadOnlySpan<char> prefix)
+    {
+        for (var i = 0; i < _tags.Length; i++)
+        {
+            if (_allowed[i] && prefix.SequenceEqual(_tags[i].Prefix.AsSpan()))
+                return LocalIdParsingState.MetaQuantity + i;
+        }
+
+        return null;
+    }
+
+    private static void AddError(
+        ref LocalIdParsingErrorBuilder errorBuilder,
+        LocalIdParsingState state,
+        string? message
+    )
+    {
+        if (!errorBuilder.HasError)
+        {
+            errorBuilder = errorBuilder.IsSilent
+                ? LocalIdParsingErrorBuilder.SilentFailed
+                : LocalIdParsingErrorBuilder.Create();
+        }
+
+        errorBuilder.AddError(state, message);
+    }
+
+    // Messages are only formatted when diagnostics are collected
+    private static void AddFormattedError(
+        ref LocalIdParsingErrorBuilder errorBuilder,
+        LocalIdParsingState state,
+        string format,
+        ReadOnlySpan<char> value
+    ) => AddError(ref errorBuilder, state, errorBuilder.IsSilent ? null : string.Format(format, value.ToString()));
+
+    private static void AddFormattedCodebookError(
+        ref LocalIdParsingErrorBuilder errorBuilder,
+        LocalIdParsingState state,
+        string format,
+        CodebookName codebookName,
+        ReadOnlySpan<char> value = default
+    ) =>
+        AddError(
+            ref errorBuilder,
+            state,
+            errorBuilder.IsSilent ? null : string.Format(format, codebookName, value.ToString())
+        );
+
+    private static (int NextIndex, int EndOfNextStateIndex) GetNextStateIndexes(
+        ReadOnlySpan<char> span,
+        LocalIdParsingState state
+    )
+    {
+        var customIndex = span.IndexOf("~".AsSpan());
+        var endOfCustomIndex = (customIndex + "~".Length + 1);
+
+        var metaIndex = span.IndexOf("/meta".AsSpan());
+        var endOfMetaIndex = (metaIndex + "/meta".Length + 1);
+        var isVerbose = customIndex < metaIndex;
+
+        switch (state)
+        {
+            case (LocalIdParsingState.PrimaryItem):
+            {
+                var secIndex = span.IndexOf("/sec".AsSpan());
+                var endOfSecIndex = (secIndex + "/sec".Length + 1);
+
+                if (secIndex != -1)
+                    return (secIndex, endOfSecIndex);
+
+                if (isVerbose && customIndex != -1)
+                    return (customIndex, endOfCustomIndex);
+
+                return (metaIndex, endOfMetaIndex);
+            }
+
+            case (LocalIdParsingState.SecondaryItem):
+                if (isVerbose && customIndex != -1)
+                    return (customIndex, endOfCustomIndex);
+                return (metaIndex, endOfMetaIndex);
+
+            default:
+                return (metaIndex, endOfMetaIndex);
+        }
+    }
+
+    private static void AdvanceParser(ref int i, in ReadOnlySpan<char> segment, ref LocalIdParsingState state)
+    {
+        state++;
+        i += segment.Length + 1;
+    }
+
+    private static void AdvanceParser(ref int i, in ReadOnlySpan<char> segment) => i += segment.Length + 1;
+
+    private static void AdvanceParser(ref LocalIdParsingState state, LocalIdParsingState to) => state = to;
+
+    private static void AdvanceParser(
+        ref int i,
+        in ReadOnlySpan<char> segment,
+        ref LocalIdParsingState state,
+        LocalIdParsingState to
+    )
+    {
+        i += segment.Length + 1;
+        state = to;
+    }
+}
+
+/// <summary>The parts read by <see cref="LocalIdSyntax.TryReadParts"/>, for the builders to be created from</summary>
+internal struct LocalIdParts
+{
+    public VisVersion VisVersion;
+    public GmodPath? PrimaryItem;
+    public GmodPath? SecondaryItem;
+    public bool Verbose;
+    public bool InvalidSecondaryItem;
+
+    public MetadataTag? Quantity;
+    public MetadataTag? Content;
+    public MetadataTag? Calculation;
+    public MetadataTag? State;
+    public MetadataTag? Command;
+    public MetadataTag? Type;
+    public MetadataTag? FunctionalServices;
+    public MetadataTag? MaintenanceCategory;
+    public MetadataTag? ActivityType;
+    public MetadataTag? Position;
+    public MetadataTag? Detail;
+
+    public MetadataTag? this[CodebookName name]
+    {
+        set
+        {
+            switch (name)
+            {
+                case CodebookName.Quantity:
+                    Quantity = value;
+                    break;
+                case CodebookName.Content:
+                    Content = value;
+                    break;
+                case CodebookName.Calculation:
+                    Calculation = value;
+                    break;
+                case CodebookName.State:
+                    State = value;
+                    break;
+                case CodebookName.Command:
+                    Command = value;
+                    break;
+                case CodebookName.Type:
+                    Type = value;
+                    break;
+                case CodebookName.FunctionalServices:
+                    FunctionalServices = value;
+                    break;
+                case CodebookName.MaintenanceCategory:
+                    MaintenanceCategory = value;
+                    break;
+                case CodebookName.ActivityType:
+                    ActivityType = value;
+                    break;
+                case CodebookName.Position:
+                    Position = value;
+                    break;
+                case CodebookName.Detail:
+                    Detail = value;
+                    break;
+            }
+        }
+    }
+
+    public readonly bool IsEmptyMetadata =>
+        Quantity is null
+        && Content is null
+        && Calculation is null
+        && State is null
+        && Command is null
+        && Type is null
+        && FunctionalServices is null
+        && MaintenanceCategory is null
+        && ActivityType is null
+        && Position is null
+        && Detail is null;
+}
@@ -0,0 +1,108 @@
+using System.Buffers;
+using System.Text;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>Helpers for the TryFormat/WriteTo members, appending at <c>written</c> and advancing it</summary>
+internal static class SpanFormatting
+{
+    public static bool TryWrite(string value, Span<char> destination, ref int written)
+    {
+        if (!value.AsSpan().TryCopyTo(destination.Slice(written)))
+            return false;
+        written += value.Length;
+        return true;
+    }
+
+    public static bool TryWrite(char value, Span<char> destination, ref int written)
+    {
+        if (written >= destination.Length)
+            return false;
+        destination[written++] = value;
+        return true;
+    }
+
+    public static bool TryWrite(char value, Span<byte> destination, ref int written)
+    {
+        if (written >= destination.Length)
+            return false;
+        destination[written++] = (byte)value;
+        return true;
+    }
+
+    // Codes, locations and the naming rule are ASCII, other text is transcoded
+    public static bool TryWrite(string value, Span<byte> destination, ref int written)
+    {
+        var free = destination.Slice(written);
+        if (free.Length < value.Length)
+            return false;
+
+        var i = 0;
+        for (; i < value.Length; i++)
+        {
+            var ch = value[i];
+            if (ch > 0x7F)
+                break;
+            free[i] = (byte)ch;
+        }
+        if (i == value.Length)
+        {
+            written += value.Length;
+            return true;
+        }
+
+        var rest = value.AsSpan(i);
+        var count = GetByteCount(rest);
+        if (free.Length - i < count)
+            return false;
+        GetBytes(rest, free.Slice(i));
+        written += i + count;
+        return true;
+    }
+
+    public static void WriteTo(string value, IBufferWriter<byte> writer)
+    {
+        var count = GetByteCount(value.AsSpan());
+        var span = writer.GetSpan(count);
+        GetBytes(value.AsSpan(), span);
+        writer.Advance(count);
+    }
+
+    /// <summary>
+    /// Writes through <paramref name="tryFormat"/> into <paramref name="writer"/>,
+    /// asking for a larger span until it fits, starting at <paramref name="sizeHint"/> bytes
+    /// </summary>
+    public static void WriteTo<T>(T value, IBufferWriter<byte> writer, int sizeHint, TryFormatUtf8<T> tryFormat)
+    {
+        var size = Math.Max(sizeHint, 16);
+        while (true)
+        {
+            var span = writer.GetSpan(size);
+            if (tryFormat(value, span, out var written))
+            {
+                writer.Advance(written);
+                return;
+            }
+            size = Math.Max(size, span.Length) * 2;
+        }
+    }
+
+    public delegate bool TryFormatUtf8<T>(T value, Span<byte> destination, out int bytesWritten);
+
+    private static unsafe int GetByteCount(ReadOnlySpan<char> chars)
+    {
+        if (chars.Length == 0)
+            return 0;
+        fixed (char* ptr = chars)
+            return Encoding.UTF8.GetByteCount(ptr, chars.Length);
+    }
+
+    private static unsafe int GetBytes(ReadOnlySpan<char> chars, Span<byte> destination)
+    {
+        if (chars.Length == 0)
+            return 0;
+        fixed (char* ptr = chars)
+        fixed (byte* bytes = destination)
+            return Encoding.UTF8.GetBytes(ptr, chars.Length, bytes, destination.Length);
+    }
+}
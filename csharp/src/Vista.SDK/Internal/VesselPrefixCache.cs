@@ -0,0 +1,52 @@
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// Bounded, thread-safe table of the vessel prefixes of universal IDs, like <c>data.dnv.com/IMO1234567</c>,
+/// that have been validated, so the naming entity and IMO checksum are only checked once per vessel.
+/// </summary>
+/// <remarks>
+/// Direct mapped like <see cref="LocalIdInternTable"/>: a colliding prefix replaces the previous one,
+/// so a fleet of any size only costs <see cref="Capacity"/> slots, and lookups take no locks.
+/// Only valid prefixes are added, invalid ones are parsed again every time to report their errors.
+/// </remarks>
+internal sealed class VesselPrefixCache
+{
+    private sealed record Entry(uint Hash, string Prefix, ImoNumber ImoNumber);
+
+    private readonly Entry?[] _entries;
+    private readonly int _mask;
+
+    /// <param name="capacity">Number of slots, must be a power of 2</param>
+    public VesselPrefixCache(int capacity = 1024)
+    {
+        if (capacity < 1 || (capacity & (capacity - 1)) != 0)
+            throw new ArgumentOutOfRangeException(nameof(capacity), "Capacity must be a power of 2");
+
+        _entries = new Entry?[capacity];
+        _mask = capacity - 1;
+    }
+
+    public int Capacity => _entries.Length;
+
+    public bool TryGet(ReadOnlySpan<char> prefix, out ImoNumber imoNumber)
+    {
+        var hash = default(ChdStringHasher).Hash(prefix);
+        var entry = Volatile.Read(ref _entries[hash & _mask]);
+        if (entry is not null && entry.Hash == hash && prefix.SequenceEqual(entry.Prefix.AsSpan()))
+        {
+            imoNumber = entry.ImoNumber;
+            return true;
+        }
+
+        imoNumber = default;
+        return false;
+    }
+
+    public void Add(ReadOnlySpan<char> prefix, ImoNumber imoNumber)
+    {
+        var hash = default(ChdStringHasher).Hash(prefix);
+        Volatile.Write(ref _entries[hash & _mask], new Entry(hash, prefix.ToString(), imoNumber));
+    }
+
+    public void Clear() => Array.Clear(_entries, 0, _entries.Length);
+}
@@ -0,0 +1,136 @@
+using System.Diagnostics.Tracing;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// Event counters for <c>dotnet-counters</c> and model load events for tracing, fed by <see cref="VisTelemetry"/>.
+/// Totals are only kept while a session has the source enabled.
+/// </summary>
+[EventSource(Name = VisDiagnostics.EventSourceName)]
+internal sealed class VisEventSource : EventSource
+{
+    public static readonly VisEventSource Log = new VisEventSource();
+
+    private long _modelLoads;
+    private long _cacheHits;
+    private long _cacheMisses;
+    private long _localIdParses;
+    private long _localIdParseFailures;
+    private long _internHits;
+    private long _internMisses;
+    private long _gmodPathParses;
+    private long _gmodPathParseFailures;
+    private long _conversions;
+    private long _validations;
+    private long _validatedValues;
+
+#if NET8_0_OR_GREATER
+    private EventCounter? _modelLoadDurationCounter;
+    private DiagnosticCounter[]? _counters;
+
+    protected override void OnEventCommand(EventCommandEventArgs command)
+    {
+        if (command.Command != EventCommand.Enable || _counters is not null)
+            return;
+
+        _modelLoadDurationCounter = new EventCounter("model-load-duration", this)
+        {
+            DisplayName = "Model load duration",
+            DisplayUnits = "ms",
+        };
+        _counters =
+        [
+            _modelLoadDurationCounter,
+            Rate("model-loads", "Model loads", () => Volatile.Read(ref _modelLoads)),
+            Rate("vis-cache-hits", "VIS cache hits", () => Volatile.Read(ref _cacheHits)),
+            Rate("vis-cache-misses", "VIS cache misses", () => Volatile.Read(ref _cacheMisses)),
+            Rate("local-id-parses", "Local ID parses", () => Volatile.Read(ref _localIdParses)),
+            Rate("local-id-parse-failures", "Local ID parse failures", () => Volatile.Read(ref _localIdParseFailures)),
+            Rate("local-id-intern-hits", "Local ID intern table hits", () => Volatile.Read(ref _internHits)),
+            Rate("local-id-intern-misses", "Local ID intern table misses", () => Volatile.Read(ref _internMisses)),
+            Rate("gmod-path-parses", "Gmod path parses", () => Volatile.Read(ref _gmodPathParses)),
+            Rate(
+                "gmod-path-parse-failures",
+                "Gmod path parse failures",
+                () => Volatile.Read(ref _gmodPathParseFailures)
+            ),
+            Rate("versioning-conversions", "Versioning conversions", () => Volatile.Read(ref _conversions)),
+            Rate("time-series-validations", "Time series validations", () => Volatile.Read(ref _validations)),
+            Rate(
+                "time-series-validated-values",
+                "Time series values validated",
+                () => Volatile.Read(ref _validatedValues)
+            ),
+        ];
+    }
+
+    private IncrementingPollingCounter Rate(string name, string displayName, Func<double> total) =>
+        new IncrementingPollingCounter(name, this, total)
+        {
+            DisplayName = displayName,
+            DisplayRateTimeScale = TimeSpan.FromSeconds(1),
+        };
+#endif
+
+    [NonEvent]
+    public void CacheLookup(bool hit)
+    {
+        if (hit)
+            Interlocked.Increment(ref _cacheHits);
+        else
+            Interlocked.Increment(ref _cacheMisses);
+    }
+
+    [NonEvent]
+    public void LocalIdParsed(bool success)
+    {
+        Interlocked.Increment(ref _localIdParses);
+        if (!success)
+            Interlocked.Increment(ref _localIdParseFailures);
+    }
+
+    [NonEvent]
+    public void InternLookup(bool hit)
+    {
+        if (hit)
+            Interlocked.Increment(ref _internHits);
+        else
+            Interlocked.Increment(ref _internMisses);
+    }
+
+    [NonEvent]
+    public void GmodPathParsed(bool success)
+    {
+        Interlocked.Increment(ref _gmodPathParses);
+        if (!success)
+            Interlocked.Increment(ref _gmodPathParseFailures);
+    }
+
+    [NonEvent]
+    public void Converted(int count) => Interlocked.Add(ref _conversions, count);
+
+    [NonEvent]
+    public void Validated(long values)
+    {
+        Interlocked.Increment(ref _validations);
+        Interlocked.Add(ref _validatedValues, values);
+    }
+
+    [Event(1, Level = EventLevel.Informational, Message = "Loading {0} for VIS {1}")]
+    public void ModelLoadStart(string model, string visVersion) => WriteEvent(1, model, visVersion);
+
+    [Event(2, Level = EventLevel.Informational, Message = "Loaded {0} for VIS {1}")]
+    public void ModelLoadStop(string model, string visVersion)
+    {
+        Interlocked.Increment(ref _modelLoads);
+        WriteEvent(2, model, visVersion);
+    }
+
+    [NonEvent]
+    public void ModelLoadDuration(double milliseconds)
+    {
+#if NET8_0_OR_GREATER
+        _modelLoadDurationCounter?.WriteMetric(milliseconds);
+#endif
+    }
+}
@@ -0,0 +1,136 @@
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using Microsoft.Extensions.Caching.Memory;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// Models of one kind loaded by <see cref="VIS"/>, in slots indexed by VIS version.
+/// In <see cref="VisCacheMode.Registry"/> mode readers only do a volatile array read and each slot is built once
+/// under its own lock, so that loading different versions in parallel does not contend.
+/// Lookups and loads are reported to <see cref="VisTelemetry"/> under the cache's model name.
+/// </summary>
+internal sealed class VisModelCache<T>
+    where T : class
+{
+    private readonly string _model;
+    private readonly bool _perVersion;
+
+    private readonly T?[]? _models;
+    private readonly object[]? _locks;
+
+    private readonly MemoryCache? _cache;
+    private readonly TimeSpan _slidingExpiration;
+
+    private VisModelCache(string model, bool perVersion)
+    {
+        _model = model;
+        _perVersion = perVersion;
+    }
+
+    private VisModelCache(string model, bool perVersion, int slots)
+        : this(model, perVersion)
+    {
+        _models = new T?[slots];
+        _locks = new object[slots];
+        for (var i = 0; i < slots; i++)
+            _locks[i] = new object();
+    }
+
+    private VisModelCache(string model, bool perVersion, VisOptions options)
+        : this(model, perVersion)
+    {
+        _cache = new MemoryCache(
+            new MemoryCacheOptions
+            {
+                SizeLimit = options.SizeLimit,
+                ExpirationScanFrequency = options.SlidingExpiration,
+            }
+        );
+        _slidingExpiration = options.SlidingExpiration;
+    }
+
+    /// <summary>
+    /// Creates a cache for models reported as <paramref name="model"/>, tagged with the VIS version of their slot
+    /// unless there is a single model shared by all versions
+    /// </summary>
+    public static VisModelCache<T> Create(string model, VisOptions options, int slots, bool perVersion = true) =>
+        options.CacheMode == VisCacheMode.Registry
+            ? new VisModelCache<T>(model, perVersion, slots)
+            : CreateExpiring(model, options, perVersion);
+
+    /// <inheritdoc cref="Create"/>
+    public static VisModelCache<T> CreateExpiring(string model, VisOptions options, bool perVersion = true) =>
+        new VisModelCache<T>(model, perVersion, options);
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public T GetOrCreate<TState>(int slot, TState state, Func<TState, T> factory)
+    {
+        var models = _models;
+        if (models is null)
+            return GetOrCreateExpiring(slot, state, factory);
+
+        var registered = Volatile.Read(ref models[slot]);
+        if (registered is null)
+            return CreateRegistered(slot, state, factory);
+
+        VisTelemetry.CacheLookup(_model, hit: true);
+        return registered;
+    }
+
+    private T GetOrCreateExpiring<TState>(int slot, TState state, Func<TState, T> factory)
+    {
+        if (_cache!.TryGetValue(slot, out var value))
+        {
+            VisTelemetry.CacheLookup(_model, hit: true);
+            return (T)value!;
+        }
+
+        VisTelemetry.CacheLookup(_model, hit: false);
+        var model = Load(slot, state, factory);
+        using (var entry = _cache.CreateEntry(slot))
+        {
+            entry.Size = 1;
+            entry.SlidingExpiration = _slidingExpiration;
+            entry.Value = model;
+        }
+        return model;
+    }
+
+    private T CreateRegistered<TState>(int slot, TState state, Func<TState, T> factory)
+    {
+        lock (_locks![slot])
+        {
+            var model = Volatile.Read(ref _models![slot]);
+            VisTelemetry.CacheLookup(_model, hit: model is not null);
+            if (model is not null)
+                return model;
+
+            model = Load(slot, state, factory);
+            Volatile.Write(ref _models[slot], model);
+            return model;
+        }
+    }
+
+    private T Load<TState>(int slot, TState state, Func<TState, T> factory)
+    {
+        var visVersion = _perVersion ? VisTelemetry.VersionName(slot) : "";
+        using var activity = VisTelemetry.StartModelLoad(_model, visVersion);
+        var start = Stopwatch.GetTimestamp();
+        var model = factory(state);
+        VisTelemetry.ModelLoaded(_model, visVersion, start);
+        return model;
+    }
+
+    public void Clear()
+    {
+        if (_cache is not null)
+        {
+            _cache.Compact(1.0);
+            return;
+        }
+
+        for (var i = 0; i < _models!.Length; i++)
+            Volatile.Write(ref _models[i], null);
+    }
+}
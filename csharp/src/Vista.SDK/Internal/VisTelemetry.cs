@@ -0,0 +1,233 @@
+using System.Diagnostics;
+using System.Diagnostics.Metrics;
+using System.Runtime.CompilerServices;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>
+/// Records SDK activity to the meter, activity source and event source named in <see cref="VisDiagnostics"/>.
+/// Every method first checks whether anyone is listening, so hot paths only pay for a few field reads when not.
+/// </summary>
+internal static class VisTelemetry
+{
+    public const string Node = "node";
+    public const string Path = "path";
+    public const string LocalId = "local_id";
+
+    public const string ShortPath = "short";
+    public const string FullPath = "full";
+
+    public static readonly Meter Meter = new Meter(
+        VisDiagnostics.MeterName,
+        typeof(VisTelemetry).Assembly.GetName().Version?.ToString()
+    );
+
+    public static readonly ActivitySource ActivitySource = new ActivitySource(
+        VisDiagnostics.ActivitySourceName,
+        typeof(VisTelemetry).Assembly.GetName().Version?.ToString()
+    );
+
+    private static readonly VisEventSource _log = VisEventSource.Log;
+
+    private static readonly Histogram<double> _modelLoadDuration = Meter.CreateHistogram<double>(
+        "vista.model.load.duration",
+        "ms",
+        "Time spent building a model on a VIS cache miss"
+    );
+
+    private static readonly Counter<long> _cacheLookups = Meter.CreateCounter<long>(
+        "vista.vis.cache.lookups",
+        description: "Model lookups in VIS, tagged with whether the model was already loaded"
+    );
+
+    private static readonly Counter<long> _localIdParses = Meter.CreateCounter<long>(
+        "vista.local_id.parses",
+        description: "Local IDs parsed, tagged with the outcome"
+    );
+
+    private static readonly Counter<long> _internLookups = Meter.CreateCounter<long>(
+        "vista.local_id.intern.lookups",
+        description: "Local ID lookups in intern tables, tagged with whether the ID was already interned"
+    );
+
+    private static readonly Counter<long> _gmodPathParses = Meter.CreateCounter<long>(
+        "vista.gmod_path.parses",
+        description: "Gmod paths parsed, tagged with the format and the outcome"
+    );
+
+    private static readonly Counter<long> _conversions = Meter.CreateCounter<long>(
+        "vista.versioning.conversions",
+        description: "Nodes, paths and local IDs converted between VIS versions, tagged with the outcome"
+    );
+
+    private static readonly Histogram<double> _validationDuration = Meter.CreateHistogram<double>(
+        "vista.time_series.validation.duration",
+        "ms",
+        "Time spent validating time series data against a data channel list"
+    );
+
+    private static readonly Counter<long> _validatedValues = Meter.CreateCounter<long>(
+        "vista.time_series.validated_values",
+        description: "Tabular and event values in validated time series data"
+    );
+
+    private static readonly object _hit = "hit";
+    private static readonly object _miss = "miss";
+    private static readonly object _success = "success";
+    private static readonly object _failure = "failure";
+
+    private static readonly string[] _visVersions = Enum.GetValues(typeof(VisVersion))
+        .Cast<VisVersion>()
+        .Select(v => v.ToVersionString())
+        .ToArray();
+
+    private static KeyValuePair<string, object?> Result(bool success) =>
+        new KeyValuePair<string, object?>("result", success ? _success : _failure);
+
+    private static double ElapsedMilliseconds(long start) =>
+        (Stopwatch.GetTimestamp() - start) * 1000.0 / Stopwatch.Frequency;
+
+    /// <summary>VIS version tag of a model cache slot</summary>
+    public static string VersionName(int slot) => (uint)slot < (uint)_visVersions.Length ? _visVersions[slot] : "";
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static void CacheLookup(string model, bool hit)
+    {
+        if (_cacheLookups.Enabled || _log.IsEnabled())
+            RecordCacheLookup(model, hit);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void RecordCacheLookup(string model, bool hit)
+    {
+        if (_cacheLookups.Enabled)
+        {
+            _cacheLookups.Add(
+                1,
+                new KeyValuePair<string, object?>("model", model),
+                new KeyValuePair<string, object?>("result", hit ? _hit : _miss)
+            );
+        }
+        if (_log.IsEnabled())
+            _log.CacheLookup(hit);
+    }
+
+    /// <returns>The span for loading the model if anyone is sampling <see cref="ActivitySource"/></returns>
+    public static Activity? StartModelLoad(string model, string visVersion)
+    {
+        if (_log.IsEnabled())
+            _log.ModelLoadStart(model, visVersion);
+
+        var activity = ActivitySource.StartActivity("vista.model.load");
+        if (activity is not null)
+        {
+            activity.SetTag("model", model);
+            if (visVersion.Length > 0)
+                activity.SetTag("vis_version", visVersion);
+        }
+        return activity;
+    }
+
+    public static void ModelLoaded(string model, string visVersion, long start)
+    {
+        if (_modelLoadDuration.Enabled)
+        {
+            _modelLoadDuration.Record(
+                ElapsedMilliseconds(start),
+                new KeyValuePair<string, object?>("model", model),
+                new KeyValuePair<string, object?>("vis_version", visVersion)
+            );
+        }
+        if (_log.IsEnabled())
+        {
+            _log.ModelLoadDuration(ElapsedMilliseconds(start));
+            _log.ModelLoadStop(model, visVersion);
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static void LocalIdParsed(bool success)
+    {
+        if (_localIdParses.Enabled)
+            _localIdParses.Add(1, Result(success));
+        if (_log.IsEnabled())
+            _log.LocalIdParsed(success);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static void InternLookup(bool hit)
+    {
+        if (_internLookups.Enabled || _log.IsEnabled())
+            RecordInternLookup(hit);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void RecordInternLookup(bool hit)
+    {
+        if (_internLookups.Enabled)
+            _internLookups.Add(1, new KeyValuePair<string, object?>("result", hit ? _hit : _miss));
+        if (_log.IsEnabled())
+            _log.InternLookup(hit);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static void GmodPathParsed(string format, bool success)
+    {
+        if (_gmodPathParses.Enabled)
+            _gmodPathParses.Add(1, new KeyValuePair<string, object?>("format", format), Result(success));
+        if (_log.IsEnabled())
+            _log.GmodPathParsed(success);
+    }
+
+    /// <returns><paramref name="result"/></returns>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static T? Converted<T>(string kind, T? result)
+        where T : class
+    {
+        if (_conversions.Enabled)
+            _conversions.Add(1, new KeyValuePair<string, object?>("kind", kind), Result(result is not null));
+        if (_log.IsEnabled())
+            _log.Converted(1);
+        return result;
+    }
+
+    /// <returns><paramref name="results"/></returns>
+    public static IReadOnlyList<T?> ConvertedAll<T>(string kind, IReadOnlyList<T?> results)
+        where T : class
+    {
+        if (_conversions.Enabled)
+        {
+            var converted = 0;
+            for (var i = 0; i < results.Count; i++)
+            {
+                if (results[i] is not null)
+                    converted++;
+            }
+            var kindTag = new KeyValuePair<string, object?>("kind", kind);
+            if (converted > 0)
+                _conversions.Add(converted, kindTag, Result(true));
+            if (converted < results.Count)
+                _conversions.Add(results.Count - converted, kindTag, Result(false));
+        }
+        if (_log.IsEnabled())
+            _log.Converted(results.Count);
+        return results;
+    }
+
+    /// <summary>Whether <see cref="Validated"/> records anything, so callers can skip counting values</summary>
+    public static bool IsValidationEnabled =>
+        _validatedValues.Enabled || _validationDuration.Enabled || _log.IsEnabled();
+
+    public static Activity? StartValidation() => ActivitySource.StartActivity("vista.time_series.validate");
+
+    public static void Validated(bool success, long values, long start)
+    {
+        var result = Result(success);
+        if (_validationDuration.Enabled)
+            _validationDuration.Record(ElapsedMilliseconds(start), result);
+        if (_validatedValues.Enabled)
+            _validatedValues.Add(values, result);
+        if (_log.IsEnabled())
+            _log.Validated(values);
+    }
+}
@@ -1,13 +1,35 @@
+using System.Buffers;
+using System.Diagnostics.CodeAnalysis;
+using System.Text;
 using Vista.SDK.Internal;
 
 namespace Vista.SDK;
 
-public class LocalId : ILocalId<LocalId>, IEquatable<LocalId>
+public class LocalId
+    : ILocalId<LocalId>,
+        IEquatable<LocalId>
+#if NET8_0_OR_GREATER
+        ,
+        ISpanFormattable,
+        IUtf8SpanFormattable
+#endif
 {
     public static readonly string NamingRule = "dnv-v2";
 
+    // Local IDs parsed through the span overloads when no InternTable is set
+    internal static readonly LocalIdInternTable ParseCache = new();
+
+    private static volatile LocalIdInternTable? _internTable;
+
+    // Longest UTF-8 local ID decoded on the stack, longer ones are decoded into a pooled buffer
+    internal const int MaxStackallocChars = 256;
+
     private readonly LocalIdBuilder _builder;
 
+    // The canonical string and its UTF-8 form, formatted once on first use since local IDs are immutable
+    private string? _string;
+    private byte[]? _utf8;
+
     public LocalIdBuilder Builder => _builder;
 
     internal LocalId(LocalIdBuilder builder)
@@ -53,6 +75,8 @@ public bool Equals(LocalId? other)
     {
         if (other is null)
             return false;
+        if (ReferenceEquals(this, other))
+            return true;
 
         return _builder.Equals(other._builder);
     }
@@ -72,12 +96,103 @@ public bool Equals(LocalId? other)
 
     public sealed override int GetHashCode() => _builder.GetHashCode();
 
-    public override string ToString() => _builder.ToString();
+    public override string ToString() => _string ??= _builder.ToString();
+
+    /// <summary>The canonical UTF-8 form of <see cref="ToString()"/>, formatted once and shared</summary>
+    public ReadOnlySpan<byte> Utf8Value => _utf8 ??= Encoding.UTF8.GetBytes(ToString());
+
+    /// <summary>Copies the canonical string into <paramref name="destination"/>, the format is ignored</summary>
+    public bool TryFormat(
+        Span<char> destination,
+        out int charsWritten,
+        ReadOnlySpan<char> format = default,
+        IFormatProvider? provider = null
+    )
+    {
+        var value = ToString();
+        if (!value.AsSpan().TryCopyTo(destination))
+        {
+            charsWritten = 0;
+            return false;
+        }
+        charsWritten = value.Length;
+        return true;
+    }
+
+    /// <summary>Copies the canonical UTF-8 form into <paramref name="destination"/></summary>
+    public bool TryFormatUtf8(Span<byte> destination, out int bytesWritten)
+    {
+        var value = Utf8Value;
+        if (!value.TryCopyTo(destination))
+        {
+            bytesWritten = 0;
+            return false;
+        }
+        bytesWritten = value.Length;
+        return true;
+    }
+
+    /// <summary>Copies the canonical UTF-8 form into <paramref name="writer"/></summary>
+    public void WriteTo(IBufferWriter<byte> writer)
+    {
+        if (writer is null)
+            throw new ArgumentNullException(nameof(writer));
+        var value = Utf8Value;
+        value.CopyTo(writer.GetSpan(value.Length));
+        writer.Advance(value.Length);
+    }
+
+#if NET8_0_OR_GREATER
+    string IFormattable.ToString(string? format, IFormatProvider? formatProvider) => ToString();
+
+    bool IUtf8SpanFormattable.TryFormat(
+        Span<byte> utf8Destination,
+        out int bytesWritten,
+        ReadOnlySpan<char> format,
+        IFormatProvider? provider
+    ) => TryFormatUtf8(utf8Destination, out bytesWritten);
+#endif
 
-    public static LocalId Parse(string localIdStr) => LocalIdBuilder.Parse(localIdStr).Build();
+    /// <summary>
+    /// Opt-in table that parsing from strings interns local IDs in, including <see cref="Transport.DataChannelId.Parse"/>
+    /// and the JSON converters. Repeated IDs then resolve to one shared instance instead of being parsed again.
+    /// It is null by default. The span overloads of <c>TryParse</c> always cache, in this table when it is set.
+    /// </summary>
+    public static LocalIdInternTable? InternTable
+    {
+        get => _internTable;
+        set => _internTable = value;
+    }
+
+    public static LocalId Parse(string localIdStr)
+    {
+        if (_internTable is not { } table)
+            return LocalIdBuilder.Parse(localIdStr).Build();
+
+        if (localIdStr is null)
+            throw new ArgumentNullException(nameof(localIdStr));
+        if (TryGetInterned(table, localIdStr.AsSpan(), out var localId))
+            return localId;
+
+        localId = LocalIdBuilder.Parse(localIdStr).Build();
+        table.Add(localIdStr, localId);
+        return localId;
+    }
 
     public static bool TryParse(string localIdStr, out ParsingErrors errors, out LocalId? localId)
     {
+        var table = _internTable;
+        if (table is not null)
+        {
+            if (localIdStr is null)
+                throw new ArgumentNullException(nameof(localIdStr));
+            if (TryGetInterned(table, localIdStr.AsSpan(), out localId))
+            {
+                errors = ParsingErrors.Empty;
+                return true;
+            }
+        }
+
         if (!LocalIdBuilder.TryParse(localIdStr, out errors, out var localIdBuilder))
         {
             localId = null;
@@ -85,6 +200,147 @@ public static bool TryParse(string localIdStr, out ParsingErrors errors, out Loc
         }
 
         localId = localIdBuilder.Build();
+        table?.Add(localIdStr, localId);
         return true;
     }
+
+    /// <summary>Parses without diagnostics, interning the result if <see cref="InternTable"/> is set</summary>
+    internal static bool TryParseSilent(string localIdStr, [NotNullWhen(true)] out LocalId? localId)
+    {
+        if (localIdStr is null)
+            throw new ArgumentNullException(nameof(localIdStr));
+
+        var table = _internTable;
+        if (table is not null && TryGetInterned(table, localIdStr.AsSpan(), out localId))
+            return true;
+
+        var errorBuilder = LocalIdParsingErrorBuilder.Silent;
+        return TryParseUncached(localIdStr.AsSpan(), localIdStr, table, ref errorBuilder, out localId);
+    }
+
+    /// <summary>
+    /// Parses a local ID without building error messages.
+    /// IDs that have been parsed before are returned from a bounded cache without allocating.
+    /// </summary>
+    public static bool TryParse(ReadOnlySpan<char> localIdStr, [NotNullWhen(true)] out LocalId? localId)
+    {
+        var cache = _internTable ?? ParseCache;
+        if (TryGetInterned(cache, localIdStr, out localId))
+            return true;
+
+        var errorBuilder = LocalIdParsingErrorBuilder.Silent;
+        return TryParseUncached(localIdStr, null, cache, ref errorBuilder, out localId);
+    }
+
+    /// <summary>
+    /// Parses a local ID like <see cref="TryParse(ReadOnlySpan{char}, out LocalId?)"/>, and
+    /// reports the reasons in <paramref name="errors"/> when parsing fails
+    /// </summary>
+    public static bool TryParse(
+        ReadOnlySpan<char> localIdStr,
+        out ParsingErrors errors,
+        [NotNullWhen(true)] out LocalId? localId
+    )
+    {
+        var cache = _internTable ?? ParseCache;
+        if (TryGetInterned(cache, localIdStr, out localId))
+        {
+            errors = ParsingErrors.Empty;
+            return true;
+        }
+
+        var errorBuilder = LocalIdParsingErrorBuilder.Empty;
+        var result = TryParseUncached(localIdStr, null, cache, ref errorBuilder, out localId);
+        errors = errorBuilder.Build();
+        return result;
+    }
+
+    /// <inheritdoc cref="TryParse(ReadOnlySpan{char}, out LocalId?)"/>
+    public static bool TryParse(ReadOnlySpan<byte> utf8, [NotNullWhen(true)] out LocalId? localId)
+    {
+        char[]? rented = null;
+        Span<char> buffer =
+            utf8.Length <= MaxStackallocChars
+                ? stackalloc char[utf8.Length]
+                : (rented = ArrayPool<char>.Shared.Rent(utf8.Length));
+        try
+        {
+            var length = DecodeUtf8(utf8, buffer);
+            return TryParse(buffer.Slice(0, length), out localId);
+        }
+        finally
+        {
+            if (rented is not null)
+                ArrayPool<char>.Shared.Return(rented);
+        }
+    }
+
+    /// <inheritdoc cref="TryParse(ReadOnlySpan{char}, out ParsingErrors, out LocalId?)"/>
+    public static bool TryParse(
+        ReadOnlySpan<byte> utf8,
+        out ParsingErrors errors,
+        [NotNullWhen(true)] out LocalId? localId
+    )
+    {
+        char[]? rented = null;
+        Span<char> buffer =
+            utf8.Length <= MaxStackallocChars
+                ? stackalloc char[utf8.Length]
+                : (rented = ArrayPool<char>.Shared.Rent(utf8.Length));
+        try
+        {
+            var length = DecodeUtf8(utf8, buffer);
+            return TryParse(buffer.Slice(0, length), out errors, out localId);
+        }
+        finally
+        {
+            if (rented is not null)
+                ArrayPool<char>.Shared.Return(rented);
+        }
+    }
+
+    // Hits count as parses, like the parses they save, and the intern lookups tell them apart
+    private static bool TryGetInterned(
+        LocalIdInternTable table,
+        ReadOnlySpan<char> localIdStr,
+        [NotNullWhen(true)] out LocalId? localId
+    )
+    {
+        if (!table.TryGet(localIdStr, out localId))
+            return false;
+
+        VisTelemetry.LocalIdParsed(success: true);
+        return true;
+    }
+
+    // The key is only allocated from the span if the caller doesn't already have it as a string
+    private static bool TryParseUncached(
+        ReadOnlySpan<char> localIdStr,
+        string? key,
+        LocalIdInternTable? cache,
+        ref LocalIdParsingErrorBuilder errorBuilder,
+        [NotNullWhen(true)] out LocalId? localId
+    )
+    {
+        if (!LocalIdBuilder.TryParseInternal(localIdStr, ref errorBuilder, out var localIdBuilder))
+        {
+            localId = null;
+            return false;
+        }
+
+        localId = localIdBuilder.Build();
+        cache?.Add(key ?? localIdStr.ToString(), localId);
+        return true;
+    }
+
+    // UTF-8 never decodes to more chars than it has bytes, so a buffer of utf8.Length chars always fits
+    internal static unsafe int DecodeUtf8(ReadOnlySpan<byte> utf8, Span<char> buffer)
+    {
+        if (utf8.Length == 0)
+            return 0;
+
+        fixed (byte* bytes = utf8)
+        fixed (char* chars = buffer)
+            return Encoding.UTF8.GetChars(bytes, utf8.Length, chars, buffer.Length);
+    }
 }
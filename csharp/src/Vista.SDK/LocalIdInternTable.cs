@@ -0,0 +1,66 @@
+using System.Diagnostics.CodeAnalysis;
+using Vista.SDK.Internal;
+
+namespace Vista.SDK;
+
+/// <summary>
+/// Bounded, thread-safe table of parsed local IDs keyed by the text they were parsed from,
+/// so that IDs that are seen repeatedly resolve to one shared <see cref="LocalId"/> instead of being parsed again.
+/// </summary>
+/// <remarks>
+/// The table is direct mapped: each hash selects a single slot, and a colliding ID replaces the previous one,
+/// so memory use is fixed by <see cref="Capacity"/> no matter how many distinct IDs are seen.
+/// Slots hold immutable entries that are published with a single reference write, so lookups take no locks.
+/// Enable it for string based parsing through <see cref="LocalId.InternTable"/>.
+/// Hits and misses are counted by the <c>vista.local_id.intern.lookups</c> instrument
+/// and the <c>local-id-intern-hits</c> and <c>local-id-intern-misses</c> event counters, see <see cref="VisDiagnostics"/>.
+/// </remarks>
+public sealed class LocalIdInternTable
+{
+    private sealed record Entry(uint Hash, string Key, LocalId Value);
+
+    private readonly Entry?[] _entries;
+    private readonly int _mask;
+
+    /// <param name="capacity">Number of slots, must be a power of 2</param>
+    public LocalIdInternTable(int capacity = 4096)
+    {
+        if (capacity < 1 || (capacity & (capacity - 1)) != 0)
+            throw new ArgumentOutOfRangeException(nameof(capacity), "Capacity must be a power of 2");
+
+        _entries = new Entry?[capacity];
+        _mask = capacity - 1;
+    }
+
+    public int Capacity => _entries.Length;
+
+    public bool TryGet(ReadOnlySpan<char> localIdStr, [NotNullWhen(true)] out LocalId? localId)
+    {
+        var hash = default(ChdStringHasher).Hash(localIdStr);
+        var entry = Volatile.Read(ref _entries[hash & _mask]);
+        if (entry is not null && entry.Hash == hash && localIdStr.SequenceEqual(entry.Key.AsSpan()))
+        {
+            localId = entry.Value;
+            VisTelemetry.InternLookup(hit: true);
+            return true;
+        }
+
+        localId = null;
+        VisTelemetry.InternLookup(hit: false);
+        return false;
+    }
+
+    /// <summary>Interns <paramref name="localId"/> as the result of parsing <paramref name="localIdStr"/></summary>
+    public void Add(string localIdStr, LocalId localId)
+    {
+        if (localIdStr is null)
+            throw new ArgumentNullException(nameof(localIdStr));
+        if (localId is null)
+            throw new ArgumentNullException(nameof(localId));
+
+        var hash = default(ChdStringHasher).Hash(localIdStr.AsSpan());
+        Volatile.Write(ref _entries[hash & _mask], new Entry(hash, localIdStr, localId));
+    }
+
+    public void Clear() => Array.Clear(_entries, 0, _entries.Length);
+}
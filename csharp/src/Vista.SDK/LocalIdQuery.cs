@@ -6,6 +6,8 @@ public sealed record LocalIdQuery
 
     internal LocalIdQuery(LocalIdQueryBuilder builder) => _builder = builder;
 
+    internal LocalIdQueryBuilder Builder => _builder;
+
     public bool Match(LocalId other) => _builder.Match(other);
 
     public bool Match(string other) => _builder.Match(other);
@@ -10,6 +10,11 @@ public sealed record LocalIdQueryBuilder
     private MetadataTagsQuery? _tags;
     private bool? _requireSecondaryItem;
 
+    internal GmodPathQuery? PrimaryItemQuery => _primaryItem;
+    internal GmodPathQuery? SecondaryItemQuery => _secondaryItem;
+    internal MetadataTagsQuery? TagsQuery => _tags;
+    internal bool? RequireSecondaryItem => _requireSecondaryItem;
+
     public LocalIdQuery Build() => new(this);
 
     public static LocalIdQueryBuilder Empty() => new();
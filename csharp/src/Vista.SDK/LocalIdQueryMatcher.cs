@@ -0,0 +1,300 @@
+namespace Vista.SDK;
+
+/// <summary>
+/// A set of <see cref="LocalIdQuery"/> compiled into an indexed matcher,
+/// to find which of many queries match a <see cref="LocalId"/> without evaluating each of them.
+/// </summary>
+/// <remarks>
+/// The queries are snapshotted when compiled, later changes to their builders are not reflected.
+/// Nodes of the queries are converted to the latest VIS version once, here,
+/// and each matched <see cref="LocalId"/> is converted once for all queries.
+/// </remarks>
+public sealed class LocalIdQueryMatcher
+{
+    private readonly LocalIdQuery[] _queries;
+    private readonly CompiledLocalIdQuery[] _compiled;
+
+    // Queries keyed by one node code their primary item requires, queries without one are always candidates
+    private readonly Dictionary<string, List<int>> _byPrimaryCode;
+    private readonly int[] _unindexed;
+
+    private LocalIdQueryMatcher(LocalIdQuery[] queries)
+    {
+        _queries = queries;
+        _compiled = new CompiledLocalIdQuery[queries.Length];
+        _byPrimaryCode = new();
+        var unindexed = new List<int>();
+        for (var i = 0; i < queries.Length; i++)
+        {
+            var compiled = CompiledLocalIdQuery.Compile(queries[i]);
+            _compiled[i] = compiled;
+            if (compiled.PrimaryItem is { Nodes.Length: > 0 } primary)
+            {
+                var code = primary.Nodes[0].Code;
+                if (!_byPrimaryCode.TryGetValue(code, out var list))
+                    _byPrimaryCode.Add(code, list = new());
+                list.Add(i);
+            }
+            else
+            {
+                unindexed.Add(i);
+            }
+        }
+        _unindexed = unindexed.ToArray();
+    }
+
+    public static LocalIdQueryMatcher Compile(IEnumerable<LocalIdQuery> queries)
+    {
+        if (queries is null)
+            throw new ArgumentNullException(nameof(queries));
+        return new LocalIdQueryMatcher(queries.ToArray());
+    }
+
+    public static LocalIdQueryMatcher Compile(params LocalIdQuery[] queries) =>
+        Compile((IEnumerable<LocalIdQuery>)queries);
+
+    /// <summary>The compiled queries, results of this matcher refer to them by index</summary>
+    public IReadOnlyList<LocalIdQuery> Queries => _queries;
+
+    internal CompiledLocalIdQuery GetCompiled(int index) => _compiled[index];
+
+    /// <summary>Returns the indices of the queries matching <paramref name="localId"/>, in ascending order</summary>
+    public IReadOnlyList<int> Match(LocalId localId) => Match(PreparedLocalId.Create(localId));
+
+    public IReadOnlyList<int> Match(string localId) => Match(LocalId.Parse(localId));
+
+    /// <summary>Returns true if any of the queries match <paramref name="localId"/></summary>
+    public bool MatchAny(LocalId localId)
+    {
+        var target = PreparedLocalId.Create(localId);
+        foreach (var i in _unindexed)
+        {
+            if (_compiled[i].Match(target))
+                return true;
+        }
+        foreach (var code in target.PrimaryItem.Keys)
+        {
+            if (!_byPrimaryCode.TryGetValue(code, out var candidates))
+                continue;
+            foreach (var i in candidates)
+            {
+                if (_compiled[i].Match(target))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    internal IReadOnlyList<int> Match(PreparedLocalId target)
+    {
+        var result = new List<int>();
+        foreach (var i in _unindexed)
+        {
+            if (_compiled[i].Match(target))
+                result.Add(i);
+        }
+        var hasIndexed = false;
+        foreach (var code in target.PrimaryItem.Keys)
+        {
+            if (!_byPrimaryCode.TryGetValue(code, out var candidates))
+                continue;
+            foreach (var i in candidates)
+            {
+                if (_compiled[i].Match(target))
+                {
+                    result.Add(i);
+                    hasIndexed = true;
+                }
+            }
+        }
+        if (hasIndexed)
+            result.Sort();
+        return result;
+    }
+}
+
+/// <summary>A <see cref="LocalId"/> converted to the latest VIS version, in the shape queries are matched against</summary>
+internal sealed class PreparedLocalId
+{
+    private PreparedLocalId(LocalId localId)
+    {
+        LocalId = localId;
+        PrimaryItem = GetNodes(localId.PrimaryItem);
+        SecondaryItem = localId.SecondaryItem is null ? null : GetNodes(localId.SecondaryItem);
+        Tags = new(localId.MetadataTags.Count);
+        foreach (var tag in localId.MetadataTags)
+            Tags[tag.Name] = tag;
+    }
+
+    /// <summary>The local ID at the latest VIS version</summary>
+    public LocalId LocalId { get; }
+
+    /// <summary>Locations of each node code in the primary item, empty for nodes without location</summary>
+    public Dictionary<string, List<Location>> PrimaryItem { get; }
+
+    public Dictionary<string, List<Location>>? SecondaryItem { get; }
+
+    public Dictionary<CodebookName, MetadataTag> Tags { get; }
+
+    public static PreparedLocalId Create(LocalId localId)
+    {
+        if (localId.VisVersion < VIS.LatestVisVersion)
+        {
+            localId =
+                VIS.Instance.ConvertLocalId(localId, VIS.LatestVisVersion)
+                ?? throw new Exception("Failed to convert local id");
+        }
+        return new PreparedLocalId(localId);
+    }
+
+    /// <summary>Expects <paramref name="localId"/> to already be at the latest VIS version</summary>
+    public static PreparedLocalId CreateLatest(LocalId localId) => new(localId);
+
+    private static Dictionary<string, List<Location>> GetNodes(GmodPath path)
+    {
+        var nodes = new Dictionary<string, List<Location>>(path.Length);
+        foreach (var (_, node) in path.GetFullPath())
+        {
+            if (!nodes.TryGetValue(node.Code, out var locations))
+                nodes.Add(node.Code, locations = new(0));
+            if (node.Location is not null)
+                locations.Add(node.Location.Value);
+        }
+        return nodes;
+    }
+}
+
+/// <summary>
+/// The filters of a <see cref="LocalIdQuery"/> flattened for matching,
+/// with the same semantics as <see cref="LocalIdQueryBuilder"/>.
+/// </summary>
+internal sealed class CompiledLocalIdQuery
+{
+    private CompiledLocalIdQuery(
+        CompiledPathQuery? primaryItem,
+        CompiledPathQuery? secondaryItem,
+        bool? requireSecondaryItem,
+        MetadataTag[]? tags,
+        bool matchExactTags
+    )
+    {
+        PrimaryItem = primaryItem;
+        SecondaryItem = secondaryItem;
+        RequireSecondaryItem = requireSecondaryItem;
+        Tags = tags;
+        MatchExactTags = matchExactTags;
+    }
+
+    public CompiledPathQuery? PrimaryItem { get; }
+
+    public CompiledPathQuery? SecondaryItem { get; }
+
+    public bool? RequireSecondaryItem { get; }
+
+    /// <summary>The tags a local ID must have, null if tags are not queried</summary>
+    public MetadataTag[]? Tags { get; }
+
+    public bool MatchExactTags { get; }
+
+    /// <summary>True if the query can't match anything, an exact tag query without tags</summary>
+    public bool MatchesNothing => Tags is { Length: 0 } && MatchExactTags;
+
+    public static CompiledLocalIdQuery Compile(LocalIdQuery query)
+    {
+        var builder = query.Builder;
+        var tagsQuery = builder.TagsQuery?.Builder;
+        return new CompiledLocalIdQuery(
+            builder.PrimaryItemQuery is { } primary ? CompiledPathQuery.Compile(primary) : null,
+            builder.SecondaryItemQuery is { } secondary ? CompiledPathQuery.Compile(secondary) : null,
+            builder.RequireSecondaryItem,
+            tagsQuery?.Tags.Values.ToArray(),
+            tagsQuery?.MatchExact ?? false
+        );
+    }
+
+    public bool Match(PreparedLocalId target)
+    {
+        if (PrimaryItem is not null && !PrimaryItem.Match(target.PrimaryItem))
+            return false;
+        if (SecondaryItem is not null && (target.SecondaryItem is null || !SecondaryItem.Match(target.SecondaryItem)))
+            return false;
+        if (RequireSecondaryItem.HasValue && RequireSecondaryItem.Value != (target.SecondaryItem is not null))
+            return false;
+        if (Tags is not null && !MatchTags(target.Tags))
+            return false;
+        return true;
+    }
+
+    private bool MatchTags(Dictionary<CodebookName, MetadataTag> targetTags)
+    {
+        if (Tags!.Length == 0)
+            return !MatchExactTags;
+        if (MatchExactTags && Tags.Length != targetTags.Count)
+            return false;
+        foreach (var tag in Tags)
+        {
+            if (!targetTags.TryGetValue(tag.Name, out var other) || !tag.Equals(other))
+                return false;
+        }
+        return true;
+    }
+}
+
+internal sealed class CompiledPathQuery
+{
+    private CompiledPathQuery(CompiledNodeFilter[] nodes) => Nodes = nodes;
+
+    /// <summary>The filters that take part in matching, with nodes at the latest VIS version</summary>
+    public CompiledNodeFilter[] Nodes { get; }
+
+    public static CompiledPathQuery Compile(GmodPathQuery query)
+    {
+        var nodes = new List<CompiledNodeFilter>(query.Builder.Filter.Count);
+        foreach (var item in query.Builder.Filter.Values)
+        {
+            if (item.IgnoreInMatching)
+                continue;
+            var node = GmodPathQueryBuilder.EnsureNodeVersion(item.Node);
+            nodes.Add(
+                new CompiledNodeFilter(
+                    node.Code,
+                    item.MatchAllLocations,
+                    item.MatchAllLocations || item.Locations.Count == 0 ? null : item.Locations.ToArray()
+                )
+            );
+        }
+        return new CompiledPathQuery(nodes.ToArray());
+    }
+
+    public bool Match(Dictionary<string, List<Location>> target)
+    {
+        foreach (var filter in Nodes)
+        {
+            if (!target.TryGetValue(filter.Code, out var potentialLocations))
+                return false;
+            if (!filter.MatchesLocations(potentialLocations))
+                return false;
+        }
+        return true;
+    }
+}
+
+/// <param name="Code">Node code at the latest VIS version</param>
+/// <param name="MatchAllLocations">Any location, or none, matches</param>
+/// <param name="Locations">One of these must be on the node, when null the node must have no location</param>
+internal sealed record CompiledNodeFilter(string Code, bool MatchAllLocations, Location[]? Locations)
+{
+    public bool MatchesLocations(List<Location> potentialLocations)
+    {
+        if (MatchAllLocations)
+            return true;
+        if (Locations is null)
+            return potentialLocations.Count == 0;
+        foreach (var location in potentialLocations)
+        {
+            if (Array.IndexOf(Locations, location) >= 0)
+                return true;
+        }
+        return false;
+    }
+}
@@ -1,3 +1,4 @@
+using System.Buffers;
 using System.Diagnostics;
 using System.Diagnostics.CodeAnalysis;
 using System.Globalization;
@@ -15,6 +16,10 @@ public enum LocationGroup
 }
 
 public readonly record struct Location
+#if NET8_0_OR_GREATER
+    : ISpanFormattable,
+        IUtf8SpanFormattable
+#endif
 {
     public readonly string Value { get; }
 
@@ -25,6 +30,38 @@ internal Location(string value)
 
     public override readonly string ToString() => Value;
 
+    /// <summary>Writes <see cref="Value"/> into <paramref name="destination"/>, the format is ignored</summary>
+    public readonly bool TryFormat(
+        Span<char> destination,
+        out int charsWritten,
+        ReadOnlySpan<char> format = default,
+        IFormatProvider? provider = null
+    )
+    {
+        charsWritten = 0;
+        return SpanFormatting.TryWrite(Value, destination, ref charsWritten);
+    }
+
+    /// <summary>Writes <see cref="Value"/> as UTF-8 into <paramref name="destination"/></summary>
+    public readonly bool TryFormatUtf8(Span<byte> destination, out int bytesWritten)
+    {
+        bytesWritten = 0;
+        return SpanFormatting.TryWrite(Value, destination, ref bytesWritten);
+    }
+
+    public readonly void WriteTo(IBufferWriter<byte> writer) => SpanFormatting.WriteTo(Value, writer);
+
+#if NET8_0_OR_GREATER
+    readonly string IFormattable.ToString(string? format, IFormatProvider? formatProvider) => Value;
+
+    readonly bool IUtf8SpanFormattable.TryFormat(
+        Span<byte> utf8Destination,
+        out int bytesWritten,
+        ReadOnlySpan<char> format,
+        IFormatProvider? provider
+    ) => TryFormatUtf8(utf8Destination, out bytesWritten);
+#endif
+
     public static implicit operator string(Location n) => n.Value;
 }
 
@@ -34,6 +71,9 @@ public sealed class Locations
     private readonly List<RelativeLocation> _relativeLocations;
     internal Dictionary<char, LocationGroup> _reversedGroups;
 
+    // Group bit of each ASCII location code, 0 for characters that are not a known location code
+    private readonly byte[] _codeGroupBits = new byte[128];
+
     public VisVersion VisVersion { get; }
 
     // This is if we need Code, Name, Definition in Frontend UI
@@ -80,6 +120,8 @@ internal Locations(VisVersion version, LocationsDto dto)
             if (key == LocationGroup.Number)
                 continue;
             _reversedGroups.Add(relativeLocationsDto.Code, key);
+            Debug.Assert(relativeLocationsDto.Code < _codeGroupBits.Length);
+            _codeGroupBits[relativeLocationsDto.Code] = (byte)(1 << ((int)key - 1));
             groups.GetValueOrDefault(key)?.Add(relativeLocation);
         }
 
@@ -145,6 +187,22 @@ public bool TryParse(ReadOnlySpan<char> value, out Location location, out Parsin
         out Location location,
         ref LocationParsingErrorBuilder errorBuilder
     )
+    {
+        if (TryParseFast(span))
+        {
+            location = new Location(originalStr ?? span.ToString());
+            return true;
+        }
+
+        return TryParseWithErrors(span, originalStr, out location, ref errorBuilder);
+    }
+
+    internal bool TryParseWithErrors(
+        ReadOnlySpan<char> span,
+        string? originalStr,
+        out Location location,
+        ref LocationParsingErrorBuilder errorBuilder
+    )
     {
         location = default;
 
@@ -278,6 +336,44 @@ public bool TryParse(ReadOnlySpan<char> value, out Location location, out Parsin
         return true;
     }
 
+    // Longest digit run that always fits in an int
+    private const int MaxFastDigits = 9;
+
+    /// <summary>
+    /// Single pass check of the common case, locations that are valid and consist of ASCII characters only.
+    /// Returns false for anything else, which is then handled (and reported) by <see cref="TryParseWithErrors"/>.
+    /// </summary>
+    internal bool TryParseFast(ReadOnlySpan<char> span)
+    {
+        var i = 0;
+        while (i < span.Length && (uint)(span[i] - '0') <= 9)
+            i++;
+        if (i > MaxFastDigits)
+            return false;
+        if (i == span.Length)
+            return i > 0;
+
+        var codeGroupBits = _codeGroupBits;
+        var groups = 0;
+        var prev = '\0';
+        for (; i < span.Length; i++)
+        {
+            var ch = span[i];
+            if (ch >= codeGroupBits.Length)
+                return false;
+
+            // Covers unknown codes and digits after codes, duplicate groups and codes out of alphabetical order
+            var bit = codeGroupBits[ch];
+            if (bit == 0 || (groups & bit) != 0 || ch < prev)
+                return false;
+
+            groups |= bit;
+            prev = ch;
+        }
+
+        return true;
+    }
+
     static void AddError(ref LocationParsingErrorBuilder errorBuilder, LocationValidationResult name, string message)
     {
         if (!errorBuilder.HasError)
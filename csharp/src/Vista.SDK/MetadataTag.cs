@@ -1,8 +1,14 @@
+using System.Buffers;
 using System.Text;
+using Vista.SDK.Internal;
 
 namespace Vista.SDK;
 
 public readonly record struct MetadataTag
+#if NET8_0_OR_GREATER
+    : ISpanFormattable,
+        IUtf8SpanFormattable
+#endif
 {
     public readonly CodebookName Name { get; private init; }
 
@@ -33,6 +39,38 @@ internal MetadataTag(CodebookName name, string value, bool isCustom = false)
 
     public override readonly string ToString() => Value;
 
+    /// <summary>Writes <see cref="Value"/> into <paramref name="destination"/>, the format is ignored</summary>
+    public readonly bool TryFormat(
+        Span<char> destination,
+        out int charsWritten,
+        ReadOnlySpan<char> format = default,
+        IFormatProvider? provider = null
+    )
+    {
+        charsWritten = 0;
+        return SpanFormatting.TryWrite(Value, destination, ref charsWritten);
+    }
+
+    /// <summary>Writes <see cref="Value"/> as UTF-8 into <paramref name="destination"/></summary>
+    public readonly bool TryFormatUtf8(Span<byte> destination, out int bytesWritten)
+    {
+        bytesWritten = 0;
+        return SpanFormatting.TryWrite(Value, destination, ref bytesWritten);
+    }
+
+    public readonly void WriteTo(IBufferWriter<byte> writer) => SpanFormatting.WriteTo(Value, writer);
+
+#if NET8_0_OR_GREATER
+    readonly string IFormattable.ToString(string? format, IFormatProvider? formatProvider) => Value;
+
+    readonly bool IUtf8SpanFormattable.TryFormat(
+        Span<byte> utf8Destination,
+        out int bytesWritten,
+        ReadOnlySpan<char> format,
+        IFormatProvider? provider
+    ) => TryFormatUtf8(utf8Destination, out bytesWritten);
+#endif
+
     public readonly void ToString(StringBuilder builder, char separator = '/')
     {
         var prefix = Name switch
@@ -15,6 +15,10 @@ public sealed record MetadataTagsQueryBuilder
 
     private bool _matchExact;
 
+    internal IReadOnlyDictionary<CodebookName, MetadataTag> Tags => _tags;
+
+    internal bool MatchExact => _matchExact;
+
     private MetadataTagsQueryBuilder() { }
 
     public static MetadataTagsQueryBuilder Empty() => new();
@@ -52,22 +52,67 @@ public sealed record DataChannelList() : ICollection<DataChannel>
 {
     private List<DataChannel> dataChannels = new();
     private Dictionary<string, DataChannel> shortIdMap = new();
-    private Dictionary<LocalId, DataChannel> localIdMap = new();
+    private Dictionary<LocalId, Entry> localIdMap = new();
+
+    // Parallel to dataChannels, so positions can be renumbered without lookups
+    private List<Entry> entries = new();
 
     public IReadOnlyList<DataChannel> DataChannels => dataChannels.AsReadOnly();
 
     public DataChannelList(IReadOnlyList<DataChannel> dataChannels)
         : this() => Add(dataChannels);
 
+    internal DataChannelList(int capacity)
+        : this()
+    {
+        dataChannels = new(capacity);
+        shortIdMap = new(capacity);
+        localIdMap = new(capacity);
+        entries = new(capacity);
+    }
+
     public int Count => dataChannels.Count;
 
     public bool IsReadOnly => false;
 
+    /// <summary>Incremented on every change to the data channels of this list</summary>
+    public long Version { get; private set; }
+
     public bool TryGetByShortId(string shortId, [MaybeNullWhen(false)] out DataChannel dataChannel) =>
         shortIdMap.TryGetValue(shortId, out dataChannel);
 
-    public bool TryGetByLocalId(LocalId localId, [MaybeNullWhen(false)] out DataChannel dataChannel) =>
-        localIdMap.TryGetValue(localId, out dataChannel);
+    public bool TryGetByLocalId(LocalId localId, [MaybeNullWhen(false)] out DataChannel dataChannel)
+    {
+        if (!localIdMap.TryGetValue(localId, out var entry))
+        {
+            dataChannel = null;
+            return false;
+        }
+        dataChannel = entry.DataChannel;
+        return true;
+    }
+
+    /// <summary>
+    /// Gets the value validator of <paramref name="dataChannel"/>.
+    /// The validator of a channel in this list is compiled on first use and cached until its format changes.
+    /// </summary>
+    public ValueValidator GetValidator(DataChannel dataChannel)
+    {
+        var format = dataChannel.Property.Format;
+        if (
+            !localIdMap.TryGetValue(dataChannel.DataChannelId.LocalId, out var entry)
+            || !ReferenceEquals(entry.DataChannel, dataChannel)
+        )
+            return ValueValidator.Compile(format);
+
+        var validator = entry.Validator;
+        if (validator is null || !validator.IsCompiledFrom(format))
+            entry.Validator = validator = ValueValidator.Compile(format);
+        return validator;
+    }
+
+    /// <summary>Creates an index of the data channels currently in this list, to match queries against</summary>
+    public DataChannelListIndex CreateIndex() => new(this);
 
     public void Add(DataChannel dataChannel)
     {
@@ -90,9 +135,166 @@ public void Add(IEnumerable<DataChannel> dcs)
                     );
                 shortIdMap.Add(dataChannel.DataChannelId.ShortId, dataChannel);
             }
-            dataChannels.Add(dataChannel);
-            localIdMap.Add(dataChannel.DataChannelId.LocalId, dataChannel);
+            Append(dataChannel);
+            Version++;
+        }
+    }
+
+    /// <returns>False with the reason in <paramref name="error"/> if a data channel with the same ID already exists</returns>
+    internal bool TryAdd(DataChannel dataChannel, [NotNullWhen(false)] out string? error)
+    {
+        var id = dataChannel.DataChannelId;
+        if (localIdMap.ContainsKey(id.LocalId))
+        {
+            error = $"DataChannel with LocalId {id.LocalId} already exists";
+            return false;
+        }
+        if (id.ShortId is not null)
+        {
+            if (shortIdMap.ContainsKey(id.ShortId))
+            {
+                error = $"DataChannel with ShortId {id.ShortId} already exists";
+                return false;
+            }
+            shortIdMap.Add(id.ShortId, dataChannel);
+        }
+        Append(dataChannel);
+        Version++;
+        error = null;
+        return true;
+    }
+
+    /// <summary>
+    /// Applies <paramref name="diff"/> in place, keeping the order of the remaining data channels
+    /// and appending the added ones in the order of the diff.
+    /// </summary>
+    /// <remarks>
+    /// Lookups are updated per changed data channel, and cached validators are only dropped for the
+    /// modified and removed data channels. The diff is checked against this list before anything is changed,
+    /// so a diff that doesn't apply throws <see cref="ArgumentException"/> and leaves the list as it was.
+    /// </remarks>
+    public void Apply(DataChannelListDiff diff)
+    {
+        if (diff is null)
+            throw new ArgumentNullException(nameof(diff));
+        if (diff.IsEmpty)
+            return;
+
+        CheckApplies(diff);
+
+        foreach (var dataChannel in diff.Removed)
+        {
+            var id = dataChannel.DataChannelId;
+            var entry = localIdMap[id.LocalId];
+            localIdMap.Remove(id.LocalId);
+            if (entry.DataChannel.DataChannelId.ShortId is { } shortId)
+                shortIdMap.Remove(shortId);
+            // Compacted below, in one pass for all removals
+            entry.Index = -1;
+        }
+
+        foreach (var change in diff.Modified)
+        {
+            var entry = localIdMap[change.Current.DataChannelId.LocalId];
+            if (entry.DataChannel.DataChannelId.ShortId is { } shortId)
+                shortIdMap.Remove(shortId);
+            entry.DataChannel = change.Current;
+            entry.Validator = null;
+            dataChannels[entry.Index] = change.Current;
+        }
+        foreach (var change in diff.Modified)
+        {
+            if (change.Current.DataChannelId.ShortId is { } shortId)
+                shortIdMap.Add(shortId, change.Current);
+        }
+
+        if (diff.Removed.Count > 0)
+        {
+            var count = 0;
+            for (var i = 0; i < entries.Count; i++)
+            {
+                var entry = entries[i];
+                if (entry.Index < 0)
+                    continue;
+                entry.Index = count;
+                entries[count] = entry;
+                dataChannels[count] = entry.DataChannel;
+                count++;
+            }
+            entries.RemoveRange(count, entries.Count - count);
+            dataChannels.RemoveRange(count, dataChannels.Count - count);
+        }
+
+        foreach (var dataChannel in diff.Added)
+        {
+            if (dataChannel.DataChannelId.ShortId is { } shortId)
+                shortIdMap.Add(shortId, dataChannel);
+            Append(dataChannel);
         }
+        Version++;
+    }
+
+    private void CheckApplies(DataChannelListDiff diff)
+    {
+        // Short IDs given up and taken by the diff, a short ID can move between data channels
+        var localIds = new HashSet<LocalId>();
+        var released = new HashSet<string>();
+        var claimed = new HashSet<string>();
+
+        foreach (var dataChannel in diff.Removed)
+        {
+            var entry = GetChanged(dataChannel);
+            if (entry.DataChannel.DataChannelId.ShortId is { } shortId)
+                released.Add(shortId);
+        }
+        foreach (var change in diff.Modified)
+        {
+            if (change.Previous.DataChannelId.LocalId != change.Current.DataChannelId.LocalId)
+                throw new ArgumentException(
+                    $"Modified DataChannel with LocalId {change.Previous.DataChannelId.LocalId} changes its LocalId"
+                );
+            var entry = GetChanged(change.Previous);
+            if (entry.DataChannel.DataChannelId.ShortId is { } shortId)
+                released.Add(shortId);
+        }
+
+        foreach (var change in diff.Modified)
+            Claim(change.Current);
+        foreach (var dataChannel in diff.Added)
+        {
+            var localId = dataChannel.DataChannelId.LocalId;
+            if (localIdMap.ContainsKey(localId) || !localIds.Add(localId))
+                throw new ArgumentException($"DataChannel with LocalId {localId} already exists");
+            Claim(dataChannel);
+        }
+
+        Entry GetChanged(DataChannel dataChannel)
+        {
+            var localId = dataChannel.DataChannelId.LocalId;
+            if (!localIds.Add(localId))
+                throw new ArgumentException($"DataChannel with LocalId {localId} is changed more than once");
+            if (!localIdMap.TryGetValue(localId, out var entry))
+                throw new ArgumentException($"DataChannel with LocalId {localId} doesn't exist");
+            if (!DataChannelListDiff.ContentEquals(entry.DataChannel, dataChannel))
+                throw new ArgumentException($"DataChannel with LocalId {localId} has changed since the diff");
+            return entry;
+        }
+
+        void Claim(DataChannel dataChannel)
+        {
+            if (dataChannel.DataChannelId.ShortId is not { } shortId)
+                return;
+            if (!claimed.Add(shortId) || shortIdMap.ContainsKey(shortId) && !released.Contains(shortId))
+                throw new ArgumentException($"DataChannel with ShortId {shortId} already exists");
+        }
+    }
+
+    private void Append(DataChannel dataChannel)
+    {
+        var entry = new Entry(dataChannel) { Index = dataChannels.Count };
+        dataChannels.Add(dataChannel);
+        entries.Add(entry);
+        localIdMap.Add(dataChannel.DataChannelId.LocalId, entry);
     }
 
     public void Clear()
@@ -100,9 +302,14 @@ public void Clear()
         dataChannels.Clear();
         shortIdMap.Clear();
         localIdMap.Clear();
+        entries.Clear();
+        Version++;
     }
 
-    public bool Contains(DataChannel item) => dataChannels.Contains(item);
+    public bool Contains(DataChannel item) =>
+        item is not null
+        && localIdMap.TryGetValue(item.DataChannelId.LocalId, out var entry)
+        && entry.DataChannel.Equals(item);
 
     public void CopyTo(DataChannel[] array, int arrayIndex) => dataChannels.CopyTo(array, arrayIndex);
 
@@ -110,18 +317,39 @@ public void Clear()
 
     public bool Remove(DataChannel item)
     {
-        if (!localIdMap.Remove(item.DataChannelId.LocalId))
-            return false;
-        if (item.DataChannelId.ShortId is not null && !shortIdMap.Remove(item.DataChannelId.ShortId))
+        if (
+            item is null
+            || !localIdMap.TryGetValue(item.DataChannelId.LocalId, out var entry)
+            || !entry.DataChannel.Equals(item)
+        )
             return false;
-        return dataChannels.Remove(item);
+
+        localIdMap.Remove(item.DataChannelId.LocalId);
+        if (entry.DataChannel.DataChannelId.ShortId is { } shortId)
+            shortIdMap.Remove(shortId);
+        dataChannels.RemoveAt(entry.Index);
+        entries.RemoveAt(entry.Index);
+        for (var i = entry.Index; i < entries.Count; i++)
+            entries[i].Index = i;
+        Version++;
+        return true;
     }
 
     IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
 
     public DataChannel this[string shortId] => shortIdMap[shortId];
     public DataChannel this[int index] => dataChannels[index];
-    public DataChannel this[LocalId localId] => localIdMap[localId];
+    public DataChannel this[LocalId localId] => localIdMap[localId].DataChannel;
+
+    private sealed class Entry(DataChannel dataChannel)
+    {
+        public DataChannel DataChannel { get; set; } = dataChannel;
+
+        /// <summary>Position in the list</summary>
+        public int Index { get; set; }
+
+        public volatile ValueValidator? Validator;
+    }
 }
 
 // DataChannel
@@ -328,13 +556,13 @@ public ValidateResult ValidateValue(string value, Format format)
                 {
                     if (FractionDigits is not null && CountDecimalPlaces(dec) > FractionDigits)
                         return new ValidateResult.Invalid(["Value has more decimal places than allowed"]);
-                    if (ValidateNumber((double)dec) is ValidateResult.Invalid invalid)
+                    if (ValidateNumber((double)dec) is { } invalid)
                         return invalid;
                     return new ValidateResult.Ok();
                 },
                 i =>
                 {
-                    if (ValidateNumber(i) is ValidateResult.Invalid invalid)
+                    if (ValidateNumber(i) is { } invalid)
                         return invalid;
                     if (TotalDigits is not null)
                     {
@@ -374,7 +602,7 @@ public ValidateResult ValidateValue(string value, Format format)
         return result;
     }
 
-    private ValidateResult ValidateNumber(double number)
+    internal ValidateResult.Invalid? ValidateNumber(double number)
     {
         // check max exclusive
         if (MaxExclusive is not null && number >= MaxExclusive)
@@ -388,12 +616,17 @@ private ValidateResult ValidateNumber(double number)
         // check min inclusive
         if (MinInclusive is not null && number < MinInclusive)
             return new ValidateResult.Invalid([$"Value {number} is less than {MinInclusive}"]);
-        return new ValidateResult.Ok();
+        return null;
     }
 
-    private static decimal CountDecimalPlaces(decimal dec)
+    internal static decimal CountDecimalPlaces(decimal dec)
     {
+#if NET8_0_OR_GREATER
+        Span<int> bits = stackalloc int[4];
+        decimal.GetBits(dec, bits);
+#else
         int[] bits = decimal.GetBits(dec);
+#endif
         ulong lowInt = (uint)bits[0];
         ulong midInt = (uint)bits[1];
         int exponent = (bits[3] & 0x00FF0000) >> 16;
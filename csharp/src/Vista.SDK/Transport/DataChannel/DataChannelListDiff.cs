@@ -0,0 +1,192 @@
+namespace Vista.SDK.Transport.DataChannel;
+
+/// <summary>A data channel that is in both lists of a diff, with different content</summary>
+public sealed record DataChannelChange(DataChannel Previous, DataChannel Current);
+
+/// <summary>
+/// The data channels added, removed and modified between two data channel lists, matched by local ID.
+/// </summary>
+/// <remarks>
+/// Configuration updates usually change a handful of data channels, so applying the diff with
+/// <see cref="DataChannelList.Apply(DataChannelListDiff)"/> and <see cref="DataChannelListIndex.Update(DataChannelListDiff)"/>
+/// keeps the cached validators and indexed local IDs of everything else.
+/// A modified data channel keeps its local ID, so it stays in the same query results,
+/// see <see cref="Affects(LocalIdQuery)"/>.
+/// </remarks>
+public sealed record DataChannelListDiff
+{
+    public static readonly DataChannelListDiff Empty = new()
+    {
+        Added = [],
+        Removed = [],
+        Modified = [],
+    };
+
+    /// <summary>Data channels only in the target list, in target order</summary>
+    public required IReadOnlyList<DataChannel> Added { get; init; }
+
+    /// <summary>Data channels only in the source list, in source order</summary>
+    public required IReadOnlyList<DataChannel> Removed { get; init; }
+
+    /// <summary>Data channels in both lists with different content, in target order</summary>
+    public required IReadOnlyList<DataChannelChange> Modified { get; init; }
+
+    public int Count => Added.Count + Removed.Count + Modified.Count;
+
+    public bool IsEmpty => Count == 0;
+
+    public static DataChannelListDiff Compute(DataChannelListPackage source, DataChannelListPackage target)
+    {
+        if (source is null)
+            throw new ArgumentNullException(nameof(source));
+        if (target is null)
+            throw new ArgumentNullException(nameof(target));
+        return Compute(source.DataChannelList, target.DataChannelList);
+    }
+
+    /// <summary>Computes the changes that turn <paramref name="source"/> into <paramref name="target"/></summary>
+    public static DataChannelListDiff Compute(DataChannelList source, DataChannelList target)
+    {
+        if (source is null)
+            throw new ArgumentNullException(nameof(source));
+        if (target is null)
+            throw new ArgumentNullException(nameof(target));
+
+        var added = new List<DataChannel>();
+        var modified = new List<DataChannelChange>();
+        foreach (var dataChannel in target)
+        {
+            if (!source.TryGetByLocalId(dataChannel.DataChannelId.LocalId, out var previous))
+                added.Add(dataChannel);
+            else if (!ContentEquals(previous, dataChannel))
+                modified.Add(new DataChannelChange(previous, dataChannel));
+        }
+
+        var removed = new List<DataChannel>();
+        foreach (var dataChannel in source)
+        {
+            if (!target.TryGetByLocalId(dataChannel.DataChannelId.LocalId, out _))
+                removed.Add(dataChannel);
+        }
+
+        if (added.Count == 0 && removed.Count == 0 && modified.Count == 0)
+            return Empty;
+        return new DataChannelListDiff
+        {
+            Added = added,
+            Removed = removed,
+            Modified = modified,
+        };
+    }
+
+    /// <summary>
+    /// Whether the data channels matching <paramref name="query"/> are different after the diff,
+    /// that is if an added or removed data channel matches it.
+    /// Cached results of queries that aren't affected only need the modified data channels replaced.
+    /// </summary>
+    public bool Affects(LocalIdQuery query)
+    {
+        if (query is null)
+            throw new ArgumentNullException(nameof(query));
+
+        foreach (var dataChannel in Added)
+        {
+            if (query.Match(dataChannel.DataChannelId.LocalId))
+                return true;
+        }
+        foreach (var dataChannel in Removed)
+        {
+            if (query.Match(dataChannel.DataChannelId.LocalId))
+                return true;
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Structural equality of data channels, the records compare their lists and dictionaries by reference,
+    /// so data channels deserialized from two packages would never be equal.
+    /// </summary>
+    internal static bool ContentEquals(DataChannel a, DataChannel b)
+    {
+        if (ReferenceEquals(a, b))
+            return true;
+
+        var (aId, bId) = (a.DataChannelId, b.DataChannelId);
+        if (aId.LocalId != bId.LocalId || aId.ShortId != bId.ShortId)
+            return false;
+        if (
+            !Equals(aId.NameObject, bId.NameObject)
+            && (
+                aId.NameObject is null
+                || bId.NameObject is null
+                || aId.NameObject.NamingRule != bId.NameObject.NamingRule
+                || !ContentEquals(aId.NameObject.CustomNameObjects, bId.NameObject.CustomNameObjects)
+            )
+        )
+            return false;
+
+        var (aProperty, bProperty) = (a.Property, b.Property);
+        return aProperty.DataChannelType == bProperty.DataChannelType
+            && ContentEquals(aProperty.Format, bProperty.Format)
+            && aProperty.Range == bProperty.Range
+            && ContentEquals(aProperty.Unit, bProperty.Unit)
+            && aProperty.QualityCoding == bProperty.QualityCoding
+            && aProperty.AlertPriority == bProperty.AlertPriority
+            && aProperty.Name == bProperty.Name
+            && aProperty.Remarks == bProperty.Remarks
+            && ContentEquals(aProperty.CustomProperties, bProperty.CustomProperties);
+    }
+
+    private static bool ContentEquals(Format a, Format b)
+    {
+        if (a.Type != b.Type)
+            return false;
+        var (aRestriction, bRestriction) = (a.Restriction, b.Restriction);
+        if (aRestriction is null || bRestriction is null)
+            return aRestriction is null && bRestriction is null;
+
+        var (aEnumeration, bEnumeration) = (aRestriction.Enumeration, bRestriction.Enumeration);
+        if (aEnumeration is null || bEnumeration is null)
+        {
+            if (aEnumeration is not null || bEnumeration is not null)
+                return false;
+        }
+        else if (!aEnumeration.SequenceEqual(bEnumeration, StringComparer.Ordinal))
+        {
+            return false;
+        }
+        return aRestriction with { Enumeration = null } == bRestriction with { Enumeration = null };
+    }
+
+    private static bool ContentEquals(Unit? a, Unit? b)
+    {
+        if (a is null || b is null)
+            return a is null && b is null;
+        return a.UnitSymbol == b.UnitSymbol
+            && a.QuantityName == b.QuantityName
+            && ContentEquals(a.CustomElements, b.CustomElements);
+    }
+
+    private static bool ContentEquals(Dictionary<string, object>? a, Dictionary<string, object>? b)
+    {
+        if (a is null || b is null)
+            return a is null && b is null;
+        if (a.Count != b.Count)
+            return false;
+        foreach (var kvp in a)
+        {
+            if (!b.TryGetValue(kvp.Key, out var other) || !ValueEquals(kvp.Value, other))
+                return false;
+        }
+        return true;
+    }
+
+    // Custom elements are JSON elements when deserialized, which don't implement equality, their text does
+    private static bool ValueEquals(object? a, object? b) =>
+        Equals(a, b)
+        || a is not null
+            && b is not null
+            && a.GetType() == b.GetType()
+            && a.GetType().IsValueType
+            && a.ToString() == b.ToString();
+}
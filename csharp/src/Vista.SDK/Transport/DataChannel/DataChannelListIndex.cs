@@ -0,0 +1,448 @@
+namespace Vista.SDK.Transport.DataChannel;
+
+/// <summary>
+/// Inverted index over the data channels of a <see cref="DataChannelList"/>,
+/// keyed by Gmod node code, node location and metadata tag,
+/// answering <see cref="LocalIdQuery"/> with set intersections instead of matching every data channel.
+/// </summary>
+/// <remarks>
+/// The index is a snapshot, data channels added to or removed from the list afterwards are not reflected,
+/// use <see cref="Update(DataChannelListDiff)"/> to bring it up to date with the changes of a diff.
+/// Local IDs are indexed at the latest VIS version, like queries are matched.
+/// Candidates from the intersections are verified against the full query, so results are the same as
+/// matching each data channel with <see cref="LocalIdQuery.Match(LocalId)"/>, in list order.
+/// </remarks>
+public sealed class DataChannelListIndex
+{
+    private readonly DataChannel[] _dataChannels;
+    private readonly PreparedLocalId[] _localIds;
+
+    private readonly Dictionary<string, int[]> _primaryCodes;
+    private readonly Dictionary<(string Code, Location Location), int[]> _primaryLocations;
+    private readonly Dictionary<string, int[]> _secondaryCodes;
+    private readonly Dictionary<(string Code, Location Location), int[]> _secondaryLocations;
+    private readonly Dictionary<(CodebookName Name, string Value), int[]> _tags;
+    private readonly int[] _withSecondaryItem;
+    private readonly int[] _withoutSecondaryItem;
+    private readonly int[] _all;
+
+    // Positions by local ID, for updates
+    private Dictionary<LocalId, int>? _positions;
+
+    public DataChannelListIndex(DataChannelList dataChannelList)
+    {
+        if (dataChannelList is null)
+            throw new ArgumentNullException(nameof(dataChannelList));
+
+        _dataChannels = dataChannelList.DataChannels.ToArray();
+        _localIds = new PreparedLocalId[_dataChannels.Length];
+
+        var sets = new Sets();
+        var versioning = VIS.Instance.GetGmodVersioning();
+        var cache = new GmodVersioning.PathConversionCache();
+        for (var i = 0; i < _dataChannels.Length; i++)
+        {
+            var prepared = Prepare(_dataChannels[i].DataChannelId.LocalId, versioning, cache);
+            _localIds[i] = prepared;
+            sets.Add(prepared, i);
+        }
+
+        _primaryCodes = Freeze(sets.PrimaryCodes);
+        _primaryLocations = Freeze(sets.PrimaryLocations);
+        _secondaryCodes = Freeze(sets.SecondaryCodes);
+        _secondaryLocations = Freeze(sets.SecondaryLocations);
+        _tags = Freeze(sets.Tags);
+        _withSecondaryItem = sets.WithSecondaryItem.ToArray();
+        _withoutSecondaryItem = sets.WithoutSecondaryItem.ToArray();
+        _all = Enumerable.Range(0, _dataChannels.Length).ToArray();
+    }
+
+    private DataChannelListIndex(
+        DataChannel[] dataChannels,
+        PreparedLocalId[] localIds,
+        DataChannelListIndex previous,
+        int[]? remap,
+        Sets added
+    )
+    {
+        _dataChannels = dataChannels;
+        _localIds = localIds;
+        _primaryCodes = Update(previous._primaryCodes, remap, added.PrimaryCodes);
+        _primaryLocations = Update(previous._primaryLocations, remap, added.PrimaryLocations);
+        _secondaryCodes = Update(previous._secondaryCodes, remap, added.SecondaryCodes);
+        _secondaryLocations = Update(previous._secondaryLocations, remap, added.SecondaryLocations);
+        _tags = Update(previous._tags, remap, added.Tags);
+        _withSecondaryItem = Update(previous._withSecondaryItem, remap, added.WithSecondaryItem);
+        _withoutSecondaryItem = Update(previous._withoutSecondaryItem, remap, added.WithoutSecondaryItem);
+        _all = Enumerable.Range(0, _dataChannels.Length).ToArray();
+    }
+
+    public int Count => _dataChannels.Length;
+
+    /// <summary>
+    /// Creates an index with the changes of <paramref name="diff"/>, with the data channels in the order
+    /// <see cref="DataChannelList.Apply(DataChannelListDiff)"/> leaves the list in. This index is left as it is.
+    /// </summary>
+    /// <remarks>
+    /// Only the local IDs of the added data channels are converted and prepared, modified data channels keep
+    /// their local ID and are replaced in place. Removals renumber the sets without looking at the local IDs,
+    /// and sets that don't change are shared with this index.
+    /// </remarks>
+    public DataChannelListIndex Update(DataChannelListDiff diff)
+    {
+        if (diff is null)
+            throw new ArgumentNullException(nameof(diff));
+        if (diff.IsEmpty)
+            return this;
+
+        var positions = _positions ??= CreatePositions();
+        var dataChannels = _dataChannels;
+        bool[]? removed = null;
+        var removedCount = 0;
+        foreach (var dataChannel in diff.Removed)
+        {
+            removed ??= new bool[_dataChannels.Length];
+            var i = GetPosition(positions, dataChannel.DataChannelId.LocalId);
+            if (!removed[i])
+                removedCount++;
+            removed[i] = true;
+        }
+        foreach (var change in diff.Modified)
+        {
+            if (ReferenceEquals(dataChannels, _dataChannels))
+                dataChannels = (DataChannel[])_dataChannels.Clone();
+            dataChannels[GetPosition(positions, change.Current.DataChannelId.LocalId)] = change.Current;
+        }
+        foreach (var dataChannel in diff.Added)
+        {
+            if (positions.ContainsKey(dataChannel.DataChannelId.LocalId))
+                throw new ArgumentException(
+                    $"DataChannel with LocalId {dataChannel.DataChannelId.LocalId} already exists"
+                );
+        }
+
+        var kept = _dataChannels.Length - removedCount;
+        var updatedDataChannels = new DataChannel[kept + diff.Added.Count];
+        var updatedLocalIds = new PreparedLocalId[updatedDataChannels.Length];
+        int[]? remap = null;
+        if (removed is null)
+        {
+            Array.Copy(dataChannels, updatedDataChannels, kept);
+            Array.Copy(_localIds, updatedLocalIds, kept);
+        }
+        else
+        {
+            remap = new int[_dataChannels.Length];
+            for (int i = 0, j = 0; i < remap.Length; i++)
+            {
+                if (removed[i])
+                {
+                    remap[i] = -1;
+                    continue;
+                }
+                remap[i] = j;
+                updatedDataChannels[j] = dataChannels[i];
+                updatedLocalIds[j] = _localIds[i];
+                j++;
+            }
+        }
+
+        var added = new Sets();
+        var versioning = VIS.Instance.GetGmodVersioning();
+        var cache = new GmodVersioning.PathConversionCache();
+        for (var k = 0; k < diff.Added.Count; k++)
+        {
+            var i = kept + k;
+            var prepared = Prepare(diff.Added[k].DataChannelId.LocalId, versioning, cache);
+            updatedDataChannels[i] = diff.Added[k];
+            updatedLocalIds[i] = prepared;
+            added.Add(prepared, i);
+        }
+
+        return new DataChannelListIndex(updatedDataChannels, updatedLocalIds, this, remap, added);
+    }
+
+    /// <summary>Returns the data channels matching <paramref name="query"/>, in list order</summary>
+    public IReadOnlyList<DataChannel> Match(LocalIdQuery query)
+    {
+        if (query is null)
+            throw new ArgumentNullException(nameof(query));
+        return Match(CompiledLocalIdQuery.Compile(query));
+    }
+
+    /// <summary>Returns the data channels matching each query of <paramref name="matcher"/>, by query index</summary>
+    public IReadOnlyList<IReadOnlyList<DataChannel>> Match(LocalIdQueryMatcher matcher)
+    {
+        if (matcher is null)
+            throw new ArgumentNullException(nameof(matcher));
+        var results = new IReadOnlyList<DataChannel>[matcher.Queries.Count];
+        for (var i = 0; i < results.Length; i++)
+            results[i] = Match(matcher.GetCompiled(i));
+        return results;
+    }
+
+    private IReadOnlyList<DataChannel> Match(CompiledLocalIdQuery query)
+    {
+        if (query.MatchesNothing)
+            return Array.Empty<DataChannel>();
+
+        var sets = new List<int[]>();
+        if (query.PrimaryItem is not null)
+            AddSets(sets, query.PrimaryItem, _primaryCodes, _primaryLocations);
+        if (query.SecondaryItem is not null)
+        {
+            sets.Add(_withSecondaryItem);
+            AddSets(sets, query.SecondaryItem, _secondaryCodes, _secondaryLocations);
+        }
+        if (query.RequireSecondaryItem is { } requireSecondaryItem)
+            sets.Add(requireSecondaryItem ? _withSecondaryItem : _withoutSecondaryItem);
+        if (query.Tags is not null)
+        {
+            foreach (var tag in query.Tags)
+                sets.Add(_tags.TryGetValue((tag.Name, tag.Value), out var set) ? set : Array.Empty<int>());
+        }
+
+        var candidates = Intersect(sets);
+        var result = new List<DataChannel>();
+        foreach (var i in candidates)
+        {
+            if (query.Match(_localIds[i]))
+                result.Add(_dataChannels[i]);
+        }
+        return result;
+    }
+
+    private static void AddSets(
+        List<int[]> sets,
+        CompiledPathQuery query,
+        Dictionary<string, int[]> codes,
+        Dictionary<(string Code, Location Location), int[]> locations
+    )
+    {
+        foreach (var filter in query.Nodes)
+        {
+            if (filter.Locations is null)
+            {
+                sets.Add(codes.TryGetValue(filter.Code, out var set) ? set : Array.Empty<int>());
+                continue;
+            }
+
+            // Any of the locations, the union of their sets
+            int[]? union = null;
+            foreach (var location in filter.Locations)
+            {
+                if (!locations.TryGetValue((filter.Code, location), out var set))
+                    continue;
+                union = union is null ? set : Union(union, set);
+            }
+            sets.Add(union ?? Array.Empty<int>());
+        }
+    }
+
+    private int[] Intersect(List<int[]> sets)
+    {
+        if (sets.Count == 0)
+            return _all;
+
+        // Smallest first, so every step is bounded by the smallest set
+        sets.Sort((a, b) => a.Length.CompareTo(b.Length));
+        var result = sets[0];
+        for (var s = 1; s < sets.Count && result.Length > 0; s++)
+        {
+            var other = sets[s];
+            var intersection = new int[result.Length];
+            int count = 0,
+                i = 0,
+                j = 0;
+            while (i < result.Length && j < other.Length)
+            {
+                if (result[i] == other[j])
+                {
+                    intersection[count++] = result[i];
+                    i++;
+                    j++;
+                }
+                else if (result[i] < other[j])
+                {
+                    i++;
+                }
+                else
+                {
+                    j++;
+                }
+            }
+            Array.Resize(ref intersection, count);
+            result = intersection;
+        }
+        return result;
+    }
+
+    private static int[] Union(int[] a, int[] b)
+    {
+        var union = new int[a.Length + b.Length];
+        int count = 0,
+            i = 0,
+            j = 0;
+        while (i < a.Length && j < b.Length)
+        {
+            if (a[i] == b[j])
+            {
+                union[count++] = a[i];
+                i++;
+                j++;
+            }
+            else if (a[i] < b[j])
+            {
+                union[count++] = a[i++];
+            }
+            else
+            {
+                union[count++] = b[j++];
+            }
+        }
+        while (i < a.Length)
+            union[count++] = a[i++];
+        while (j < b.Length)
+            union[count++] = b[j++];
+        Array.Resize(ref union, count);
+        return union;
+    }
+
+    private static PreparedLocalId Prepare(
+        LocalId localId,
+        GmodVersioning versioning,
+        GmodVersioning.PathConversionCache cache
+    )
+    {
+        if (localId.VisVersion < VIS.LatestVisVersion)
+        {
+            localId =
+                versioning.ConvertLocalId(localId.Builder, VIS.LatestVisVersion, cache)?.Build()
+                ?? throw new Exception("Failed to convert local id");
+        }
+        return PreparedLocalId.CreateLatest(localId);
+    }
+
+    private Dictionary<LocalId, int> CreatePositions()
+    {
+        var positions = new Dictionary<LocalId, int>(_dataChannels.Length);
+        for (var i = 0; i < _dataChannels.Length; i++)
+            positions[_dataChannels[i].DataChannelId.LocalId] = i;
+        return positions;
+    }
+
+    private static int GetPosition(Dictionary<LocalId, int> positions, LocalId localId) =>
+        positions.TryGetValue(localId, out var i)
+            ? i
+            : throw new ArgumentException($"DataChannel with LocalId {localId} doesn't exist");
+
+    // Renumbers the sets past removed data channels, then appends the added ones,
+    // which come after all kept data channels so every set stays sorted
+    private static Dictionary<TKey, int[]> Update<TKey>(
+        Dictionary<TKey, int[]> sets,
+        int[]? remap,
+        Dictionary<TKey, List<int>> added
+    )
+        where TKey : notnull
+    {
+        if (remap is null && added.Count == 0)
+            return sets;
+
+        var updated = new Dictionary<TKey, int[]>(sets.Count + added.Count);
+        foreach (var set in sets)
+        {
+            var values = Update(set.Value, remap, added.TryGetValue(set.Key, out var addedValues) ? addedValues : null);
+            if (values.Length > 0)
+                updated.Add(set.Key, values);
+        }
+        foreach (var set in added)
+        {
+            if (!sets.ContainsKey(set.Key))
+                updated.Add(set.Key, set.Value.ToArray());
+        }
+        return updated;
+    }
+
+    private static int[] Update(int[] set, int[]? remap, List<int>? added)
+    {
+        if (remap is null && (added is null || added.Count == 0))
+            return set;
+
+        var updated = new int[set.Length + (added?.Count ?? 0)];
+        var count = 0;
+        foreach (var i in set)
+        {
+            var j = remap is null ? i : remap[i];
+            if (j >= 0)
+                updated[count++] = j;
+        }
+        if (added is not null)
+        {
+            added.CopyTo(updated, count);
+            count += added.Count;
+        }
+        Array.Resize(ref updated, count);
+        return updated;
+    }
+
+    private sealed class Sets
+    {
+        public readonly Dictionary<string, List<int>> PrimaryCodes = new();
+        public readonly Dictionary<(string, Location), List<int>> PrimaryLocations = new();
+        public readonly Dictionary<string, List<int>> SecondaryCodes = new();
+        public readonly Dictionary<(string, Location), List<int>> SecondaryLocations = new();
+        public readonly Dictionary<(CodebookName, string), List<int>> Tags = new();
+        public readonly List<int> WithSecondaryItem = new();
+        public readonly List<int> WithoutSecondaryItem = new();
+
+        public void Add(PreparedLocalId prepared, int index)
+        {
+            AddNodes(prepared.PrimaryItem, index, PrimaryCodes, PrimaryLocations);
+            if (prepared.SecondaryItem is not null)
+            {
+                AddNodes(prepared.SecondaryItem, index, SecondaryCodes, SecondaryLocations);
+                WithSecondaryItem.Add(index);
+            }
+            else
+            {
+                WithoutSecondaryItem.Add(index);
+            }
+            foreach (var tag in prepared.Tags.Values)
+                DataChannelListIndex.Add(Tags, (tag.Name, tag.Value), index);
+        }
+    }
+
+    private static void AddNodes(
+        Dictionary<string, List<Location>> nodes,
+        int index,
+        Dictionary<string, List<int>> codes,
+        Dictionary<(string, Location), List<int>> locations
+    )
+    {
+        foreach (var node in nodes)
+        {
+            Add(codes, node.Key, index);
+            foreach (var location in node.Value)
+                Add(locations, (node.Key, location), index);
+        }
+    }
+
+    // Indices are added in ascending order, so each set stays sorted, the same node location can repeat within a path
+    private static void Add<TKey>(Dictionary<TKey, List<int>> sets, TKey key, int index)
+        where TKey : notnull
+    {
+        if (!sets.TryGetValue(key, out var set))
+            sets.Add(key, set = new());
+        if (set.Count == 0 || set[set.Count - 1] != index)
+            set.Add(index);
+    }
+
+    private static Dictionary<TKey, int[]> Freeze<TKey>(Dictionary<TKey, List<int>> sets)
+        where TKey : notnull
+    {
+        var frozen = new Dictionary<TKey, int[]>(sets.Count);
+        foreach (var set in sets)
+            frozen.Add(set.Key, set.Value.ToArray());
+        return frozen;
+    }
+}
@@ -0,0 +1,115 @@
+using System.Collections.Concurrent;
+
+namespace Vista.SDK.Transport.DataChannel;
+
+/// <summary>A data channel that could not be migrated, and why</summary>
+public sealed record DataChannelMigrationFailure(DataChannel DataChannel, string Reason, Exception? Exception = null);
+
+public sealed record DataChannelListMigrationResult
+{
+    /// <summary>The migrated package, containing every data channel that could be migrated</summary>
+    public required DataChannelListPackage Package { get; init; }
+
+    public required IReadOnlyList<DataChannelMigrationFailure> Failures { get; init; }
+
+    public bool IsSuccess => Failures.Count == 0;
+}
+
+public static class DataChannelListMigration
+{
+    /// <summary>
+    /// Converts the local IDs of all data channels in <paramref name="package"/> to <paramref name="targetVersion"/>.
+    /// </summary>
+    /// <remarks>
+    /// Data channels are converted in parallel, with each worker memoizing the paths it has converted.
+    /// A data channel that fails to convert is reported in <see cref="DataChannelListMigrationResult.Failures"/>
+    /// and left out of the migrated package, instead of failing the whole migration.
+    /// Data channels already at <paramref name="targetVersion"/> are kept as they are.
+    /// </remarks>
+    public static DataChannelListMigrationResult Migrate(
+        DataChannelListPackage package,
+        VisVersion targetVersion,
+        int maxDegreeOfParallelism = -1
+    )
+    {
+        if (package is null)
+            throw new ArgumentNullException(nameof(package));
+
+        var versioning = VIS.Instance.GetGmodVersioning();
+        var sourceChannels = package.DataChannelList.DataChannels;
+        var results = new DataChannel?[sourceChannels.Count];
+        var failures = new DataChannelMigrationFailure?[sourceChannels.Count];
+
+        Parallel.ForEach(
+            Partitioner.Create(0, sourceChannels.Count),
+            new ParallelOptions { MaxDegreeOfParallelism = maxDegreeOfParallelism },
+            () => new GmodVersioning.PathConversionCache(),
+            (range, _, cache) =>
+            {
+                for (var i = range.Item1; i < range.Item2; i++)
+                {
+                    var dataChannel = sourceChannels[i];
+                    try
+                    {
+                        results[i] = Migrate(versioning, dataChannel, targetVersion, cache, out failures[i]);
+                    }
+                    catch (Exception ex)
+                    {
+                        failures[i] = new DataChannelMigrationFailure(dataChannel, ex.Message, ex);
+                    }
+                }
+                return cache;
+            },
+            _ => { }
+        );
+
+        // Build the list and its lookup maps in one go, in the original order
+        var dataChannelList = new DataChannelList(sourceChannels.Count);
+        var allFailures = new List<DataChannelMigrationFailure>();
+        for (var i = 0; i < results.Length; i++)
+        {
+            if (failures[i] is { } failure)
+                allFailures.Add(failure);
+            else if (!dataChannelList.TryAdd(results[i]!, out var error))
+                allFailures.Add(new DataChannelMigrationFailure(sourceChannels[i], error));
+        }
+
+        return new DataChannelListMigrationResult
+        {
+            Package = new DataChannelListPackage
+            {
+                Package = new Package { Header = package.Package.Header with { }, DataChannelList = dataChannelList }
+            },
+            Failures = allFailures,
+        };
+    }
+
+    private static DataChannel? Migrate(
+        GmodVersioning versioning,
+        DataChannel dataChannel,
+        VisVersion targetVersion,
+        GmodVersioning.PathConversionCache cache,
+        out DataChannelMigrationFailure? failure
+    )
+    {
+        failure = null;
+        var localId = dataChannel.DataChannelId.LocalId;
+        if (localId.VisVersion == targetVersion)
+            return dataChannel;
+
+        var converted = versioning.ConvertLocalId(localId.Builder, targetVersion, cache);
+        if (converted is null)
+        {
+            failure = new DataChannelMigrationFailure(
+                dataChannel,
+                $"Failed to convert local ID {localId} to {targetVersion.ToVersionString()}"
+            );
+            return null;
+        }
+
+        return dataChannel with
+        {
+            DataChannelId = dataChannel.DataChannelId with { LocalId = converted.Build() }
+        };
+    }
+}
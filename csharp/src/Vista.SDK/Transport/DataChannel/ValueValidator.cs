@@ -0,0 +1,247 @@
+using System.Globalization;
+using System.Text.RegularExpressions;
+
+namespace Vista.SDK.Transport.DataChannel;
+
+/// <summary>
+/// Validator for the values of a single data channel, compiled once from a channel's <see cref="Format"/>.
+/// Validating a value neither dispatches on the format type name nor parses the value a second time for the restriction,
+/// and a <see cref="Value"/> is only created for values that pass.
+/// </summary>
+/// <remarks>
+/// Produces the same results and messages as <see cref="Format.ValidateValue(string, out Value)"/>.
+/// Use <see cref="DataChannelList.GetValidator(DataChannel)"/> to get the cached validator of a channel in a list.
+/// </remarks>
+public abstract class ValueValidator
+{
+    private protected static readonly ValidateResult Ok = new ValidateResult.Ok();
+
+    private readonly Format _format;
+    private readonly string _type;
+    private readonly Restriction? _restriction;
+    private readonly string[]? _enumerationValues;
+    private readonly HashSet<string>? _enumeration;
+
+    private protected ValueValidator(Format format)
+    {
+        _format = format;
+        _type = format.Type;
+        // Snapshot, so that changes to the restriction after compilation can be detected,
+        // the enumeration is a list that can also be changed in place
+        _restriction = format.Restriction is null ? null : format.Restriction with { };
+        if (_restriction?.Enumeration is not null)
+        {
+            _enumerationValues = _restriction.Enumeration.ToArray();
+            _enumeration = new HashSet<string>(_enumerationValues, StringComparer.Ordinal);
+        }
+    }
+
+    private protected Restriction? Restriction => _restriction;
+
+    public static ValueValidator Compile(Format format)
+    {
+        if (format is null)
+            throw new ArgumentNullException(nameof(format));
+
+        return format.Type switch
+        {
+            "Decimal" => new DecimalValidator(format),
+            "Integer" => new IntegerValidator(format),
+            "Boolean" => new BooleanValidator(format),
+            "String" => new StringValidator(format),
+            "DateTime" => new DateTimeValidator(format),
+            _ => throw new Exception($"Invalid format type {format.Type}"),
+        };
+    }
+
+    /// <summary>Validates <paramref name="value"/> without materializing the parsed value</summary>
+    public abstract ValidateResult Validate(string value);
+
+    /// <summary>Validates <paramref name="value"/>, <paramref name="parsedValue"/> is only set when the value is valid</summary>
+    public abstract ValidateResult Validate(string value, out Value? parsedValue);
+
+    internal bool IsCompiledFrom(Format format) =>
+        ReferenceEquals(_format, format)
+        && _type == format.Type
+        && Equals(_restriction, format.Restriction)
+        && (
+            _enumerationValues is null
+            || _enumerationValues.SequenceEqual(format.Restriction!.Enumeration!, StringComparer.Ordinal)
+        );
+
+    private protected ValidateResult? ValidateEnumeration(string value)
+    {
+        if (_enumeration is not null && !_enumeration.Contains(value))
+            return new ValidateResult.Invalid([$"Value {value} is not in the enumeration"]);
+        return null;
+    }
+
+    private sealed class DecimalValidator(Format format) : ValueValidator(format), ITypedValueValidator<decimal>
+    {
+        public override ValidateResult Validate(string value) => Validate(value, out decimal _);
+
+        public override ValidateResult Validate(string value, out Value? parsedValue)
+        {
+            var result = Validate(value, out decimal d);
+            parsedValue = ReferenceEquals(result, Ok) ? new Value.Decimal(d) : null;
+            return result;
+        }
+
+        public ValidateResult Validate(string value, out decimal d)
+        {
+            if (!decimal.TryParse(value, out d))
+                return new ValidateResult.Invalid([$"Invalid decimal value - Value='{value}'"]);
+            if (Restriction is null)
+                return Ok;
+            if (ValidateEnumeration(value) is { } invalid)
+                return invalid;
+            if (Restriction.FractionDigits is not null && Restriction.CountDecimalPlaces(d) > Restriction.FractionDigits)
+                return new ValidateResult.Invalid(["Value has more decimal places than allowed"]);
+            return Restriction.ValidateNumber((double)d) ?? Ok;
+        }
+    }
+
+    private sealed class IntegerValidator(Format format) : ValueValidator(format), ITypedValueValidator<int>
+    {
+        public override ValidateResult Validate(string value) => Validate(value, out int _);
+
+        public override ValidateResult Validate(string value, out Value? parsedValue)
+        {
+            var result = Validate(value, out int i);
+            parsedValue = ReferenceEquals(result, Ok) ? new Value.Integer(i) : null;
+            return result;
+        }
+
+        public ValidateResult Validate(string value, out int i)
+        {
+            if (!int.TryParse(value, out i))
+                return new ValidateResult.Invalid([$"Invalid integer value - Value='{value}'"]);
+            if (Restriction is null)
+                return Ok;
+            if (ValidateEnumeration(value) is { } invalid)
+                return invalid;
+            if (Restriction.ValidateNumber(i) is { } outOfBounds)
+                return outOfBounds;
+            if (Restriction.TotalDigits is not null)
+            {
+                var numDigist = Math.Floor(Math.Log10(Math.Abs(i)) + 1) != Restriction.TotalDigits;
+                return new ValidateResult.Invalid(
+                    [$"Value {i} has {numDigist} digits but should be {Restriction.TotalDigits}"]
+                );
+            }
+            return Ok;
+        }
+    }
+
+    private sealed class BooleanValidator(Format format) : ValueValidator(format), ITypedValueValidator<bool>
+    {
+        private static readonly Value True = new Value.Boolean(true);
+        private static readonly Value False = new Value.Boolean(false);
+
+        public override ValidateResult Validate(string value) => Validate(value, out bool _);
+
+        public override ValidateResult Validate(string value, out Value? parsedValue)
+        {
+            var result = Validate(value, out bool b);
+            parsedValue = ReferenceEquals(result, Ok) ? (b ? True : False) : null;
+            return result;
+        }
+
+        public ValidateResult Validate(string value, out bool b)
+        {
+            if (!bool.TryParse(value, out b))
+                return new ValidateResult.Invalid([$"Invalid boolean value - Value='{value}'"]);
+            return ValidateEnumeration(value) ?? Ok;
+        }
+    }
+
+    private sealed class StringValidator : ValueValidator, ITypedValueValidator<string>
+    {
+        private readonly Regex? _pattern;
+
+        public StringValidator(Format format)
+            : base(format)
+        {
+            if (Restriction?.Pattern is not null)
+                _pattern = new Regex(Restriction.Pattern);
+        }
+
+        public override ValidateResult Validate(string value, out Value? parsedValue)
+        {
+            var result = Validate(value);
+            parsedValue = ReferenceEquals(result, Ok) ? new Value.String(value) : null;
+            return result;
+        }
+
+        public ValidateResult Validate(string value, out string parsedValue)
+        {
+            parsedValue = value;
+            return Validate(value);
+        }
+
+        public override ValidateResult Validate(string value)
+        {
+            if (Restriction is null)
+                return Ok;
+            if (ValidateEnumeration(value) is { } invalid)
+                return invalid;
+
+            var length = value.Length;
+            // check length
+            if (Restriction.Length is not null && length != Restriction.Length)
+                return new ValidateResult.Invalid(
+                    [$"Value {value} has length {length} but should be {Restriction.Length}"]
+                );
+            // check max length
+            if (Restriction.MaxLength is not null && length >= Restriction.MaxLength)
+                return new ValidateResult.Invalid(
+                    [$"Value {value} has length {length} but should be less than {Restriction.MaxLength}"]
+                );
+            // check min length
+            if (Restriction.MinLength is not null && length <= Restriction.MinLength)
+                return new ValidateResult.Invalid(
+                    [$"Value {value} has length {length} but should be greater than {Restriction.MinLength}"]
+                );
+            // check pattern
+            if (_pattern is not null && !_pattern.IsMatch(value))
+                return new ValidateResult.Invalid([$"Value {value} does not match pattern {Restriction.Pattern}"]);
+
+            return Ok;
+        }
+    }
+
+    private sealed class DateTimeValidator(Format format) : ValueValidator(format), ITypedValueValidator<DateTimeOffset>
+    {
+        private const string Pattern = "yyyy-MM-ddTHH:mm:ssZ";
+
+        public override ValidateResult Validate(string value) => Validate(value, out DateTimeOffset _);
+
+        public override ValidateResult Validate(string value, out Value? parsedValue)
+        {
+            var result = Validate(value, out DateTimeOffset dt);
+            parsedValue = ReferenceEquals(result, Ok) ? new Value.DateTime(dt) : null;
+            return result;
+        }
+
+        public ValidateResult Validate(string value, out DateTimeOffset dt)
+        {
+            if (
+                !DateTimeOffset.TryParseExact(
+                    value,
+                    Pattern,
+                    CultureInfo.InvariantCulture,
+                    DateTimeStyles.None,
+                    out dt
+                )
+            )
+                return new ValidateResult.Invalid([$"Invalid datetime value - Value='{value}'"]);
+            return ValidateEnumeration(value) ?? Ok;
+        }
+    }
+}
+
+/// <summary>Typed access to the values parsed by a <see cref="ValueValidator"/>, used to fill typed columns</summary>
+internal interface ITypedValueValidator<T>
+{
+    ValidateResult Validate(string value, out T parsedValue);
+}
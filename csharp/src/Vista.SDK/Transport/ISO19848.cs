@@ -1,6 +1,7 @@
 using System.Collections;
 using System.Globalization;
 using Microsoft.Extensions.Caching.Memory;
+using Vista.SDK.Internal;
 
 namespace Vista.SDK.Transport;
 
@@ -138,18 +139,29 @@ public sealed record DataChannelTypeName(string Type, string Description);
 
 public sealed record DataChannelTypeNames : IEnumerable<DataChannelTypeName>
 {
-    private readonly IReadOnlyList<DataChannelTypeName> _values;
+    private static readonly ParseResult _invalid = new ParseResult.Invalid();
 
-    public DataChannelTypeNames(IReadOnlyList<DataChannelTypeName> values) => _values = values;
+    private readonly IReadOnlyList<DataChannelTypeName> _values;
+    private readonly ChdDictionary<ParseResult> _results;
 
-    public ParseResult Parse(string type)
+    public DataChannelTypeNames(IReadOnlyList<DataChannelTypeName> values)
     {
-        var typeName = _values.FirstOrDefault(x => x.Type == type);
-        if (typeName is null)
-            return new ParseResult.Invalid();
-        return new ParseResult.Ok(typeName);
+        _values = values;
+
+        // The first of duplicate types wins
+        var results = new Dictionary<string, ParseResult>();
+        foreach (var value in values)
+        {
+            if (!string.IsNullOrEmpty(value.Type) && !results.ContainsKey(value.Type))
+                results.Add(value.Type, new ParseResult.Ok(value));
+        }
+        _results = new ChdDictionary<ParseResult>(results.Select(kvp => (kvp.Key, kvp.Value)).ToArray());
     }
 
+    public ParseResult Parse(string type) => Parse(type.AsSpan());
+
+    public ParseResult Parse(ReadOnlySpan<char> type) => _results.TryGetValue(type, out var result) ? result : _invalid;
+
     public IEnumerator<DataChannelTypeName> GetEnumerator() => _values.GetEnumerator();
 
     IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
@@ -290,18 +302,29 @@ public ValidateResult Validate(string value, out Value outValue)
 
 public sealed record FormatDataTypes : IEnumerable<FormatDataType>
 {
-    private readonly IReadOnlyList<FormatDataType> _values;
+    private static readonly ParseResult _invalid = new ParseResult.Invalid();
 
-    public FormatDataTypes(IReadOnlyList<FormatDataType> values) => _values = values;
+    private readonly IReadOnlyList<FormatDataType> _values;
+    private readonly ChdDictionary<ParseResult> _results;
 
-    public ParseResult Parse(string type)
+    public FormatDataTypes(IReadOnlyList<FormatDataType> values)
     {
-        var typeName = _values.FirstOrDefault(x => x.Type == type);
-        if (typeName is null)
-            return new ParseResult.Invalid();
-        return new ParseResult.Ok(typeName);
+        _values = values;
+
+        // The first of duplicate types wins
+        var results = new Dictionary<string, ParseResult>();
+        foreach (var value in values)
+        {
+            if (!string.IsNullOrEmpty(value.Type) && !results.ContainsKey(value.Type))
+                results.Add(value.Type, new ParseResult.Ok(value));
+        }
+        _results = new ChdDictionary<ParseResult>(results.Select(kvp => (kvp.Key, kvp.Value)).ToArray());
     }
 
+    public ParseResult Parse(string type) => Parse(type.AsSpan());
+
+    public ParseResult Parse(ReadOnlySpan<char> type) => _results.TryGetValue(type, out var result) ? result : _invalid;
+
     public IEnumerator<FormatDataType> GetEnumerator() => _values.GetEnumerator();
 
     IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
@@ -60,8 +60,8 @@ public static DataChannelId Parse(string value)
         if (value is null)
             throw new ArgumentNullException(nameof(value));
 
-        if (LocalIdBuilder.TryParse(value, out var localIdBuilder))
-            return new DataChannelId(localIdBuilder.Build());
+        if (SDK.LocalId.TryParseSilent(value, out var localId))
+            return new DataChannelId(localId);
         else
             return new DataChannelId(value);
     }
@@ -0,0 +1,382 @@
+using System.Buffers;
+using Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Transport.TimeSeries;
+
+public enum TabularColumnType
+{
+    /// <summary>Decimal data channels, see <see cref="TabularColumn{T}"/> of <see cref="double"/></summary>
+    Double,
+
+    /// <summary>Integer data channels, see <see cref="TabularColumn{T}"/> of <see cref="long"/></summary>
+    Long,
+
+    /// <summary>Boolean data channels, see <see cref="TabularColumn{T}"/> of <see cref="bool"/></summary>
+    Boolean,
+
+    /// <summary>String data channels, see <see cref="StringTabularColumn"/></summary>
+    String,
+
+    /// <summary>DateTime data channels, see <see cref="TabularColumn{T}"/> of <see cref="DateTimeOffset"/></summary>
+    DateTime,
+}
+
+/// <summary>
+/// Columnar view of a validated <see cref="TabularData"/>, with one typed column per data channel
+/// plus the timestamp column, ready to be handed to columnar writers without another pass over the rows.
+/// </summary>
+/// <remarks>
+/// Values are validated and parsed column by column with the validators of the <see cref="DataChannelList"/>.
+/// The column buffers are rented from <see cref="ArrayPool{T}"/>,
+/// dispose the batch to return them, after which the columns must no longer be used.
+/// </remarks>
+public sealed class TabularColumnBatch : IDisposable
+{
+    private DateTimeOffset[]? _timeStamps;
+    private readonly TabularColumn[] _columns;
+
+    private TabularColumnBatch(int rowCount, DateTimeOffset[] timeStamps, TabularColumn[] columns)
+    {
+        RowCount = rowCount;
+        _timeStamps = timeStamps;
+        _columns = columns;
+    }
+
+    public int RowCount { get; }
+
+    public ReadOnlySpan<DateTimeOffset> TimeStamps =>
+        (_timeStamps ?? throw new ObjectDisposedException(nameof(TabularColumnBatch))).AsSpan(0, RowCount);
+
+    public IReadOnlyList<TabularColumn> Columns => _columns;
+
+    public TabularColumn this[int index] => _columns[index];
+
+    /// <summary>
+    /// Validates <paramref name="table"/> against <paramref name="dataChannelList"/> and converts it to columns.
+    /// </summary>
+    /// <returns>
+    /// <see cref="ValidateResult.Ok"/> with <paramref name="batch"/> set,
+    /// or <see cref="ValidateResult.Invalid"/> with all the errors found and no batch.
+    /// </returns>
+    public static ValidateResult Create(
+        TabularData table,
+        DataChannelList dataChannelList,
+        out TabularColumnBatch? batch
+    )
+    {
+        batch = null;
+        var result = TabularData.Validate(table);
+        if (result is not ValidateResult.Ok)
+            return result;
+
+        var dataChannelIds = table.DataChannelIds!;
+        var dataSets = table.DataSets!;
+        var rowCount = dataSets.Count;
+        for (var i = 0; i < rowCount; i++)
+        {
+            if (dataSets[i].Value.Count != dataChannelIds.Count)
+                return new ValidateResult.Invalid(
+
+                    [
+                        $"Tabular data set {i} expects {dataChannelIds.Count} values, but {dataSets[i].Value.Count} values are provided"
+                    ]
+                );
+        }
+
+        var timeStamps = ArrayPool<DateTimeOffset>.Shared.Rent(rowCount);
+        for (var i = 0; i < rowCount; i++)
+            timeStamps[i] = dataSets[i].TimeStamp;
+
+        var errors = new List<(DataChannelId DataChannelId, string Cause)>();
+        var columns = new TabularColumn[dataChannelIds.Count];
+        var columnCount = 0;
+        for (var j = 0; j < dataChannelIds.Count; j++)
+        {
+            var dataChannelId = dataChannelIds[j];
+            var dataChannel = dataChannelId.Match(
+                onLocalId: id => dataChannelList.TryGetByLocalId(id, out var dc) ? dc : null,
+                onShortId: shortId => dataChannelList.TryGetByShortId(shortId, out var dc) ? dc : null
+            );
+            if (dataChannel is null)
+            {
+                errors.Add(
+                    (
+                        dataChannelId,
+                        dataChannelId.Match(
+                            onLocalId: id => $"Data channel with localId '{id}' not found",
+                            onShortId: shortId => $"Data channel with short id '{shortId}' not found"
+                        )
+                    )
+                );
+                continue;
+            }
+
+            var source = new ColumnSource(dataChannelId, dataChannel, dataSets, j, errors);
+            var column = dataChannelList.GetValidator(dataChannel) switch
+            {
+                ITypedValueValidator<decimal> v
+                    => TabularColumn<double>.Read(v, source, TabularColumnType.Double, static d => (double)d),
+                ITypedValueValidator<int> v
+                    => TabularColumn<long>.Read(v, source, TabularColumnType.Long, static i => i),
+                ITypedValueValidator<bool> v
+                    => TabularColumn<bool>.Read(v, source, TabularColumnType.Boolean, static b => b),
+                ITypedValueValidator<DateTimeOffset> v
+                    => TabularColumn<DateTimeOffset>.Read(v, source, TabularColumnType.DateTime, static dt => dt),
+                ITypedValueValidator<string> v => StringTabularColumn.Read(v, source),
+                _ => throw new Exception($"Invalid format type {dataChannel.Property.Format.Type}"),
+            };
+            columns[columnCount++] = column;
+        }
+
+        if (errors.Count > 0)
+        {
+            ArrayPool<DateTimeOffset>.Shared.Return(timeStamps);
+            for (var j = 0; j < columnCount; j++)
+                columns[j].Return();
+            return new ValidateResult.Invalid(
+                errors.Select(x => $"DataChannel {x.DataChannelId} is invalid: {x.Cause}").ToArray()
+            );
+        }
+
+        batch = new TabularColumnBatch(rowCount, timeStamps, columns);
+        return new ValidateResult.Ok();
+    }
+
+    public void Dispose()
+    {
+        var timeStamps = Interlocked.Exchange(ref _timeStamps, null);
+        if (timeStamps is null)
+            return;
+        ArrayPool<DateTimeOffset>.Shared.Return(timeStamps);
+        foreach (var column in _columns)
+            column.Return();
+    }
+}
+
+/// <summary>The rows of one data channel of a table, that a column is read from</summary>
+internal readonly record struct ColumnSource(
+    DataChannelId DataChannelId,
+    DataChannel.DataChannel DataChannel,
+    List<TabularDataSet> DataSets,
+    int Index,
+    List<(DataChannelId DataChannelId, string Cause)> Errors
+);
+
+/// <summary>A single data channel column of a <see cref="TabularColumnBatch"/></summary>
+public abstract class TabularColumn
+{
+    private string?[]? _quality;
+    private protected bool _returned;
+
+    private protected TabularColumn(
+        DataChannelId dataChannelId,
+        DataChannel.DataChannel dataChannel,
+        TabularColumnType type,
+        int rowCount,
+        string?[]? quality
+    )
+    {
+        DataChannelId = dataChannelId;
+        DataChannel = dataChannel;
+        Type = type;
+        RowCount = rowCount;
+        _quality = quality;
+    }
+
+    public DataChannelId DataChannelId { get; }
+
+    public DataChannel.DataChannel DataChannel { get; }
+
+    public TabularColumnType Type { get; }
+
+    public int RowCount { get; }
+
+    /// <summary>Quality of each row, empty when the table has no quality</summary>
+    public ReadOnlySpan<string?> Quality
+    {
+        get
+        {
+            ThrowIfReturned();
+            return _quality is null ? default : _quality.AsSpan(0, RowCount);
+        }
+    }
+
+    internal virtual void Return()
+    {
+        _returned = true;
+        if (_quality is not null)
+        {
+            ArrayPool<string?>.Shared.Return(_quality, clearArray: true);
+            _quality = null;
+        }
+    }
+
+    private protected void ThrowIfReturned()
+    {
+        if (_returned)
+            throw new ObjectDisposedException(nameof(TabularColumnBatch));
+    }
+
+    private protected static string?[]? ReadQuality(List<TabularDataSet> dataSets, int index)
+    {
+        string?[]? quality = null;
+        for (var i = 0; i < dataSets.Count; i++)
+        {
+            var value = dataSets[i].Quality?[index];
+            if (value is null)
+                continue;
+            if (quality is null)
+            {
+                quality = ArrayPool<string?>.Shared.Rent(dataSets.Count);
+                Array.Clear(quality, 0, dataSets.Count);
+            }
+            quality[i] = value;
+        }
+        return quality;
+    }
+}
+
+/// <summary>Column of fixed size values, see <see cref="TabularColumnType"/> for the types of each format</summary>
+public sealed class TabularColumn<T> : TabularColumn
+    where T : struct
+{
+    private T[]? _values;
+
+    private TabularColumn(
+        DataChannelId dataChannelId,
+        DataChannel.DataChannel dataChannel,
+        TabularColumnType type,
+        int rowCount,
+        T[] values,
+        string?[]? quality
+    )
+        : base(dataChannelId, dataChannel, type, rowCount, quality) => _values = values;
+
+    public ReadOnlySpan<T> Values
+    {
+        get
+        {
+            ThrowIfReturned();
+            return _values!.AsSpan(0, RowCount);
+        }
+    }
+
+    internal static TabularColumn Read<TParsed>(
+        ITypedValueValidator<TParsed> validator,
+        ColumnSource source,
+        TabularColumnType type,
+        Func<TParsed, T> convert
+    )
+    {
+        var (dataChannelId, dataChannel, dataSets, index, errors) = source;
+        var values = ArrayPool<T>.Shared.Rent(dataSets.Count);
+        for (var i = 0; i < dataSets.Count; i++)
+        {
+            if (validator.Validate(dataSets[i].Value[index], out var parsed) is ValidateResult.Invalid invalid)
+            {
+                errors.Add((dataChannelId, string.Join(", ", invalid.Messages)));
+                continue;
+            }
+            values[i] = convert(parsed);
+        }
+
+        return new TabularColumn<T>(
+            dataChannelId,
+            dataChannel,
+            type,
+            dataSets.Count,
+            values,
+            ReadQuality(dataSets, index)
+        );
+    }
+
+    internal override void Return()
+    {
+        base.Return();
+        if (_values is not null)
+        {
+            ArrayPool<T>.Shared.Return(_values);
+            _values = null;
+        }
+    }
+}
+
+/// <summary>
+/// Dictionary encoded column of string values,
+/// each row holds the index of its value in <see cref="Dictionary"/>.
+/// </summary>
+public sealed class StringTabularColumn : TabularColumn
+{
+    private int[]? _indices;
+    private readonly List<string> _dictionary;
+
+    private StringTabularColumn(
+        DataChannelId dataChannelId,
+        DataChannel.DataChannel dataChannel,
+        int rowCount,
+        int[] indices,
+        List<string> dictionary,
+        string?[]? quality
+    )
+        : base(dataChannelId, dataChannel, TabularColumnType.String, rowCount, quality)
+    {
+        _indices = indices;
+        _dictionary = dictionary;
+    }
+
+    public ReadOnlySpan<int> Indices
+    {
+        get
+        {
+            ThrowIfReturned();
+            return _indices!.AsSpan(0, RowCount);
+        }
+    }
+
+    /// <summary>The distinct values of the column, in order of first occurrence</summary>
+    public IReadOnlyList<string> Dictionary => _dictionary;
+
+    public string this[int row] => _dictionary[Indices[row]];
+
+    internal static TabularColumn Read(ITypedValueValidator<string> validator, ColumnSource source)
+    {
+        var (dataChannelId, dataChannel, dataSets, index, errors) = source;
+        var indices = ArrayPool<int>.Shared.Rent(dataSets.Count);
+        var dictionary = new List<string>();
+        var lookup = new Dictionary<string, int>(StringComparer.Ordinal);
+        for (var i = 0; i < dataSets.Count; i++)
+        {
+            if (validator.Validate(dataSets[i].Value[index], out var value) is ValidateResult.Invalid invalid)
+            {
+                errors.Add((dataChannelId, string.Join(", ", invalid.Messages)));
+                continue;
+            }
+            if (!lookup.TryGetValue(value, out var valueIndex))
+            {
+                valueIndex = dictionary.Count;
+                lookup.Add(value, valueIndex);
+                dictionary.Add(value);
+            }
+            indices[i] = valueIndex;
+        }
+
+        return new StringTabularColumn(
+            dataChannelId,
+            dataChannel,
+            dataSets.Count,
+            indices,
+            dictionary,
+            ReadQuality(dataSets, index)
+        );
+    }
+
+    internal override void Return()
+    {
+        base.Return();
+        if (_indices is not null)
+        {
+            ArrayPool<int>.Shared.Return(_indices);
+            _indices = null;
+        }
+    }
+}
@@ -0,0 +1,615 @@
+using System.Buffers;
+using Vista.SDK.Internal;
+
+namespace Vista.SDK.Transport.TimeSeries;
+
+/// <summary>
+/// Column by column encoding of the data sets of a <see cref="TabularData"/> table, for the transports to carry
+/// instead of a timestamp and the value strings for every row.
+/// </summary>
+/// <remarks>
+/// <list type="bullet">
+/// <item>Timestamps are stored as delta of deltas, a single bit per row when sampled at a fixed interval.</item>
+/// <item>
+/// Numeric columns are stored as decimals with delta of deltas of the mantissas when all values share a scale,
+/// otherwise as doubles XOR'ed with the previous value (Gorilla).
+/// Only values that format back to the exact same string are stored as numbers.
+/// </item>
+/// <item>Other columns and the qualities are run-length encoded indices into a table of the distinct strings.</item>
+/// </list>
+/// Decoding gives back data sets equal to the encoded ones, the data channel ids are left to the transports.
+/// </remarks>
+public static class TabularDataCodec
+{
+    private const byte Format = 1;
+
+    private const int DecimalColumn = 0;
+    private const int DoubleColumn = 1;
+    private const int StringColumn = 2;
+
+    private const int NoQuality = 0;
+    private const int AllQuality = 1;
+    private const int SomeQuality = 2;
+
+    // DateTimeOffset allows offsets of up to 14 hours
+    private const int MaxOffsetMinutes = 14 * 60;
+
+    // Counts read from the encoded data aren't trusted for preallocating
+    private const int MaxInitialCapacity = 1024;
+
+    /// <summary>The default maximum number of values, data sets times data channels, of a decoded table</summary>
+    public const int DefaultMaxValues = 16 * 1024 * 1024;
+
+    /// <summary>
+    /// Encodes the data sets of <paramref name="table"/> into <paramref name="destination"/>.
+    /// </summary>
+    /// <returns>
+    /// False without writing anything when the table can't be encoded, when it has no data channels or data sets,
+    /// or any data set doesn't have a value (and quality, if any) per data channel.
+    /// </returns>
+    public static bool TryEncode(TabularData table, IBufferWriter<byte> destination)
+    {
+        var dataSets = table.DataSets;
+        if (dataSets is null || table.DataChannelIds is null)
+            return false;
+
+        var columns = table.DataChannelIds.Count;
+        var rows = dataSets.Count;
+        var qualityRows = 0;
+        foreach (var dataSet in dataSets)
+        {
+            if (dataSet.Value is null || !IsComplete(dataSet.Value, columns))
+                return false;
+            if (dataSet.Quality is null)
+                continue;
+            if (!IsComplete(dataSet.Quality, columns))
+                return false;
+            qualityRows++;
+        }
+
+        var writer = new BitWriter(destination);
+        writer.WriteBits(Format, 8);
+        writer.WriteVarUInt((ulong)rows);
+        writer.WriteVarUInt((ulong)columns);
+        if (rows > 0)
+        {
+            WriteTimeStamps(ref writer, dataSets);
+
+            var scratch = ArrayPool<long>.Shared.Rent(rows);
+            try
+            {
+                for (var column = 0; column < columns; column++)
+                    WriteColumn(ref writer, dataSets, column, scratch);
+            }
+            finally
+            {
+                ArrayPool<long>.Shared.Return(scratch);
+            }
+
+            WriteQuality(ref writer, dataSets, columns, qualityRows);
+        }
+        writer.Complete();
+        return true;
+    }
+
+    /// <inheritdoc cref="Decode(ReadOnlySpan{byte}, int)"/>
+    public static List<TabularDataSet> Decode(ReadOnlySpan<byte> encoded) => Decode(encoded, DefaultMaxValues);
+
+    /// <summary>Decodes data sets encoded by <see cref="TryEncode"/></summary>
+    /// <param name="encoded">The encoded data sets</param>
+    /// <param name="maxValues">The maximum number of values, data sets times data channels, to decode</param>
+    /// <exception cref="InvalidDataException">
+    /// <paramref name="encoded"/> is not valid, or holds more than <paramref name="maxValues"/> values
+    /// </exception>
+    /// <exception cref="EndOfStreamException"><paramref name="encoded"/> is truncated</exception>
+    public static List<TabularDataSet> Decode(ReadOnlySpan<byte> encoded, int maxValues)
+    {
+        var reader = new BitReader(encoded);
+        var (rows, columns) = ReadCounts(ref reader, maxValues);
+        var dataSets = new List<TabularDataSet>(Math.Min(rows, MaxInitialCapacity));
+        if (rows == 0)
+            return dataSets;
+
+        ReadTimeStamps(ref reader, dataSets, rows, columns);
+        for (var column = 0; column < columns; column++)
+            ReadColumn(ref reader, dataSets);
+        ReadQuality(ref reader, dataSets, columns);
+        return dataSets;
+    }
+
+    /// <summary>
+    /// Reads the number of data sets and data channels of data sets encoded by <see cref="TryEncode"/>,
+    /// to check them before decoding
+    /// </summary>
+    /// <exception cref="InvalidDataException"><paramref name="encoded"/> is not valid</exception>
+    /// <exception cref="EndOfStreamException"><paramref name="encoded"/> is truncated</exception>
+    public static (int DataSets, int DataChannels) ReadCounts(ReadOnlySpan<byte> encoded)
+    {
+        var reader = new BitReader(encoded);
+        return ReadCounts(ref reader, int.MaxValue);
+    }
+
+    private static (int Rows, int Columns) ReadCounts(ref BitReader reader, int maxValues)
+    {
+        var format = reader.ReadBits(8);
+        if (format != Format)
+            throw new InvalidDataException($"Unsupported tabular data encoding {format}");
+
+        var rows = reader.ReadLength();
+        var columns = reader.ReadLength();
+        if (rows == 0)
+            return (rows, columns);
+
+        // Each row takes at least a bit of its timestamp and each column a bit of its kind,
+        // so counts larger than what is left can't be valid
+        if (rows > reader.RemainingBits || columns > reader.RemainingBits)
+            throw new EndOfStreamException("Unexpected end of encoded data");
+        if ((long)rows * columns > maxValues)
+            throw new InvalidDataException($"Tabular data has more than {maxValues} values");
+        return (rows, columns);
+    }
+
+    private static bool IsComplete(List<string> values, int columns)
+    {
+        if (values.Count != columns)
+            return false;
+        foreach (var value in values)
+        {
+            if (value is null)
+                return false;
+        }
+        return true;
+    }
+
+    private static void WriteTimeStamps(ref BitWriter writer, List<TabularDataSet> dataSets)
+    {
+        var previous = dataSets[0].TimeStamp.UtcTicks;
+        var previousDelta = 0L;
+        writer.WriteVarInt(previous);
+        for (var i = 1; i < dataSets.Count; i++)
+        {
+            var ticks = dataSets[i].TimeStamp.UtcTicks;
+            var delta = ticks - previous;
+            writer.WriteDeltaOfDelta(delta - previousDelta);
+            previous = ticks;
+            previousDelta = delta;
+        }
+
+        // Offsets hardly ever change within a table
+        var offset = dataSets[0].TimeStamp.Offset;
+        var run = 0;
+        foreach (var dataSet in dataSets)
+        {
+            if (dataSet.TimeStamp.Offset == offset)
+            {
+                run++;
+                continue;
+            }
+            writer.WriteVarInt((long)offset.TotalMinutes);
+            writer.WriteVarUInt((ulong)run);
+            offset = dataSet.TimeStamp.Offset;
+            run = 1;
+        }
+        writer.WriteVarInt((long)offset.TotalMinutes);
+        writer.WriteVarUInt((ulong)run);
+    }
+
+    private static void ReadTimeStamps(ref BitReader reader, List<TabularDataSet> dataSets, int rows, int columns)
+    {
+        var ticks = ArrayPool<long>.Shared.Rent(rows);
+        try
+        {
+            var previous = reader.ReadVarInt();
+            var previousDelta = 0L;
+            ticks[0] = previous;
+            for (var i = 1; i < rows; i++)
+            {
+                var delta = previousDelta + reader.ReadDeltaOfDelta();
+                previous += delta;
+                previousDelta = delta;
+                ticks[i] = previous;
+            }
+
+            while (dataSets.Count < rows)
+            {
+                var offsetMinutes = reader.ReadVarInt();
+                if (offsetMinutes is < -MaxOffsetMinutes or > MaxOffsetMinutes)
+                    throw new InvalidDataException($"Invalid timestamp offset {offsetMinutes}");
+                var offset = System.TimeSpan.FromMinutes(offsetMinutes);
+                var run = reader.ReadLength();
+                if (run == 0 || run > rows - dataSets.Count)
+                    throw new InvalidDataException($"Invalid timestamp offset run {run}");
+
+                for (var i = 0; i < run; i++)
+                {
+                    var utcTicks = ticks[dataSets.Count];
+                    dataSets.Add(
+                        new TabularDataSet
+                        {
+                            TimeStamp = ToDateTimeOffset(utcTicks, offset),
+                            Value = new List<string>(Math.Min(columns, MaxInitialCapacity)),
+                            Quality = null,
+                        }
+                    );
+                }
+            }
+        }
+        finally
+        {
+            ArrayPool<long>.Shared.Return(ticks);
+        }
+    }
+
+    private static DateTimeOffset ToDateTimeOffset(long utcTicks, System.TimeSpan offset)
+    {
+        try
+        {
+            return new DateTimeOffset(utcTicks, System.TimeSpan.Zero).ToOffset(offset);
+        }
+        catch (ArgumentException ex)
+        {
+            throw new InvalidDataException("Invalid timestamp", ex);
+        }
+    }
+
+    private static void WriteColumn(ref BitWriter writer, List<TabularDataSet> dataSets, int column, long[] scratch)
+    {
+        var rows = dataSets.Count;
+        if (TryParseDecimals(dataSets, column, scratch, out var scale))
+        {
+            writer.WriteBits(DecimalColumn, 2);
+            writer.WriteBits((ulong)scale, 5);
+
+            var previous = scratch[0];
+            var previousDelta = 0L;
+            writer.WriteVarInt(previous);
+            for (var i = 1; i < rows; i++)
+            {
+                var delta = scratch[i] - previous;
+                writer.WriteDeltaOfDelta(delta - previousDelta);
+                previous = scratch[i];
+                previousDelta = delta;
+            }
+        }
+        else if (TryParseDoubles(dataSets, column, scratch))
+        {
+            writer.WriteBits(DoubleColumn, 2);
+
+            var previous = (ulong)scratch[0];
+            writer.WriteBits(previous, 64);
+            var previousLeading = -1;
+            var previousTrailing = 0;
+            for (var i = 1; i < rows; i++)
+            {
+                var bits = (ulong)scratch[i];
+                var xor = bits ^ previous;
+                previous = bits;
+                if (xor == 0)
+                {
+                    writer.WriteBits(0, 1);
+                    continue;
+                }
+
+                var leading = Math.Min(LeadingZeroCount(xor), 31);
+                var trailing = TrailingZeroCount(xor);
+                if (previousLeading >= 0 && leading >= previousLeading && trailing >= previousTrailing)
+                {
+                    // The meaningful bits fit in the window of the previous value
+                    writer.WriteBits(0b10, 2);
+                    writer.WriteBits(xor >> previousTrailing, 64 - previousLeading - previousTrailing);
+                    continue;
+                }
+
+                var significant = 64 - leading - trailing;
+                writer.WriteBits(0b11, 2);
+                writer.WriteBits((ulong)leading, 5);
+                writer.WriteBits((ulong)(significant & 63), 6);
+                writer.WriteBits(xor >> trailing, significant);
+                previousLeading = leading;
+                previousTrailing = trailing;
+            }
+        }
+        else
+        {
+            writer.WriteBits(StringColumn, 2);
+
+            var strings = new Dictionary<string, int>(StringComparer.Ordinal);
+            var run = 0;
+            string? current = null;
+            foreach (var dataSet in dataSets)
+            {
+                var value = dataSet.Value[column];
+                if (run > 0 && value == current)
+                {
+                    run++;
+                    continue;
+                }
+                if (run > 0)
+                    WriteStringRun(ref writer, strings, current!, run);
+                current = value;
+                run = 1;
+            }
+            WriteStringRun(ref writer, strings, current!, run);
+        }
+    }
+
+    private static void ReadColumn(ref BitReader reader, List<TabularDataSet> dataSets)
+    {
+        var rows = dataSets.Count;
+        var kind = (int)reader.ReadBits(2);
+        switch (kind)
+        {
+            case DecimalColumn:
+            {
+                var scale = (int)reader.ReadBits(5);
+                if (scale > DecimalText.MaxDigits)
+                    throw new InvalidDataException($"Invalid decimal scale {scale}");
+
+                var previous = reader.ReadVarInt();
+                var previousDelta = 0L;
+                var value = DecimalText.Format(previous, scale);
+                dataSets[0].Value.Add(value);
+                for (var i = 1; i < rows; i++)
+                {
+                    var delta = previousDelta + reader.ReadDeltaOfDelta();
+                    previousDelta = delta;
+                    if (delta != 0)
+                    {
+                        previous += delta;
+                        value = DecimalText.Format(previous, scale);
+                    }
+                    dataSets[i].Value.Add(value);
+                }
+                break;
+            }
+            case DoubleColumn:
+            {
+                var previous = reader.ReadBits(64);
+                var value = DecimalText.FormatDouble(BitConverter.Int64BitsToDouble((long)previous));
+                dataSets[0].Value.Add(value);
+                var previousLeading = -1;
+                var previousTrailing = 0;
+                for (var i = 1; i < rows; i++)
+                {
+                    if (reader.ReadBit())
+                    {
+                        ulong xor;
+                        if (!reader.ReadBit())
+                        {
+                            if (previousLeading < 0)
+                                throw new InvalidDataException("Invalid double column");
+                            xor = reader.ReadBits(64 - previousLeading - previousTrailing) << previousTrailing;
+                        }
+                        else
+                        {
+                            var leading = (int)reader.ReadBits(5);
+                            var significant = (int)reader.ReadBits(6);
+                            if (significant == 0)
+                                significant = 64;
+                            var trailing = 64 - leading - significant;
+                            if (trailing < 0)
+                                throw new InvalidDataException("Invalid double column");
+                            xor = reader.ReadBits(significant) << trailing;
+                            previousLeading = leading;
+                            previousTrailing = trailing;
+                        }
+                        previous ^= xor;
+                        value = DecimalText.FormatDouble(BitConverter.Int64BitsToDouble((long)previous));
+                    }
+                    dataSets[i].Value.Add(value);
+                }
+                break;
+            }
+            case StringColumn:
+            {
+                var strings = new List<string>();
+                for (var i = 0; i < rows; )
+                {
+                    var value = ReadStringRun(ref reader, strings, rows - i, out var run);
+                    for (var end = i + run; i < end; i++)
+                        dataSets[i].Value.Add(value);
+                }
+                break;
+            }
+            default:
+                throw new InvalidDataException($"Invalid column kind {kind}");
+        }
+    }
+
+    private static void WriteQuality(ref BitWriter writer, List<TabularDataSet> dataSets, int columns, int qualityRows)
+    {
+        if (qualityRows == 0)
+        {
+            writer.WriteBits(NoQuality, 2);
+            return;
+        }
+
+        if (qualityRows == dataSets.Count)
+        {
+            writer.WriteBits(AllQuality, 2);
+        }
+        else
+        {
+            // Runs of data sets alternating between with and without quality
+            writer.WriteBits(SomeQuality, 2);
+            var present = dataSets[0].Quality is not null;
+            writer.WriteBit(present);
+            var run = 0;
+            foreach (var dataSet in dataSets)
+            {
+                if ((dataSet.Quality is not null) == present)
+                {
+                    run++;
+                    continue;
+                }
+                writer.WriteVarUInt((ulong)run);
+                present = !present;
+                run = 1;
+            }
+            writer.WriteVarUInt((ulong)run);
+        }
+
+        var strings = new Dictionary<string, int>(StringComparer.Ordinal);
+        for (var column = 0; column < columns; column++)
+        {
+            var run = 0;
+            string? current = null;
+            foreach (var dataSet in dataSets)
+            {
+                if (dataSet.Quality is null)
+                    continue;
+                var quality = dataSet.Quality[column];
+                if (run > 0 && quality == current)
+                {
+                    run++;
+                    continue;
+                }
+                if (run > 0)
+                    WriteStringRun(ref writer, strings, current!, run);
+                current = quality;
+                run = 1;
+            }
+            WriteStringRun(ref writer, strings, current!, run);
+        }
+    }
+
+    private static void ReadQuality(ref BitReader reader, List<TabularDataSet> dataSets, int columns)
+    {
+        var mode = (int)reader.ReadBits(2);
+        var qualityRows = 0;
+        switch (mode)
+        {
+            case NoQuality:
+                return;
+            case AllQuality:
+                foreach (var dataSet in dataSets)
+                    dataSet.Quality = new List<string>(Math.Min(columns, MaxInitialCapacity));
+                qualityRows = dataSets.Count;
+                break;
+            case SomeQuality:
+                var present = reader.ReadBit();
+                for (var i = 0; i < dataSets.Count; )
+                {
+                    var run = reader.ReadLength();
+                    if (run == 0 || run > dataSets.Count - i)
+                        throw new InvalidDataException($"Invalid quality run {run}");
+                    for (var end = i + run; i < end; i++)
+                    {
+                        if (present)
+                            dataSets[i].Quality = new List<string>(Math.Min(columns, MaxInitialCapacity));
+                    }
+                    if (present)
+                        qualityRows += run;
+                    present = !present;
+                }
+                break;
+            default:
+                throw new InvalidDataException($"Invalid quality mode {mode}");
+        }
+
+        var strings = new List<string>();
+        for (var column = 0; column < columns; column++)
+        {
+            var row = 0;
+            for (var i = 0; i < qualityRows; )
+            {
+                var quality = ReadStringRun(ref reader, strings, qualityRows - i, out var run);
+                for (var end = i + run; i < end; i++)
+                {
+                    while (dataSets[row].Quality is null)
+                        row++;
+                    dataSets[row++].Quality!.Add(quality);
+                }
+            }
+        }
+    }
+
+    // The index of a string written before, or the next index followed by the string itself, then the run length
+    private static void WriteStringRun(ref BitWriter writer, Dictionary<string, int> strings, string value, int run)
+    {
+        if (strings.TryGetValue(value, out var index))
+        {
+            writer.WriteVarUInt((ulong)index);
+        }
+        else
+        {
+            index = strings.Count;
+            strings[value] = index;
+            writer.WriteVarUInt((ulong)index);
+            writer.WriteString(value);
+        }
+        writer.WriteVarUInt((ulong)run);
+    }
+
+    private static string ReadStringRun(ref BitReader reader, List<string> strings, int remaining, out int run)
+    {
+        var index = reader.ReadLength();
+        string value;
+        if (index < strings.Count)
+        {
+            value = strings[index];
+        }
+        else if (index == strings.Count)
+        {
+            value = reader.ReadString();
+            strings.Add(value);
+        }
+        else
+        {
+            throw new InvalidDataException($"Invalid string reference {index}");
+        }
+
+        run = reader.ReadLength();
+        if (run == 0 || run > remaining)
+            throw new InvalidDataException($"Invalid string run {run}");
+        return value;
+    }
+
+    private static bool TryParseDecimals(List<TabularDataSet> dataSets, int column, long[] mantissas, out int scale)
+    {
+        scale = -1;
+        for (var i = 0; i < dataSets.Count; i++)
+        {
+            if (!DecimalText.TryParse(dataSets[i].Value[column], out mantissas[i], out var valueScale))
+                return false;
+            if (scale < 0)
+                scale = valueScale;
+            else if (scale != valueScale)
+                return false;
+        }
+        return true;
+    }
+
+    private static bool TryParseDoubles(List<TabularDataSet> dataSets, int column, long[] bits)
+    {
+        for (var i = 0; i < dataSets.Count; i++)
+        {
+            if (!DecimalText.TryParseDouble(dataSets[i].Value[column], out var value))
+                return false;
+            bits[i] = BitConverter.DoubleToInt64Bits(value);
+        }
+        return true;
+    }
+
+#if NET8_0_OR_GREATER
+    private static int LeadingZeroCount(ulong value) => System.Numerics.BitOperations.LeadingZeroCount(value);
+
+    private static int TrailingZeroCount(ulong value) => System.Numerics.BitOperations.TrailingZeroCount(value);
+#else
+    private static int LeadingZeroCount(ulong value)
+    {
+        var count = 0;
+        for (var mask = 1UL << 63; mask != 0 && (value & mask) == 0; mask >>= 1)
+            count++;
+        return count;
+    }
+
+    private static int TrailingZeroCount(ulong value)
+    {
+        var count = 0;
+        for (var mask = 1UL; mask != 0 && (value & mask) == 0; mask <<= 1)
+            count++;
+        return count;
+    }
+#endif
+}
@@ -1,3 +1,5 @@
+using System.Diagnostics;
+using Vista.SDK.Internal;
 using Vista.SDK.Transport.DataChannel;
 
 namespace Vista.SDK.Transport.TimeSeries;
@@ -48,6 +50,40 @@ public sealed record TimeSeriesData
         ValidateData onTabularData,
         ValidateData onEventData
     )
+    {
+        if (!VisTelemetry.IsValidationEnabled && !VisTelemetry.ActivitySource.HasListeners())
+            return ValidateCore(dcPackage, onTabularData, onEventData);
+
+        using var activity = VisTelemetry.StartValidation();
+        var start = Stopwatch.GetTimestamp();
+        var result = ValidateCore(dcPackage, onTabularData, onEventData);
+        var values = ValueCount();
+        VisTelemetry.Validated(result is ValidateResult.Ok, values, start);
+        if (activity is not null)
+        {
+            activity.SetTag("values", values);
+            if (result is ValidateResult.Invalid)
+                activity.SetStatus(ActivityStatusCode.Error);
+        }
+        return result;
+    }
+
+    private long ValueCount()
+    {
+        long values = EventData?.DataSet?.Count ?? 0;
+        foreach (var table in TabularData ?? [])
+        {
+            foreach (var dataSet in table?.DataSets ?? [])
+                values += dataSet?.Value?.Count ?? 0;
+        }
+        return values;
+    }
+
+    private ValidateResult ValidateCore(
+        DataChannelListPackage dcPackage,
+        ValidateData onTabularData,
+        ValidateData onEventData
+    )
     {
         if (DataConfiguration is not null)
         {
@@ -59,6 +95,7 @@ ValidateData onEventData
         if ((TabularData is null || TabularData.Count == 0) && (EventData is null || EventData.DataSet?.Count == 0))
             return new ValidateResult.Invalid(["Can't ingest timeseries data without data"]);
 
+        var dataChannelList = dcPackage.Package.DataChannelList;
         var errorneousDataChannels = new List<(DataChannelId DataChannelId, string Cause)>();
         // Validate Tabluar data
         foreach (var table in TabularData ?? [])
@@ -76,6 +113,20 @@ ValidateData onEventData
             if (result is not ValidateResult.Ok)
                 return result;
 
+            // Resolve the data channels and their validators once per table, rather than once per value
+            var dataChannelCount = table.DataChannelIds.Count;
+            var dataChannels = new DataChannel.DataChannel?[dataChannelCount];
+            var validators = new ValueValidator?[dataChannelCount];
+            var resolveErrors = new string?[dataChannelCount];
+            for (var j = 0; j < dataChannelCount; j++)
+            {
+                var dataChannel = Resolve(table.DataChannelIds[j], out resolveErrors[j]);
+                if (dataChannel is null)
+                    continue;
+                dataChannels[j] = dataChannel;
+                validators[j] = dataChannelList.GetValidator(dataChannel);
+            }
+
             for (var i = 0; i < table.DataSets.Count; i++)
             {
                 var dataset = table.DataSets[i];
@@ -87,111 +138,61 @@ ValidateData onEventData
                         ]
                     );
 
-                for (var j = 0; j < table.NumberOfDataChannels; j++)
+                for (var j = 0; j < dataChannelCount; j++)
                 {
-                    var dataChannelId = table.DataChannelIds[j];
-                    DataChannel.DataChannel? dataChannel = dataChannelId.Match(
-                        onLocalId: id =>
-                        {
-                            if (!dcPackage.Package.DataChannelList.TryGetByLocalId(id, out var dc) || dc is null)
-                            {
-                                errorneousDataChannels.Add(
-                                    (dataChannelId, $"Data channel with localId '{id}' not found")
-                                );
-                                return null;
-                            }
-                            return dc;
-                        },
-                        onShortId: shortId =>
-                        {
-                            if (!dcPackage.Package.DataChannelList.TryGetByShortId(shortId, out var dc) || dc is null)
-                            {
-                                errorneousDataChannels.Add(
-                                    (dataChannelId, $"Data channel with short id '{shortId}' not found")
-                                );
-                                return null;
-                            }
-                            return dc;
-                        }
-                    );
+                    var dataChannel = dataChannels[j];
                     if (dataChannel is null)
+                    {
+                        errorneousDataChannels.Add((table.DataChannelIds[j], resolveErrors[j]!));
                         continue;
+                    }
 
-                    var typeValidation = dataChannel
-                        .Property
-                        .Format
-                        .ValidateValue(dataset.Value[j], out var parsedValue);
+                    var typeValidation = validators[j]!.Validate(dataset.Value[j], out var parsedValue);
 
                     if (typeValidation is ValidateResult.Invalid invalid)
                     {
-                        errorneousDataChannels.Add((dataChannelId, string.Join(", ", invalid.Messages)));
+                        errorneousDataChannels.Add((table.DataChannelIds[j], string.Join(", ", invalid.Messages)));
                         continue;
                     }
 
-                    result = onTabularData(dataset.TimeStamp, dataChannel, parsedValue, dataset.Quality?[j]);
+                    result = onTabularData(dataset.TimeStamp, dataChannel, parsedValue!, dataset.Quality?[j]);
 
                     if (result is not ValidateResult.Ok)
                     {
-                        errorneousDataChannels.Add((dataChannelId, result.ToString()));
+                        errorneousDataChannels.Add((table.DataChannelIds[j], result.ToString()));
                         continue;
                     }
                 }
             }
+        }
 
-            // Validate event data
-            if (EventData is not null)
+        // Validate event data
+        if (EventData is not null)
+        {
+            foreach (var eventData in EventData.DataSet ?? [])
             {
-                foreach (var eventData in EventData.DataSet ?? [])
+                var dataChannel = Resolve(eventData.DataChannelId, out var resolveError);
+                if (dataChannel is null)
                 {
-                    DataChannel.DataChannel? dataChannel = eventData
-                        .DataChannelId
-                        .Match(
-                            onLocalId: id =>
-                            {
-                                if (!dcPackage.Package.DataChannelList.TryGetByLocalId(id, out var dc) || dc is null)
-                                {
-                                    errorneousDataChannels.Add(
-                                        (eventData.DataChannelId, $"Data channel with localId '{id}' not found")
-                                    );
-                                    return null;
-                                }
-                                return dc;
-                            },
-                            onShortId: shortId =>
-                            {
-                                if (
-                                    !dcPackage.Package.DataChannelList.TryGetByShortId(shortId, out var dc)
-                                    || dc is null
-                                )
-                                {
-                                    errorneousDataChannels.Add(
-                                        (eventData.DataChannelId, $"Data channel with short id '{shortId}' not found")
-                                    );
-                                    return null;
-                                }
-                                return dc;
-                            }
-                        );
-                    if (dataChannel is null)
-                        continue;
+                    errorneousDataChannels.Add((eventData.DataChannelId, resolveError!));
+                    continue;
+                }
 
-                    var typeValidation = dataChannel
-                        .Property
-                        .Format
-                        .ValidateValue(eventData.Value, out var parsedValue);
-                    if (typeValidation is ValidateResult.Invalid invalid)
-                    {
-                        errorneousDataChannels.Add((eventData.DataChannelId, string.Join(", ", invalid.Messages)));
-                        continue;
-                    }
+                var typeValidation = dataChannelList
+                    .GetValidator(dataChannel)
+                    .Validate(eventData.Value, out var parsedValue);
+                if (typeValidation is ValidateResult.Invalid invalid)
+                {
+                    errorneousDataChannels.Add((eventData.DataChannelId, string.Join(", ", invalid.Messages)));
+                    continue;
+                }
 
-                    result = onEventData(eventData.TimeStamp, dataChannel, parsedValue, eventData.Quality);
+                var result = onEventData(eventData.TimeStamp, dataChannel, parsedValue!, eventData.Quality);
 
-                    if (result is not ValidateResult.Ok)
-                    {
-                        errorneousDataChannels.Add((eventData.DataChannelId, result.ToString()));
-                        continue;
-                    }
+                if (result is not ValidateResult.Ok)
+                {
+                    errorneousDataChannels.Add((eventData.DataChannelId, result.ToString()));
+                    continue;
                 }
             }
         }
@@ -204,6 +205,22 @@ ValidateData onEventData
         }
 
         return new ValidateResult.Ok();
+
+        DataChannel.DataChannel? Resolve(DataChannelId dataChannelId, out string? error)
+        {
+            DataChannel.DataChannel? dataChannel = null;
+            error = dataChannelId.Match(
+                onLocalId: id =>
+                    dataChannelList.TryGetByLocalId(id, out dataChannel)
+                        ? null
+                        : $"Data channel with localId '{id}' not found",
+                onShortId: shortId =>
+                    dataChannelList.TryGetByShortId(shortId, out dataChannel)
+                        ? null
+                        : $"Data channel with short id '{shortId}' not found"
+            );
+            return dataChannel;
+        }
     }
 }
 
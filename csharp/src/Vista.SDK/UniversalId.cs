@@ -1,3 +1,7 @@
+using System.Buffers;
+using System.Diagnostics.CodeAnalysis;
+using Vista.SDK.Internal;
+
 namespace Vista.SDK;
 
 public class UniversalId : IUniversalId, IEquatable<UniversalId>
@@ -13,6 +17,15 @@ internal UniversalId(IUniversalIdBuilder builder)
         _localId = builder.LocalId!.Build();
     }
 
+    // For parsing, where the local ID is already built and possibly interned
+    private UniversalId(IUniversalIdBuilder builder, LocalId localId)
+    {
+        if (!builder.IsValid)
+            throw new ArgumentException("Invalid UniversalId state");
+        _builder = builder;
+        _localId = localId;
+    }
+
     public ImoNumber ImoNumber =>
         _builder.ImoNumber is not null ? _builder.ImoNumber.Value : throw new Exception("Invalid ImoNumber");
     public LocalId LocalId => _localId;
@@ -41,6 +54,126 @@ public static bool TryParse(string universalIdStr, out ParsingErrors errors, out
         return true;
     }
 
+    /// <summary>
+    /// Parses without diagnostics, an ID with an unknown naming entity or an invalid IMO number is not valid.
+    /// The local ID is parsed through <see cref="LocalId.TryParse(ReadOnlySpan{char}, out LocalId?)"/>,
+    /// and the vessel prefix is only validated the first time a vessel is seen.
+    /// </summary>
+    public static bool TryParse(ReadOnlySpan<char> universalIdStr, [NotNullWhen(true)] out UniversalId? universalId)
+    {
+        var last = default(LastVessel);
+        return TryParseCore(universalIdStr, null, ref last, out universalId);
+    }
+
+    /// <inheritdoc cref="TryParse(ReadOnlySpan{char}, out UniversalId?)"/>
+    public static bool TryParse(ReadOnlySpan<byte> utf8, [NotNullWhen(true)] out UniversalId? universalId)
+    {
+        char[]? rented = null;
+        Span<char> buffer =
+            utf8.Length <= LocalId.MaxStackallocChars
+                ? stackalloc char[utf8.Length]
+                : (rented = ArrayPool<char>.Shared.Rent(utf8.Length));
+        try
+        {
+            var length = LocalId.DecodeUtf8(utf8, buffer);
+            return TryParse(buffer.Slice(0, length), out universalId);
+        }
+        finally
+        {
+            if (rented is not null)
+                ArrayPool<char>.Shared.Return(rented);
+        }
+    }
+
+    /// <summary>
+    /// Parses <paramref name="items"/>, which usually come in runs from the same vessel:
+    /// an item with the same vessel prefix as the one before reuses its IMO number without another lookup.
+    /// </summary>
+    /// <exception cref="ArgumentException">If any of the items is not a valid universal ID</exception>
+    public static UniversalId[] ParseAll(ReadOnlySpan<string> items)
+    {
+        var universalIds = new UniversalId[items.Length];
+        var last = default(LastVessel);
+        for (var i = 0; i < items.Length; i++)
+        {
+            var item = items[i];
+            if (!TryParseCore(item.AsSpan(), item, ref last, out var universalId))
+                throw ParseError(item);
+            universalIds[i] = universalId;
+        }
+        return universalIds;
+    }
+
+    private static ArgumentException ParseError(string? item)
+    {
+        // Parsed again for what is wrong with the item, the fast path doesn't collect errors
+        UniversalIdBuilder.TryParse(item!, out var errors, out _);
+        return new ArgumentException($"Couldn't parse universal ID from: '{item}'. {errors}");
+    }
+
+    /// <summary>
+    /// Parses <paramref name="items"/> into <paramref name="universalIds"/> like <see cref="ParseAll"/>,
+    /// items that are not valid universal IDs are set to null.
+    /// </summary>
+    /// <returns>The number of items that were parsed</returns>
+    public static int TryParseAll(ReadOnlySpan<string?> items, Span<UniversalId?> universalIds)
+    {
+        if (universalIds.Length < items.Length)
+            throw new ArgumentException("Output span is shorter than the items", nameof(universalIds));
+
+        var parsed = 0;
+        var last = default(LastVessel);
+        for (var i = 0; i < items.Length; i++)
+        {
+            var item = items[i];
+            universalIds[i] = TryParseCore(item.AsSpan(), item, ref last, out var universalId) ? universalId : null;
+            if (universalIds[i] is not null)
+                parsed++;
+        }
+        return parsed;
+    }
+
+    /// <summary>The vessel prefix of the previous item of a batch, as the string it was parsed from</summary>
+    private struct LastVessel
+    {
+        public string? Item;
+        public int PrefixLength;
+        public ImoNumber ImoNumber;
+    }
+
+    private static bool TryParseCore(
+        ReadOnlySpan<char> span,
+        string? item,
+        ref LastVessel last,
+        [NotNullWhen(true)] out UniversalId? universalId
+    )
+    {
+        universalId = null;
+        var localIdStart = UniversalIdBuilder.LocalIdStart(span);
+        if (localIdStart == -1 || !LocalId.TryParse(span.Slice(localIdStart), out var localId))
+            return false;
+
+        var prefix = span.Slice(0, localIdStart);
+        ImoNumber imoNumber;
+        if (last.Item is not null && prefix.SequenceEqual(last.Item.AsSpan(0, last.PrefixLength)))
+        {
+            imoNumber = last.ImoNumber;
+        }
+        else
+        {
+            var errorBuilder = LocalIdParsingErrorBuilder.Silent;
+            if (!UniversalIdBuilder.TryParseVesselPrefix(prefix, ref errorBuilder, out imoNumber))
+                return false;
+            if (errorBuilder.HasError)
+                return false;
+            if (item is not null)
+                last = new LastVessel { Item = item, PrefixLength = localIdStart, ImoNumber = imoNumber };
+        }
+
+        universalId = new UniversalId(UniversalIdBuilder.Create(localId.Builder, imoNumber), localId);
+        return true;
+    }
+
     public override string ToString() => _builder.ToString();
 
     public override int GetHashCode() => _builder.GetHashCode();
@@ -10,6 +10,11 @@ namespace Vista.SDK;
 
 partial record class UniversalIdBuilder
 {
+    private const string LocalIdPrefix = "/dnv-v";
+
+    // Vessel prefixes validated by any parse, shared as fleets are few compared to their IDs
+    internal static readonly VesselPrefixCache PrefixCache = new();
+
     public static UniversalIdBuilder Parse(string universalIdStr)
     {
         if (!TryParse(universalIdStr, out var errors, out var universalId))
@@ -38,93 +43,136 @@ public static bool TryParse(string universalId, [MaybeNullWhen(false)] out Unive
             errors = errorBuilder.Build();
             return false;
         }
-        if (universalId.Length == 0)
+
+        var result = TryParseInternal(universalId.AsSpan(), ref errorBuilder, out universalIdBuilder);
+        errors = errorBuilder.Build();
+        return result;
+    }
+
+    /// <inheritdoc cref="TryParse(string, out UniversalIdBuilder)"/>
+    public static bool TryParse(
+        ReadOnlySpan<char> universalId,
+        [MaybeNullWhen(false)] out UniversalIdBuilder universalIdBuilder
+    )
+    {
+        var errorBuilder = LocalIdParsingErrorBuilder.Silent;
+        return TryParseInternal(universalId, ref errorBuilder, out universalIdBuilder);
+    }
+
+    /// <inheritdoc cref="TryParse(string, out ParsingErrors, out UniversalIdBuilder)"/>
+    public static bool TryParse(
+        ReadOnlySpan<char> universalId,
+        out ParsingErrors errors,
+        [MaybeNullWhen(false)] out UniversalIdBuilder universalIdBuilder
+    )
+    {
+        var errorBuilder = LocalIdParsingErrorBuilder.Empty;
+        var result = TryParseInternal(universalId, ref errorBuilder, out universalIdBuilder);
+        errors = errorBuilder.Build();
+        return result;
+    }
+
+    /// <summary>Index of the local ID within a universal ID, or -1 if there is none</summary>
+    internal static int LocalIdStart(ReadOnlySpan<char> universalId) => universalId.IndexOf(LocalIdPrefix.AsSpan());
+
+    private static bool TryParseInternal(
+        ReadOnlySpan<char> universalId,
+        ref LocalIdParsingErrorBuilder errorBuilder,
+        [MaybeNullWhen(false)] out UniversalIdBuilder universalIdBuilder
+    )
+    {
+        universalIdBuilder = null;
+
+        var localIdStartIndex = LocalIdStart(universalId);
+        if (localIdStartIndex == -1)
         {
             AddError(ref errorBuilder, LocalIdParsingState.NamingRule, "Failed to find localId start segment");
-            errors = errorBuilder.Build();
             return false;
         }
 
-        var localIdStartIndex = universalId.IndexOf("/dnv-v");
-        if (localIdStartIndex == -1)
+        if (!LocalIdBuilder.TryParseInternal(universalId.Slice(localIdStartIndex), ref errorBuilder, out var localId))
         {
-            AddError(ref errorBuilder, LocalIdParsingState.NamingRule, "Failed to find localId start segment");
-            errors = errorBuilder.Build();
+            // Dont need additional error, as the localIdBuilder does it for us
             return false;
         }
 
-        var universalIdSegment = universalId.Substring(0, localIdStartIndex);
-        var localIdSegment = universalId.Substring(localIdStartIndex);
-
-        ImoNumber? imoNumber = null;
+        var prefix = universalId.Slice(0, localIdStartIndex);
+        ImoNumber? imoNumber = TryParseVesselPrefix(prefix, ref errorBuilder, out var imo) ? imo : null;
 
-        var localIdBuilder = LocalIdBuilder.TryParseInternal(localIdSegment, ref errorBuilder, out var b) ? b : null;
-
-        if (localIdBuilder is null)
+        if (localId.VisVersion is null)
         {
-            // Dont need additional error, as the localIdBuilder does it for us
-            errors = errorBuilder.Build();
+            AddError(ref errorBuilder, LocalIdParsingState.VisVersion, null);
             return false;
         }
 
-        ReadOnlySpan<char> span = universalIdSegment.AsSpan();
+        universalIdBuilder = Create(localId, imoNumber);
+        return true;
+    }
+
+    internal static UniversalIdBuilder Create(LocalIdBuilder localId, ImoNumber? imoNumber) =>
+        new() { _localId = localId, ImoNumber = imoNumber };
+
+    /// <summary>
+    /// Parses the naming entity and IMO number before the local ID,
+    /// answering from <see cref="PrefixCache"/> for vessels that have been seen before
+    /// </summary>
+    internal static bool TryParseVesselPrefix(
+        ReadOnlySpan<char> prefix,
+        ref LocalIdParsingErrorBuilder errorBuilder,
+        out ImoNumber imoNumber
+    )
+    {
+        if (PrefixCache.TryGet(prefix, out imoNumber))
+            return true;
+
+        var valid = true;
+        var found = false;
         var state = LocalIdParsingState.NamingEntity;
         int i = 0;
 
         while (state <= LocalIdParsingState.IMONumber)
         {
-            if (i >= span.Length)
+            if (i >= prefix.Length)
                 break; // We've consumed the string
-            var nextSlash = span.Slice(i).IndexOf('/');
-            var segment = nextSlash == -1 ? span.Slice(i) : span.Slice(i, nextSlash);
+            var nextSlash = prefix.Slice(i).IndexOf('/');
+            var segment = nextSlash == -1 ? prefix.Slice(i) : prefix.Slice(i, nextSlash);
 
             switch (state)
             {
                 case LocalIdParsingState.NamingEntity:
                     if (!NamingEntity.AsSpan().SequenceEqual(segment))
                     {
-                        AddError(
-                            ref errorBuilder,
-                            state,
-                            "Naming entity segment didnt match. Found: " + segment.ToString()
-                        );
-                        break;
+                        valid = false;
+                        var message = errorBuilder.IsSilent
+                            ? null
+                            : "Naming entity segment didnt match. Found: " + segment.ToString();
+                        AddError(ref errorBuilder, state, message);
                     }
                     break;
                 case LocalIdParsingState.IMONumber:
-                    if (!SDK.ImoNumber.TryParse(segment, out var imo))
-                    {
+                    found = SDK.ImoNumber.TryParse(segment, out imoNumber);
+                    if (!found)
                         AddError(ref errorBuilder, state, "Invalid IMO number segment");
-                        break;
-                    }
-                    else
-                    {
-                        imoNumber = imo;
-                    }
                     break;
             }
             state++;
             i += segment.Length + 1;
         }
 
-        var visVersion = localIdBuilder.VisVersion;
-        if (visVersion is null)
-        {
-            AddError(ref errorBuilder, LocalIdParsingState.VisVersion, null);
-            errors = errorBuilder.Build();
-            return false;
-        }
-
-        universalIdBuilder = Create(visVersion.Value).TryWithLocalId(in localIdBuilder).TryWithImoNumber(in imoNumber);
-
-        errors = errorBuilder.Build();
-        return true;
+        // A wrong naming entity is reported, but the IMO number is still used
+        if (found && valid)
+            PrefixCache.Add(prefix, imoNumber);
+        return found;
     }
 
     static void AddError(ref LocalIdParsingErrorBuilder errorBuilder, LocalIdParsingState state, string? message)
     {
         if (!errorBuilder.HasError)
-            errorBuilder = LocalIdParsingErrorBuilder.Create();
+        {
+            errorBuilder = errorBuilder.IsSilent
+                ? LocalIdParsingErrorBuilder.SilentFailed
+                : LocalIdParsingErrorBuilder.Create();
+        }
 
         errorBuilder.AddError(state, message);
     }
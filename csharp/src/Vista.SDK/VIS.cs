@@ -1,5 +1,5 @@
 using System.Text;
-using Microsoft.Extensions.Caching.Memory;
+using Vista.SDK.Internal;
 
 namespace Vista.SDK;
 
@@ -32,63 +32,106 @@ public sealed class VIS : IVIS
 {
     public static readonly VisVersion LatestVisVersion = VisVersion.v3_10a;
 
-    private readonly MemoryCache _gmodDtoCache;
-    private readonly MemoryCache _gmodCache;
-    private readonly MemoryCache _codebooksDtoCache;
-    private readonly MemoryCache _codebooksCache;
-    private readonly MemoryCache _locationsDtoCache;
-    private readonly MemoryCache _locationsCache;
-    private readonly MemoryCache _gmodVersioningDtoCache;
-    private readonly MemoryCache _gmodVersioningCache;
-    private const string _versioning = "versioning";
+    private static readonly int _visVersionCount = Enum.GetValues(typeof(VisVersion)).Length;
+
+    private volatile Caches _caches;
+    private volatile string? _mappedGmodDirectory;
 
     public static readonly VIS Instance = new VIS();
 
     public VIS()
+        : this(new VisOptions()) { }
+
+    public VIS(VisOptions options)
     {
-        _gmodDtoCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
-        _gmodCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
-        _codebooksDtoCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
-        _codebooksCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
-        _locationsDtoCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
-        _locationsCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
+        _caches = CreateCaches(options);
+    }
 
-        _gmodVersioningDtoCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
-        _gmodVersioningCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
+    /// <summary>
+    /// Replaces the caches of this instance with ones configured by <paramref name="options"/>.
+    /// Models loaded so far are dropped, outstanding references to them stay valid.
+    /// </summary>
+    public void Configure(VisOptions options) => _caches = CreateCaches(options);
+
+    private static Caches CreateCaches(VisOptions options)
+    {
+        if (options is null)
+            throw new ArgumentNullException(nameof(options));
+        options.Validate();
+
+        return new Caches(
+            VisModelCache<GmodDto>.CreateExpiring("gmod-dto", options),
+            VisModelCache<Gmod>.Create("gmod", options, _visVersionCount),
+            VisModelCache<CodebooksDto>.CreateExpiring("codebooks-dto", options),
+            VisModelCache<Codebooks>.Create("codebooks", options, _visVersionCount),
+            VisModelCache<LocationsDto>.CreateExpiring("locations-dto", options),
+            VisModelCache<Locations>.Create("locations", options, _visVersionCount),
+            VisModelCache<Dictionary<string, GmodVersioningDto>>.CreateExpiring(
+                "gmod-versioning-dto",
+                options,
+                perVersion: false
+            ),
+            VisModelCache<GmodVersioning>.Create("gmod-versioning", options, 1, perVersion: false)
         );
     }
 
+    // Source data is only needed while building models, so it always expires
+    private sealed record Caches(
+        VisModelCache<GmodDto> GmodDtos,
+        VisModelCache<Gmod> Gmods,
+        VisModelCache<CodebooksDto> CodebooksDtos,
+        VisModelCache<Codebooks> Codebooks,
+        VisModelCache<LocationsDto> LocationsDtos,
+        VisModelCache<Locations> Locations,
+        VisModelCache<Dictionary<string, GmodVersioningDto>> GmodVersioningDtos,
+        VisModelCache<GmodVersioning> GmodVersioning
+    );
+
+    // VIS versions are numbered from zero in order
+    private static int Slot(VisVersion visVersion)
+    {
+        if ((uint)visVersion >= (uint)_visVersionCount)
+            throw new ArgumentException("Invalid VIS version: " + visVersion);
+        return (int)visVersion;
+    }
+
+    /// <summary>
+    /// Loads the Gmods, codebooks and locations of <paramref name="visVersions"/>, all versions if not specified,
+    /// and the Gmod versioning, in parallel so that later lookups never pay for building a model
+    /// </summary>
+    public Task PreloadAsync(IEnumerable<VisVersion>? visVersions = null, CancellationToken cancellationToken = default)
+    {
+        var versions = new HashSet<VisVersion>(visVersions ?? GetVisVersions());
+        var invalidVisVersions = versions.Where(v => !v.IsValid()).ToArray();
+        if (invalidVisVersions.Length > 0)
+            throw new ArgumentException("Invalid VIS versions provided: " + string.Join(", ", invalidVisVersions));
+
+        var tasks = new List<Task>(versions.Count * 3 + 1);
+        foreach (var version in versions)
+        {
+            tasks.Add(Task.Run(() => GetGmod(version), cancellationToken));
+            tasks.Add(Task.Run(() => GetCodebooks(version), cancellationToken));
+            tasks.Add(Task.Run(() => GetLocations(version), cancellationToken));
+        }
+        tasks.Add(Task.Run(() => GetGmodVersioning(), cancellationToken));
+
+        return Task.WhenAll(tasks);
+    }
+
     internal GmodDto GetGmodDto(VisVersion visVersion)
     {
-        return _gmodDtoCache.GetOrCreate(
+        return _caches.GmodDtos.GetOrCreate(
+            Slot(visVersion),
             visVersion,
-            entry =>
+            static visVersion =>
             {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
                 var dto = LoadGmodDto(visVersion);
                 if (dto is null)
                     throw new Exception("Invalid state");
 
                 return dto;
             }
-        )!;
+        );
     }
 
     internal static GmodDto? LoadGmodDto(VisVersion visVersion) =>
@@ -96,21 +139,92 @@ internal GmodDto GetGmodDto(VisVersion visVersion)
 
     public Gmod GetGmod(VisVersion visVersion)
     {
-        if (!visVersion.IsValid())
-            throw new ArgumentException("Invalid VIS version: " + visVersion);
+        return _caches.Gmods.GetOrCreate(
+            Slot(visVersion),
+            (Vis: this, Version: visVersion),
+            static s => s.Vis.CreateGmod(s.Version)
+        );
+    }
 
-        return _gmodCache.GetOrCreate(
-            visVersion,
-            entry =>
-            {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
+    private Gmod CreateGmod(VisVersion visVersion)
+    {
+        var mappedGmodDirectory = _mappedGmodDirectory;
+        if (mappedGmodDirectory is not null)
+            return new Gmod(visVersion, OpenMappedGmodStore(mappedGmodDirectory, visVersion), mapped: true);
+
+        using (var store = LoadGmodStore(visVersion))
+        {
+            if (store is not null)
+                return new Gmod(visVersion, store);
+        }
+
+        var dto = GetGmodDto(visVersion);
 
-                var dto = GetGmodDto(visVersion);
+        return new Gmod(visVersion, dto);
+    }
+
+    internal static GmodStore? LoadGmodStore(VisVersion visVersion)
+    {
+        var stream = EmbeddedResource.GetGmodSnapshot(visVersion.ToVersionString());
+        if (stream is null)
+            return null;
+
+        return GmodStore.FromResource(stream);
+    }
 
-                return new Gmod(visVersion, dto);
+    /// <summary>
+    /// Backs Gmods created from now on by read-only memory mapped snapshot files in <paramref name="directory"/>,
+    /// which are written on first use if missing. Node lookups, children and parents are read from the mapped pages
+    /// and nodes are only materialized when accessed, so processes on the same host that use the same directory
+    /// share a single copy of the model through the OS page cache instead of each holding it on the managed heap.
+    /// The directory should not be shared between different versions of the SDK.
+    /// </summary>
+    public void UseMemoryMappedGmods(string directory)
+    {
+        if (string.IsNullOrWhiteSpace(directory))
+            throw new ArgumentException("Directory must be specified", nameof(directory));
+
+        Directory.CreateDirectory(directory);
+        _mappedGmodDirectory = directory;
+        _caches.Gmods.Clear();
+    }
+
+    internal GmodStore OpenMappedGmodStore(string directory, VisVersion visVersion)
+    {
+        var path = Path.Combine(
+            directory,
+            $"gmod-vis-{visVersion.ToVersionString()}.v{GmodSnapshot.FormatVersion}{GmodSnapshot.FileExtension}"
+        );
+
+        if (!File.Exists(path))
+        {
+            // Write to a temporary file first so that other processes never map a partially written snapshot
+            var tempPath = $"{path}.{Guid.NewGuid():N}.tmp";
+            try
+            {
+                using (var file = new FileStream(tempPath, FileMode.CreateNew, FileAccess.Write))
+                {
+                    using var resource = EmbeddedResource.GetGmodSnapshot(visVersion.ToVersionString());
+                    if (resource is not null)
+                        resource.CopyTo(file);
+                    else
+                        GmodSnapshot.Create(GetGmodDto(visVersion)).WriteTo(file);
+                }
+
+                File.Move(tempPath, path);
+            }
+            catch (IOException) when (File.Exists(path))
+            {
+                // Another process published the snapshot first
+            }
+            finally
+            {
+                if (File.Exists(tempPath))
+                    File.Delete(tempPath);
             }
-        )!;
+        }
+
+        return GmodStore.Open(path);
     }
 
     public IReadOnlyDictionary<VisVersion, Gmod> GetGmodsMap(IEnumerable<VisVersion> visVersions)
@@ -128,13 +242,11 @@ public Gmod GetGmod(VisVersion visVersion)
 
     private Dictionary<string, GmodVersioningDto> GetGmodVersioningDto()
     {
-        return _gmodVersioningDtoCache.GetOrCreate(
-            _versioning,
-            entry =>
+        return _caches.GmodVersioningDtos.GetOrCreate(
+            0,
+            0,
+            static _ =>
             {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
                 var dtos = EmbeddedResource.GetGmodVersioning();
 
                 if (dtos is null)
@@ -142,57 +254,41 @@ public Gmod GetGmod(VisVersion visVersion)
 
                 return dtos;
             }
-        )!;
+        );
     }
 
-    private GmodVersioning GetGmodVersioning()
+    internal GmodVersioning GetGmodVersioning()
     {
-        return _gmodVersioningCache.GetOrCreate(
-            _versioning,
-            entry =>
-            {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
-                var dto = GetGmodVersioningDto();
-
-                return new GmodVersioning(dto);
-            }
-        )!;
+        return _caches.GmodVersioning.GetOrCreate(
+            0,
+            this,
+            static vis => new GmodVersioning(vis.GetGmodVersioningDto())
+        );
     }
 
     private CodebooksDto GetCodebooksDto(VisVersion visVersion)
     {
-        return _codebooksDtoCache.GetOrCreate(
+        return _caches.CodebooksDtos.GetOrCreate(
+            Slot(visVersion),
             visVersion,
-            entry =>
+            static visVersion =>
             {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
                 var dto = EmbeddedResource.GetCodebooks(visVersion.ToVersionString());
                 if (dto is null)
                     throw new Exception("Invalid state");
 
                 return dto;
             }
-        )!;
+        );
     }
 
     public Codebooks GetCodebooks(VisVersion visVersion)
     {
-        return _codebooksCache.GetOrCreate(
-            visVersion,
-            entry =>
-            {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
-                var dto = GetCodebooksDto(visVersion);
-
-                return new Codebooks(visVersion, dto);
-            }
-        )!;
+        return _caches.Codebooks.GetOrCreate(
+            Slot(visVersion),
+            (Vis: this, Version: visVersion),
+            static s => new Codebooks(s.Version, s.Vis.GetCodebooksDto(s.Version))
+        );
     }
 
     public IReadOnlyDictionary<VisVersion, Codebooks> GetCodebooksMap(IEnumerable<VisVersion> visVersions)
@@ -210,13 +306,11 @@ public Codebooks GetCodebooks(VisVersion visVersion)
 
     private LocationsDto GetLocationsDto(VisVersion visVersion)
     {
-        return _locationsDtoCache.GetOrCreate(
+        return _caches.LocationsDtos.GetOrCreate(
+            Slot(visVersion),
             visVersion,
-            entry =>
+            static visVersion =>
             {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
                 var dto = EmbeddedResource.GetLocations(visVersion.ToVersionString());
 
                 if (dto is null)
@@ -224,23 +318,16 @@ private LocationsDto GetLocationsDto(VisVersion visVersion)
 
                 return dto;
             }
-        )!;
+        );
     }
 
     public Locations GetLocations(VisVersion visversion)
     {
-        return _locationsCache.GetOrCreate(
-            visversion,
-            entry =>
-            {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
-                var dto = GetLocationsDto(visversion);
-
-                return new Locations(visversion, dto);
-            }
-        )!;
+        return _caches.Locations.GetOrCreate(
+            Slot(visversion),
+            (Vis: this, Version: visversion),
+            static s => new Locations(s.Version, s.Vis.GetLocationsDto(s.Version))
+        );
     }
 
     public IReadOnlyDictionary<VisVersion, Locations> GetLocationsMap(IEnumerable<VisVersion> visVersions)
@@ -265,19 +352,44 @@ public IEnumerable<VisVersion> GetVisVersions()
         ConvertNode(sourceNode.VisVersion, sourceNode, targetVersion);
 
     public GmodNode? ConvertNode(VisVersion sourceVersion, GmodNode sourceNode, VisVersion targetVersion) =>
-        GetGmodVersioning().ConvertNode(sourceVersion, sourceNode, targetVersion);
+        VisTelemetry.Converted(
+            VisTelemetry.Node,
+            GetGmodVersioning().ConvertNode(sourceVersion, sourceNode, targetVersion)
+        );
 
     public GmodPath? ConvertPath(GmodPath sourcePath, VisVersion targetVersion) =>
         ConvertPath(sourcePath.VisVersion, sourcePath, targetVersion);
 
     public GmodPath? ConvertPath(VisVersion sourceVersion, GmodPath sourcePath, VisVersion targetVersion) =>
-        GetGmodVersioning().ConvertPath(sourceVersion, sourcePath, targetVersion);
+        VisTelemetry.Converted(
+            VisTelemetry.Path,
+            GetGmodVersioning().ConvertPath(sourceVersion, sourcePath, targetVersion)
+        );
 
     public LocalIdBuilder? ConvertLocalId(LocalIdBuilder sourceLocalId, VisVersion targetVersion) =>
-        GetGmodVersioning().ConvertLocalId(sourceLocalId, targetVersion);
+        VisTelemetry.Converted(VisTelemetry.LocalId, GetGmodVersioning().ConvertLocalId(sourceLocalId, targetVersion));
 
     public LocalId? ConvertLocalId(LocalId sourceLocalId, VisVersion targetVersion) =>
-        GetGmodVersioning().ConvertLocalId(sourceLocalId, targetVersion);
+        VisTelemetry.Converted(VisTelemetry.LocalId, GetGmodVersioning().ConvertLocalId(sourceLocalId, targetVersion));
+
+    /// <summary>
+    /// Converts many paths to <paramref name="targetVersion"/>, each from its own VIS version.
+    /// Paths that occur more than once are only converted once.
+    /// </summary>
+    /// <returns>The converted paths in source order, null where a path could not be converted</returns>
+    public IReadOnlyList<GmodPath?> ConvertPaths(IEnumerable<GmodPath> sourcePaths, VisVersion targetVersion) =>
+        VisTelemetry.ConvertedAll(VisTelemetry.Path, GetGmodVersioning().ConvertPaths(sourcePaths, targetVersion));
+
+    /// <summary>
+    /// Converts many local IDs to <paramref name="targetVersion"/>, each from its own VIS version.
+    /// Items that occur in more than one local ID are only converted once.
+    /// </summary>
+    /// <returns>The converted local IDs in source order, null where a local ID could not be converted</returns>
+    public IReadOnlyList<LocalId?> ConvertLocalIds(IEnumerable<LocalId> sourceLocalIds, VisVersion targetVersion) =>
+        VisTelemetry.ConvertedAll(
+            VisTelemetry.LocalId,
+            GetGmodVersioning().ConvertLocalIds(sourceLocalIds, targetVersion)
+        );
 
     /// <summary>Rules according to: "ISO19848 5.2.1, Note 1" and "RFC3986 2.3 - Unreserved characters"</summary>
     internal static bool MatchISOLocalIdString(StringBuilder builder)
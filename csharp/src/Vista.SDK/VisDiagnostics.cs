@@ -0,0 +1,22 @@
+namespace Vista.SDK;
+
+/// <summary>
+/// Names of the instrumentation the SDK publishes. Nothing is recorded unless a listener is attached,
+/// e.g. <c>dotnet-counters monitor --counters Vista-SDK,Vista.SDK -p &lt;pid&gt;</c>
+/// </summary>
+public static class VisDiagnostics
+{
+    /// <summary>
+    /// Name of the <c>System.Diagnostics.Metrics.Meter</c> with counters and histograms for model loads,
+    /// VIS cache lookups, local ID intern lookups, parsing, versioning conversions and time series validation
+    /// </summary>
+    public const string MeterName = "Vista.SDK";
+
+    /// <summary>
+    /// Name of the <c>System.Diagnostics.ActivitySource</c> with spans around model loads and time series validation
+    /// </summary>
+    public const string ActivitySourceName = "Vista.SDK";
+
+    /// <summary>Name of the <c>EventSource</c> with event counters and model load events</summary>
+    public const string EventSourceName = "Vista-SDK";
+}
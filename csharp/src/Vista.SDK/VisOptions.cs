@@ -0,0 +1,41 @@
+namespace Vista.SDK;
+
+/// <summary>How <see cref="VIS"/> keeps the models it has loaded</summary>
+public enum VisCacheMode
+{
+    /// <summary>
+    /// Models are published once per VIS version and never evicted, lookups are a lock-free array read
+    /// </summary>
+    Registry,
+
+    /// <summary>
+    /// Models are kept in size limited memory caches
+    /// and evicted when unused for <see cref="VisOptions.SlidingExpiration"/>
+    /// </summary>
+    Expiring,
+}
+
+public sealed class VisOptions
+{
+    /// <summary>How loaded Gmods, codebooks, locations and versioning are kept</summary>
+    public VisCacheMode CacheMode { get; set; } = VisCacheMode.Registry;
+
+    /// <summary>
+    /// Number of entries each cache holds, for the source data the models are built from in both modes
+    /// and for the models themselves in <see cref="VisCacheMode.Expiring"/> mode
+    /// </summary>
+    public int SizeLimit { get; set; } = 10;
+
+    /// <summary>How long a cache entry is kept without being used</summary>
+    public TimeSpan SlidingExpiration { get; set; } = TimeSpan.FromHours(1);
+
+    internal void Validate()
+    {
+        if (!Enum.IsDefined(typeof(VisCacheMode), CacheMode))
+            throw new ArgumentException("Invalid cache mode: " + CacheMode, nameof(CacheMode));
+        if (SizeLimit <= 0)
+            throw new ArgumentException("Size limit must be positive", nameof(SizeLimit));
+        if (SlidingExpiration <= TimeSpan.Zero)
+            throw new ArgumentException("Sliding expiration must be positive", nameof(SlidingExpiration));
+    }
+}
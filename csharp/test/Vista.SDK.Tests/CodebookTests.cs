@@ -14,6 +14,7 @@ public void Test_Position_Validation(string input, string expectedOutput)
         var parsedExpectedOutput = PositionValidationResults.FromString(expectedOutput);
 
         Assert.Equal(parsedExpectedOutput, validPosition);
+        Assert.Equal(parsedExpectedOutput, codebookType.ValidatePosition(input.AsSpan()));
     }
 
     [Theory]
@@ -59,6 +60,54 @@ public void Test_States(string invalidGroup, string validValue, string validGrou
         Assert.True(states.HasGroup(validGroup));
 
         Assert.True(states.HasStandardValue(secondValidValue));
+
+        Assert.False(states.HasGroup(invalidGroup.AsSpan()));
+        Assert.True(states.HasGroup($"{validGroup}/".AsSpan(0, validGroup.Length)));
+        Assert.True(states.HasStandardValue($"{validValue}/".AsSpan(0, validValue.Length)));
+    }
+
+    [Fact]
+    public void Test_Create_Tag_From_Span()
+    {
+        var codebooks = VIS.Instance.GetCodebooks(VisVersion.v3_4a);
+
+        var names = new[]
+        {
+            CodebookName.Quantity,
+            CodebookName.Content,
+            CodebookName.Calculation,
+            CodebookName.State,
+            CodebookName.Command,
+            CodebookName.Type,
+            CodebookName.Position,
+        };
+        foreach (var name in names)
+        {
+            var codebook = codebooks[name];
+            foreach (var value in codebook.StandardValues)
+            {
+                var span = $"-{value}-".AsSpan(1, value.Length);
+                Assert.True(codebook.HasStandardValue(span));
+
+                var expected = codebook.TryCreateTag(value);
+                var actual = codebooks.TryCreateTag(name, span);
+                Assert.Equal(expected, actual);
+                if (actual is not null)
+                    Assert.Same(value, actual.Value.Value);
+            }
+        }
+
+        var positions = codebooks[CodebookName.Position];
+        Assert.Equal(positions.TryCreateTag("centre-1"), positions.TryCreateTag("centre-1".AsSpan()));
+        Assert.Equal(positions.TryCreateTag("customposition"), positions.TryCreateTag("customposition".AsSpan()));
+        Assert.Null(positions.TryCreateTag(" ".AsSpan()));
+        Assert.Null(positions.TryCreateTag(ReadOnlySpan<char>.Empty));
+
+        var quantities = codebooks[CodebookName.Quantity];
+        var custom = quantities.TryCreateTag("asdf".AsSpan());
+        Assert.True(custom!.Value.IsCustom);
+        Assert.Equal("asdf", custom.Value.Value);
+        Assert.Null(quantities.TryCreateTag("a/b".AsSpan()));
     }
 
     [Theory]
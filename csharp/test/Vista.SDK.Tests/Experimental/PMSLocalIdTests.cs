@@ -1,3 +1,5 @@
+using System.Text;
+using Vista.SDK.Internal;
 using Vista.SDK.Tests;
 
 namespace Vista.SDK.Experimental.Tests;
@@ -186,4 +188,102 @@ public void Test_Build(string pmsLocalIdStr)
         Assert.NotSame(parsedId, builtFromBuilder);
         Assert.True(parsedId == builtFromBuilder);
     }
+
+    [Theory]
+    [InlineData("/dnv-v2-experimental/vis-3-6a/411.1/C101.661i-F/C621/meta/maint.cat-preventive/act.type-service")]
+    [InlineData(
+        "/dnv-v2-experimental/vis-3-6a/621.21/S90.1/S41/~fuel.oil.piping/~pipes/meta/maint.cat-preventive/act.type-service"
+    )]
+    [InlineData(
+        "/dnv-v2-experimental/vis-3-6a/511.11-2/C101.663i/C663/meta/maint.cat-preventive/act.type-service/detail-turbine"
+    )]
+    public void Test_Span_And_Utf8_Parsing(string pmsLocalIdStr)
+    {
+        var expected = PMSLocalId.Parse(pmsLocalIdStr);
+
+        Assert.True(PMSLocalId.TryParse(pmsLocalIdStr.AsSpan(), out var fromSpan));
+        Assert.True(PMSLocalId.TryParse(Encoding.UTF8.GetBytes(pmsLocalIdStr), out var fromUtf8));
+
+        Assert.Equal(expected, fromSpan);
+        Assert.Equal(expected, fromUtf8);
+        Assert.Equal(pmsLocalIdStr, fromSpan.ToString());
+    }
+
+    [Theory]
+    [InlineData(
+        "/dnv-v2-experimental/vis-3-6a/411.1/C101.64/S201/meta/calc-sum/act.type-check",
+        "Invalid metadata tag: unknown prefix calc"
+    )]
+    [InlineData(
+        "/dnv-v2/vis-3-6a/411.1/C101.64/S201/meta/maint.cat-preventive/act.type-check",
+        "Missing or invalid naming rule"
+    )]
+    [InlineData(
+        "/dnv-v2-experimental/vis-3-6a/411.1/C101.64/S201/meta/act.type-check/maint.cat-preventive",
+        "Invalid metadata tag: unknown prefix maint.cat"
+    )]
+    public void Test_Parsing_Validation(string pmsLocalIdStr, string expectedErrorMessage)
+    {
+        var parsed = PMSLocalIdBuilder.TryParse(pmsLocalIdStr, out var errors, out _);
+
+        Assert.False(parsed);
+        Assert.Equal(expectedErrorMessage, errors.First().Message);
+        Assert.False(PMSLocalIdBuilder.TryParse(pmsLocalIdStr.AsSpan(), out _));
+    }
+
+    [Theory]
+    [InlineData("maint.cat-", "MetaMaintenanceCategory", "Invalid MaintenanceCategory metadata tag: missing value")]
+    [InlineData(
+        "maint.cat-xyz%/act.type-check",
+        "MetaMaintenanceCategory",
+        "Invalid MaintenanceCategory metadata tag: failed to create xyz%"
+    )]
+    [InlineData(
+        "maint.cat-preventive/act.type",
+        "MetaActivityType",
+        "Invalid metadata tag: missing prefix '-' or '~' in act.type"
+    )]
+    [InlineData(
+        "maint.cat-preventive/act.type-",
+        "MetaActivityType",
+        "Invalid ActivityType metadata tag: missing value"
+    )]
+    [InlineData("funct.svc-", "MetaFunctionalServices", "Invalid FunctionalServices metadata tag: missing value")]
+    [InlineData(
+        "funct.svc-abc/maint.cat-preventive",
+        "MetaFunctionalServices",
+        "Invalid FunctionalServices metadata tag: 'abc'. Use prefix '~' for custom values"
+    )]
+    public void Test_Pms_Tag_Errors(string metadata, string expectedType, string expectedMessage)
+    {
+        var pmsLocalIdStr = "/dnv-v2-experimental/vis-3-6a/411.1/C101.64/S201/meta/" + metadata;
+
+        Assert.False(PMSLocalIdBuilder.TryParse(pmsLocalIdStr, out var errors, out _));
+        var error = Assert.Single(errors);
+        Assert.Equal(expectedType, error.Type);
+        Assert.Equal(expectedMessage, error.Message);
+    }
+
+    [Theory]
+    [InlineData("MetaFunctionalServices", "Invalid metadata tag: Functional services")]
+    [InlineData("MetaMaintenanceCategory", "Invalid metadata tag: Maintenance category")]
+    [InlineData("MetaActivityType", "Invalid metadata tag: Activity type")]
+    public void Test_Pms_Tag_Predefined_Errors(string state, string expectedMessage)
+    {
+        var parsingState = Enum.Parse<LocalIdParsingState>(state);
+        var errors = LocalIdParsingErrorBuilder.Create().AddError(parsingState, null).Build();
+
+        var error = Assert.Single(errors);
+        Assert.Equal(state, error.Type);
+        Assert.Equal(expectedMessage, error.Message);
+    }
+
+    [Fact]
+    public void Test_Pms_Tags_Are_Not_LocalId_Tags()
+    {
+        var localIdStr = "/dnv-v2/vis-3-6a/411.1/C101.64/S201/meta/maint.cat-preventive/act.type-check";
+
+        Assert.False(LocalIdBuilder.TryParse(localIdStr, out var errors, out _));
+        Assert.Equal("Invalid metadata tag: unknown prefix maint.cat", errors.First().Message);
+    }
 }
@@ -31,6 +31,39 @@ public void Test_GmodPath_Parse_Invalid(GmodPathTestItem item)
         Assert.Null(path);
     }
 
+    [Fact]
+    public void Test_GmodPath_ParsePaths()
+    {
+        var items = VistaSDKTestData
+            .AddValidGmodPathsData()
+            .Concat(VistaSDKTestData.AddInvalidGmodPathsData())
+            .Select(data => (GmodPathTestItem)data[0]);
+
+        foreach (var group in items.GroupBy(item => VisVersions.Parse(item.VisVersion)))
+        {
+            var gmod = VIS.Instance.GetGmod(group.Key);
+            var locations = VIS.Instance.GetLocations(group.Key);
+            var inputPaths = group.Select(item => item.Path).ToArray();
+
+            var paths = new GmodPath?[inputPaths.Length];
+            var parsed = GmodPath.TryParsePaths(inputPaths, gmod, locations, paths);
+
+            var expectedParsed = 0;
+            for (var i = 0; i < inputPaths.Length; i++)
+            {
+                if (GmodPath.TryParse(inputPaths[i], gmod, locations, out var expected))
+                    expectedParsed++;
+                Assert.Equal(expected, paths[i]);
+            }
+            Assert.Equal(expectedParsed, parsed);
+
+            var validPaths = inputPaths.Where((_, i) => paths[i] is not null).ToArray();
+            Assert.Equal(paths.Where(p => p is not null), gmod.ParsePaths(validPaths));
+            if (validPaths.Length != inputPaths.Length)
+                Assert.Throws<ArgumentException>(() => GmodPath.ParsePaths(inputPaths, gmod, locations));
+        }
+    }
+
     [Fact]
     public void Test_GetFullPath()
     {
@@ -212,6 +245,69 @@ public void Test_GmodPath_Does_Not_Individualize()
         Assert.Null(path);
     }
 
+    [Fact]
+    public void Test_GmodPath_Equality()
+    {
+        var version = VisVersion.v3_4a;
+        var gmod = VIS.Instance.GetGmod(version);
+        var locations = VIS.Instance.GetLocations(version);
+        var otherGmod = new Gmod(version, VIS.LoadGmodDto(version)!);
+
+        var path = GmodPath.Parse("612.21-1/C701.13/S93", gmod, locations);
+        var otherPath = GmodPath.Parse("612.21-1/C701.13/S93", otherGmod, locations);
+        Assert.Equal(path, otherPath);
+        Assert.Equal(path.GetHashCode(), otherPath.GetHashCode());
+        Assert.Equal(path, new GmodPath(path.Parents.ToList(), path.Node));
+
+        var withoutLocations = path.WithoutLocations();
+        Assert.NotEqual(path, withoutLocations);
+        Assert.Equal(GmodPath.Parse("612.21/C701.13/S93", gmod, locations), withoutLocations);
+        Assert.Same(withoutLocations, withoutLocations.WithoutLocations());
+        Assert.All(withoutLocations.GetFullPath(), n => Assert.Null(n.Node.Location));
+
+        var set = path.IndividualizableSets.First(s => s.Location is not null);
+        set.Location = locations.Parse("2");
+        var individualized = set.Build();
+        Assert.Equal("612.21-2/C701.13/S93", individualized.ToString());
+        Assert.Equal("612.21-1/C701.13/S93", path.ToString());
+
+        var dictionary = new Dictionary<GmodPath, int> { [path] = 1, [individualized] = 2 };
+        Assert.Equal(1, dictionary[otherPath]);
+        Assert.Equal(2, dictionary[GmodPath.Parse("612.21-2/C701.13/S93", gmod, locations)]);
+    }
+
+    [Fact]
+    public void Test_IndividualizableSets_Cached()
+    {
+        var version = VisVersion.v3_4a;
+        var gmod = VIS.Instance.GetGmod(version);
+        var locations = VIS.Instance.GetLocations(version);
+        var path = GmodPath.Parse("411.1/C101.663i/C663.5/CS6d", gmod, locations);
+
+        var sets = path.IndividualizableSets;
+        var again = path.IndividualizableSets;
+        Assert.Equal(sets.Count, again.Count);
+        Assert.True(path.IsIndividualizable);
+        for (var i = 0; i < sets.Count; i++)
+        {
+            Assert.NotSame(sets[i], again[i]);
+            Assert.Equal(sets[i].NodeIndices, again[i].NodeIndices);
+        }
+
+        var location = locations.Parse("FIPU");
+        sets[sets.Count - 1].Location = location;
+        var individualized = sets[sets.Count - 1].Build();
+        Assert.Null(again[again.Count - 1].Location);
+
+        var expected = GmodPath.Parse(individualized.ToString(), gmod, locations);
+        Assert.Equal(expected, individualized);
+        Assert.Equal(
+            expected.IndividualizableSets.Select(s => $"{string.Join(",", s.NodeIndices)}-{s.Location}"),
+            individualized.IndividualizableSets.Select(s => $"{string.Join(",", s.NodeIndices)}-{s.Location}")
+        );
+        Assert.Equal(location, individualized.IndividualizableSets[sets.Count - 1].Location);
+    }
+
     [Fact]
     public void Test_ToFullPathString()
     {
@@ -1,3 +1,5 @@
+using Vista.SDK.Internal;
+
 namespace Vista.SDK.Tests;
 
 public class GmodTests
@@ -161,6 +163,124 @@ public void Test_Gmod_Lookup(VisVersion visVersion)
         Assert.False(gmod.TryGetNode("ag✅", out _));
     }
 
+    [Theory]
+    [MemberData(nameof(Test_Vis_Versions))]
+    public void Test_Gmod_Snapshot(VisVersion visVersion)
+    {
+        var gmodDto = VIS.Instance.GetGmodDto(visVersion);
+
+        var path = Path.Combine(Path.GetTempPath(), $"vista-sdk-{Guid.NewGuid():N}{GmodSnapshot.FileExtension}");
+        try
+        {
+            using (var file = File.Create(path))
+                GmodSnapshot.Create(gmodDto).WriteTo(file);
+
+            var expected = new Gmod(visVersion, gmodDto);
+            using var store = GmodStore.Open(path);
+
+            Assert.Equal(gmodDto.VisVersion, store.VisVersion);
+            Assert.True(store.HasUsableLookupTable);
+
+            AssertEquivalent(expected, new Gmod(visVersion, store));
+            AssertEquivalent(expected, new Gmod(visVersion, store, mapped: true));
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+
+        static void AssertEquivalent(Gmod expected, Gmod actual)
+        {
+            Assert.Equal(expected.Select(n => n.Code).ToArray(), actual.Select(n => n.Code).ToArray());
+            foreach (var expectedNode in expected)
+            {
+                Assert.True(actual.TryGetNode(expectedNode.Code, out var node));
+                Assert.Same(node, actual[expectedNode.Code]);
+                Assert.Equal(expectedNode.Metadata.Category, node.Metadata.Category);
+                Assert.Equal(expectedNode.Metadata.Type, node.Metadata.Type);
+                Assert.Equal(expectedNode.Metadata.Name, node.Metadata.Name);
+                Assert.Equal(expectedNode.Metadata.CommonName, node.Metadata.CommonName);
+                Assert.Equal(expectedNode.Metadata.Definition, node.Metadata.Definition);
+                Assert.Equal(expectedNode.Metadata.CommonDefinition, node.Metadata.CommonDefinition);
+                Assert.Equal(expectedNode.Metadata.InstallSubstructure, node.Metadata.InstallSubstructure);
+                Assert.Equal(expectedNode.Metadata.NormalAssignmentNames, node.Metadata.NormalAssignmentNames);
+                Assert.Equal(expectedNode.Children.Select(c => c.Code), node.Children.Select(c => c.Code));
+                Assert.Equal(expectedNode.Parents.Select(c => c.Code), node.Parents.Select(c => c.Code));
+                foreach (var child in expectedNode.Children)
+                    Assert.True(node.IsChild(child.Code));
+            }
+
+            Assert.Equal("VE", actual.RootNode.Code);
+            Assert.False(actual.TryGetNode("ABC", out _));
+            Assert.False(actual.TryGetNode("ac✅bc", out _));
+            Assert.False(actual.RootNode.IsChild("ABC"));
+            Assert.Throws<KeyNotFoundException>(() => actual["ABC"]);
+        }
+    }
+
+    [Fact]
+    public void Test_Gmod_Snapshot_Corrupt()
+    {
+        using var stream = new MemoryStream();
+        GmodSnapshot.Create(VIS.Instance.GetGmodDto(VisVersion.v3_4a)).WriteTo(stream);
+        var snapshot = stream.ToArray();
+
+        var nodeCount = BitConverter.ToInt32(snapshot, 16);
+        var childIndices = BitConverter.ToInt32(snapshot, 52);
+
+        // Truncated, a section outside the snapshot and a child index outside the nodes
+        AssertInvalid(snapshot.AsSpan(0, snapshot.Length / 2).ToArray());
+        AssertInvalid(With(snapshot, 52, snapshot.Length));
+        AssertInvalid(With(snapshot, childIndices, nodeCount));
+
+        static byte[] With(byte[] snapshot, int offset, int value)
+        {
+            var corrupt = snapshot.ToArray();
+            BitConverter.GetBytes(value).CopyTo(corrupt, offset);
+            return corrupt;
+        }
+
+        static void AssertInvalid(byte[] snapshot)
+        {
+            var path = Path.Combine(Path.GetTempPath(), $"vista-sdk-{Guid.NewGuid():N}{GmodSnapshot.FileExtension}");
+            try
+            {
+                File.WriteAllBytes(path, snapshot);
+                Assert.Throws<InvalidDataException>(() => GmodStore.Open(path).Dispose());
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+    }
+
+    [Fact]
+    public void Test_Gmod_Memory_Mapped()
+    {
+        var directory = Path.Combine(Path.GetTempPath(), $"vista-sdk-{Guid.NewGuid():N}");
+        try
+        {
+            var vis = new VIS();
+            vis.UseMemoryMappedGmods(directory);
+
+            var gmod = vis.GetGmod(VisVersion.v3_4a);
+            Assert.Single(Directory.GetFiles(directory));
+
+            var path = GmodPath.Parse("411.1/C101.31-2", gmod, vis.GetLocations(VisVersion.v3_4a));
+            Assert.Equal("411.1/C101.31-2", path.ToString());
+            Assert.Equal(gmod["411.1"], path.Parents.Single(n => n.Code == "411.1"));
+
+            var node = gmod["411.1"];
+            Assert.Same(node, node.Parents[0].Children.Single(n => n.Code == "411.1"));
+            Assert.Equal(VIS.Instance.GetGmod(VisVersion.v3_4a).Count(), gmod.Count());
+        }
+        finally
+        {
+            Directory.Delete(directory, recursive: true);
+        }
+    }
+
     [Fact]
     public void Test_Gmod_Node_Equality()
     {
@@ -184,6 +304,28 @@ public void Test_Gmod_Node_Equality()
         Assert.NotSame(node1, node4);
     }
 
+    [Fact]
+    public void Test_Gmod_Located_Nodes()
+    {
+        var (_, vis) = VISTests.GetVis();
+        var gmod = vis.GetGmod(VisVersion.v3_4a);
+        var locations = vis.GetLocations(VisVersion.v3_4a);
+
+        // More locations than the cache holds, so some of them collide
+        var paths = Enumerable
+            .Range(1, 5000)
+            .Select(i => GmodPath.Parse($"411.1/C101.31-{i}", gmod, locations))
+            .ToList();
+        for (var i = 0; i < paths.Count; i++)
+        {
+            Assert.Equal($"{i + 1}", paths[i].Node.Location.ToString());
+            Assert.Equal(GmodPath.Parse($"411.1/C101.31-{i + 1}", gmod, locations), paths[i]);
+        }
+
+        var path = GmodPath.Parse("411.1/C101.31-2", gmod, locations);
+        Assert.Same(path.Node, GmodPath.Parse("411.1/C101.31-2", gmod, locations).Node);
+    }
+
     [Fact]
     public void Test_Gmod_Node_Types()
     {
@@ -198,6 +340,36 @@ public void Test_Gmod_Node_Types()
         Assert.NotEmpty(set);
     }
 
+    [Theory]
+    [MemberData(nameof(Test_Vis_Versions))]
+    public void Test_Gmod_Graph_Matches_Metadata(VisVersion visVersion)
+    {
+        var gmod = VIS.Instance.GetGmod(visVersion);
+
+        foreach (var node in gmod)
+        {
+            var metadata = node.Metadata;
+            Assert.Equal(Gmod.IsLeafNode(metadata), node.IsLeafNode);
+            Assert.Equal(Gmod.IsFunctionNode(metadata), node.IsFunctionNode);
+            Assert.Equal(Gmod.IsAssetFunctionNode(metadata), node.IsAssetFunctionNode);
+            Assert.Equal(Gmod.IsProductSelection(metadata), node.IsProductSelection);
+            Assert.Equal(Gmod.IsProductType(metadata), node.IsProductType);
+            Assert.Equal(Gmod.IsAsset(metadata), node.IsAsset);
+            Assert.Equal(Gmod.IsPotentialParent(metadata.Type), node.IsPotentialParent);
+
+            var graph = gmod.Graph;
+            foreach (var child in node.Children)
+            {
+                Assert.True(node.IsChild(child));
+                Assert.Contains(node.Code, child.Parents.Select(p => p.Code));
+                Assert.Equal(
+                    Gmod.IsProductSelectionAssignment(node, child),
+                    graph.IsProductSelectionAssignment(node._handle, child._handle)
+                );
+            }
+        }
+    }
+
     [Theory]
     [MemberData(nameof(Test_Vis_Versions))]
     public void Test_Gmod_RootNode_Children(VisVersion visVersion)
@@ -394,6 +566,66 @@ public void Test_Full_Traversal_From()
         Assert.True(completed);
     }
 
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Test_Parallel_Traversal(bool skipLeafs)
+    {
+        var gmod = VIS.Instance.GetGmod(VIS.LatestVisVersion);
+
+        TraversalHandlerResult Visit(TraversalCounts counts, IReadOnlyList<GmodNode> parents, GmodNode node)
+        {
+            Assert.True(parents.Count == 0 || parents[0].IsRoot);
+            counts.Nodes++;
+            counts.Depth += parents.Count;
+            if (node.Code == "C101")
+                counts.Paths.Add(new GmodPath(parents.ToList(), node).ToString());
+            return skipLeafs && node.IsLeafNode ? TraversalHandlerResult.SkipSubtree : TraversalHandlerResult.Continue;
+        }
+
+        var expected = new TraversalCounts();
+        Assert.True(gmod.Traverse(expected, Visit));
+
+        var completed = gmod.TraverseParallel(
+            () => new TraversalCounts(),
+            Visit,
+            out var states,
+            new ParallelTraversalOptions { MaxDegreeOfParallelism = 4 }
+        );
+
+        Assert.True(completed);
+        Assert.NotEmpty(states);
+        Assert.Equal(expected.Nodes, states.Sum(s => s.Nodes));
+        Assert.Equal(expected.Depth, states.Sum(s => s.Depth));
+        Assert.Equal(expected.Paths.OrderBy(p => p), states.SelectMany(s => s.Paths).OrderBy(p => p));
+    }
+
+    [Fact]
+    public void Test_Parallel_Traversal_Stop()
+    {
+        var gmod = VIS.Instance.GetGmod(VIS.LatestVisVersion);
+
+        var completed = gmod.TraverseParallel(
+            () => new TraversalCounts(),
+            (counts, parents, node) =>
+            {
+                counts.Nodes++;
+                return node.Code == "C101" ? TraversalHandlerResult.Stop : TraversalHandlerResult.Continue;
+            },
+            out var states
+        );
+
+        Assert.False(completed);
+        Assert.NotEmpty(states);
+    }
+
+    private sealed class TraversalCounts
+    {
+        public long Nodes;
+        public long Depth;
+        public List<string> Paths { get; } = new();
+    }
+
     private sealed record TraversalState(int StopAfter)
     {
         public int NodeCount { get; set; }
@@ -266,6 +266,70 @@ VisVersion targetVersion
         Assert.Equal(expectedPath, convertedPath);
     }
 
+    [Fact]
+    public void Test_ConvertNode_MultiHop_Matches_Stepwise()
+    {
+        var (_, vis) = VISTests.GetVis();
+        var sourceVersion = VisVersion.v3_4a;
+        var gmod = vis.GetGmod(sourceVersion);
+
+        var location = vis.GetLocations(sourceVersion).Parse("1");
+
+        // Located nodes too, step by step conversion checks the location at each intermediate version
+        foreach (var node in gmod.SelectMany(n => new[] { n, n.WithLocation(location) }))
+        {
+            GmodNode? expected = node;
+            for (var version = sourceVersion; version < VIS.LatestVisVersion && expected is not null; version++)
+                expected = vis.ConvertNode(version, expected, version + 1);
+
+            var actual = vis.ConvertNode(sourceVersion, node, VIS.LatestVisVersion);
+            Assert.Equal(expected, actual);
+            Assert.Equal(expected?.Location, actual?.Location);
+            if (actual is not null)
+                Assert.Equal(VIS.LatestVisVersion, actual.VisVersion);
+        }
+    }
+
+    [Fact]
+    public void Test_ConvertPaths_Bulk()
+    {
+        var vis = VIS.Instance;
+        var sourcePaths = VistaSDKTestData
+            .AddValidGmodPathsData()
+            .Select(x => (GmodPathTestItem)x[0])
+            .Select(x => GmodPath.Parse(x.Path, VisVersions.Parse(x.VisVersion)))
+            .Where(x => x.VisVersion < VIS.LatestVisVersion)
+            .ToList();
+        Assert.NotEmpty(sourcePaths);
+        // Repeat the paths so that the bulk conversion hits its memoized results
+        sourcePaths.AddRange(sourcePaths.ToArray());
+
+        var converted = vis.ConvertPaths(sourcePaths, VIS.LatestVisVersion);
+        Assert.Equal(sourcePaths.Count, converted.Count);
+        for (var i = 0; i < sourcePaths.Count; i++)
+            Assert.Equal(vis.ConvertPath(sourcePaths[i], VIS.LatestVisVersion), converted[i]);
+    }
+
+    [Fact]
+    public void Test_ConvertLocalIds_Bulk()
+    {
+        var vis = VIS.Instance;
+        var sourceLocalIds = new[]
+        {
+            "/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet",
+            "/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-outlet",
+            "/dnv-v2/vis-3-4a/411.1/C101.64i-1/S201.1/C151.2/S110/meta/cnt-hydraulic.oil/state-running",
+            "/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet",
+        }
+            .Select(LocalId.Parse)
+            .ToList();
+
+        var converted = vis.ConvertLocalIds(sourceLocalIds, VisVersion.v3_9a);
+        Assert.Equal(sourceLocalIds.Count, converted.Count);
+        for (var i = 0; i < sourceLocalIds.Count; i++)
+            Assert.Equal(vis.ConvertLocalId(sourceLocalIds[i], VisVersion.v3_9a), converted[i]);
+    }
+
     [Fact(Skip = "3-8 S204 is not in 3-8a")]
     public void ConvertEveryNodeToLatest()
     {
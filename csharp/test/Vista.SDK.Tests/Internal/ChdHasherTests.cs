@@ -0,0 +1,79 @@
+using Vista.SDK.Internal;
+
+namespace Vista.SDK.Tests.Internal;
+
+public class ChdHasherTests
+{
+    private static string RandomKey(Random random, int length)
+    {
+        var chars = new char[length];
+        for (var i = 0; i < length; i++)
+            chars[i] = (char)random.Next(32, 127);
+        return new string(chars);
+    }
+
+    [Fact]
+    public void Test_String_Hasher_Vectorized_Matches_Scalar()
+    {
+        var random = new Random(1234);
+        for (var length = 0; length <= 300; length++)
+        {
+            for (var i = 0; i < 8; i++)
+            {
+                var key = RandomKey(random, length);
+                Assert.Equal(ChdStringHasher.HashScalar(key.AsSpan()), default(ChdStringHasher).Hash(key.AsSpan()));
+            }
+        }
+    }
+
+    [Fact]
+    public void Test_String_Hasher_Short_Keys()
+    {
+        foreach (var key in new[] { "400", "H346.11112", "411.1", "C101.31" })
+            Assert.Equal(default(ChdCodeHasher).Hash(key.AsSpan()), default(ChdStringHasher).Hash(key.AsSpan()));
+    }
+
+    [Fact]
+    public void Test_String_Hasher_Uses_Every_Bit()
+    {
+        var key = "/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet";
+        var hash = default(ChdStringHasher).Hash(key.AsSpan());
+
+        for (var i = 0; i < key.Length; i++)
+        {
+            var chars = key.ToCharArray();
+            chars[i] = (char)(chars[i] | 0x100);
+            Assert.NotEqual(hash, default(ChdStringHasher).Hash(chars));
+        }
+    }
+
+    [Fact]
+    public void Test_String_Hasher_Long_Keys_Distinct()
+    {
+        var keys = new HashSet<string>();
+        for (var i = 0; i < 10_000; i++)
+            keys.Add($"/dnv-v2/vis-3-4a/411.1/C101.31-{i % 7}/meta/qty-temperature/cnt-exhaust.gas/detail-{i}");
+
+        var hashes = new HashSet<uint>(keys.Select(k => default(ChdStringHasher).Hash(k.AsSpan())));
+        Assert.Equal(keys.Count, hashes.Count);
+    }
+
+    [Fact]
+    public void Test_Dictionary_With_String_Hasher()
+    {
+        var random = new Random(42);
+        var keys = Enumerable
+            .Range(0, 2000)
+            .Select(i => $"{i}-{RandomKey(random, random.Next(0, 200))}")
+            .ToArray();
+        var dictionary = new ChdDictionary<int, ChdStringHasher>(keys.Select((k, i) => (k, i)).ToArray());
+
+        for (var i = 0; i < keys.Length; i++)
+        {
+            Assert.True(dictionary.TryGetValue($"[{keys[i]}]".AsSpan(1, keys[i].Length), out var value));
+            Assert.Equal(i, value);
+        }
+        Assert.False(dictionary.TryGetValue("not-a-key-but-long-enough-to-be-hashed-as-one".AsSpan(), out _));
+        Assert.False(dictionary.TryGetValue(ReadOnlySpan<char>.Empty, out _));
+    }
+}
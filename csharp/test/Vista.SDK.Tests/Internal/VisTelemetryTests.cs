@@ -0,0 +1,132 @@
+using System.Collections.Concurrent;
+using System.Diagnostics;
+using System.Diagnostics.Metrics;
+
+namespace Vista.SDK.Tests.Internal;
+
+public class VisTelemetryTests
+{
+    // Measurements are recorded on the thread that made them, which tells them apart from those of parallel tests
+    private sealed record Measurement(string Instrument, double Value, Dictionary<string, object?> Tags, int ThreadId);
+
+    private static MeterListener Listen(ConcurrentQueue<Measurement> measurements)
+    {
+        var listener = new MeterListener();
+        listener.InstrumentPublished = (instrument, l) =>
+        {
+            if (instrument.Meter.Name == VisDiagnostics.MeterName)
+                l.EnableMeasurementEvents(instrument);
+        };
+        listener.SetMeasurementEventCallback<long>(
+            (instrument, value, tags, _) => measurements.Enqueue(
+                new(instrument.Name, value, ToDictionary(tags), Environment.CurrentManagedThreadId)
+            )
+        );
+        listener.SetMeasurementEventCallback<double>(
+            (instrument, value, tags, _) => measurements.Enqueue(
+                new(instrument.Name, value, ToDictionary(tags), Environment.CurrentManagedThreadId)
+            )
+        );
+        listener.Start();
+        return listener;
+    }
+
+    private static Dictionary<string, object?> ToDictionary(ReadOnlySpan<KeyValuePair<string, object?>> tags)
+    {
+        var dictionary = new Dictionary<string, object?>();
+        foreach (var tag in tags)
+            dictionary[tag.Key] = tag.Value;
+        return dictionary;
+    }
+
+    private static bool Has(
+        ConcurrentQueue<Measurement> measurements,
+        string instrument,
+        params (string Key, string Value)[] tags
+    ) =>
+        measurements.Any(m =>
+            m.Instrument == instrument && tags.All(t => m.Tags.TryGetValue(t.Key, out var v) && (string?)v == t.Value)
+        );
+
+    [Fact]
+    public void Test_Parse_Measurements()
+    {
+        var measurements = new ConcurrentQueue<Measurement>();
+        using var listener = Listen(measurements);
+
+        Assert.True(LocalIdBuilder.TryParse("/dnv-v2/vis-3-4a/411.1/C101.31/meta/qty-temperature", out _));
+        Assert.False(LocalIdBuilder.TryParse("/dnv-v2/vis-3-4a/invalid", out _));
+        Assert.True(GmodPath.TryParse("411.1/C101.31-2", VisVersion.v3_4a, out _));
+        Assert.False(GmodPath.TryParseFullPath("411.1/C101.31", VisVersion.v3_4a, out _));
+
+        Assert.True(Has(measurements, "vista.local_id.parses", ("result", "success")));
+        Assert.True(Has(measurements, "vista.local_id.parses", ("result", "failure")));
+        Assert.True(Has(measurements, "vista.gmod_path.parses", ("format", "short"), ("result", "success")));
+        Assert.True(Has(measurements, "vista.gmod_path.parses", ("format", "full"), ("result", "failure")));
+    }
+
+    [Fact]
+    public void Test_Cached_Parse_Measurements()
+    {
+        var measurements = new ConcurrentQueue<Measurement>();
+        using var listener = Listen(measurements);
+
+        var thread = Environment.CurrentManagedThreadId;
+        var localIdStr = "/dnv-v2/vis-3-4a/411.1/C101.31-5/meta/qty-temperature/pos-inlet";
+        Assert.True(LocalId.TryParse(localIdStr.AsSpan(), out _));
+        Assert.True(LocalId.TryParse(localIdStr.AsSpan(), out _, out _));
+
+        Assert.Equal(2, measurements.Count(m => m.ThreadId == thread && m.Instrument == "vista.local_id.parses"));
+        Assert.True(
+            measurements.Any(m =>
+                m.ThreadId == thread
+                && m.Instrument == "vista.local_id.intern.lookups"
+                && (string?)m.Tags["result"] == "hit"
+            )
+        );
+    }
+
+    [Fact]
+    public void Test_Intern_Measurements()
+    {
+        var measurements = new ConcurrentQueue<Measurement>();
+        using var listener = Listen(measurements);
+
+        var table = new LocalIdInternTable(16);
+        var localIdStr = "/dnv-v2/vis-3-4a/411.1/C101.31/meta/qty-temperature";
+        Assert.False(table.TryGet(localIdStr.AsSpan(), out _));
+        table.Add(localIdStr, LocalId.Parse(localIdStr));
+        Assert.True(table.TryGet(localIdStr.AsSpan(), out _));
+
+        Assert.True(Has(measurements, "vista.local_id.intern.lookups", ("result", "miss")));
+        Assert.True(Has(measurements, "vista.local_id.intern.lookups", ("result", "hit")));
+    }
+
+    [Fact]
+    public void Test_Model_Load_Measurements()
+    {
+        var measurements = new ConcurrentQueue<Measurement>();
+        var activities = new ConcurrentQueue<Activity>();
+        using var listener = Listen(measurements);
+        using var activityListener = new ActivityListener
+        {
+            ShouldListenTo = source => source.Name == VisDiagnostics.ActivitySourceName,
+            Sample = (ref ActivityCreationOptions<ActivityContext> _) => ActivitySamplingResult.AllData,
+            ActivityStopped = activities.Enqueue,
+        };
+        ActivitySource.AddActivityListener(activityListener);
+
+        var vis = new VIS();
+        var gmod = vis.GetGmod(VisVersion.v3_4a);
+        Assert.Same(gmod, vis.GetGmod(VisVersion.v3_4a));
+        Assert.NotNull(vis.ConvertNode(VisVersion.v3_4a, gmod["411.1"], VisVersion.v3_5a));
+
+        Assert.True(Has(measurements, "vista.model.load.duration", ("model", "gmod"), ("vis_version", "3-4a")));
+        Assert.True(Has(measurements, "vista.vis.cache.lookups", ("model", "gmod"), ("result", "miss")));
+        Assert.True(Has(measurements, "vista.vis.cache.lookups", ("model", "gmod"), ("result", "hit")));
+        Assert.True(Has(measurements, "vista.versioning.conversions", ("kind", "node"), ("result", "success")));
+        Assert.True(
+            activities.Any(a => a.OperationName == "vista.model.load" && (string?)a.GetTagItem("vis_version") == "3-4a")
+        );
+    }
+}
@@ -1,4 +1,5 @@
 using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
 
 namespace Vista.SDK.Tests;
 
@@ -339,6 +340,219 @@ public async void Test_DataChannelList_Filter(string file, params int[] queryMat
         }
     }
 
+    [Theory]
+    [InlineData("schemas/json/DataChannelList.sample.json", 3, 7, 3, 1, 4)]
+    public async void Test_DataChannelList_Index(string file, params int[] queryMatches)
+    {
+        var gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
+        var locations = VIS.Instance.GetLocations(VisVersion.v3_4a);
+        var codebooks = VIS.Instance.GetCodebooks(VisVersion.v3_4a);
+
+        var pPath = gmod.ParsePath("621.11i/H135");
+        var sPath = gmod.ParsePath("1036.13i-1/C662.1/C661");
+        var tag = codebooks.CreateTag(CodebookName.Content, "heavy.fuel.oil");
+        var location = locations.Parse("P");
+
+        await using var reader = new FileStream(file, FileMode.Open, FileAccess.Read, FileShare.Read);
+
+        var package = await Serializer.DeserializeDataChannelListAsync(reader);
+        Assert.NotNull(package);
+        var dataChannelList = package.ToDomainModel().DataChannelList;
+
+        LocalIdQuery[] queries =
+        [
+            LocalIdQueryBuilder.Empty().WithTags(MetadataTagsQueryBuilder.Empty().WithTag(tag).Build()).Build(),
+            LocalIdQueryBuilder.Empty().WithPrimaryItem(pPath, builder => builder.WithoutLocations().Build()).Build(),
+            LocalIdQueryBuilder
+                .Empty()
+                .WithPrimaryItem(pPath, builder => builder.WithNode(nodes => nodes["621.11i"], [location]).Build())
+                .Build(),
+            LocalIdQueryBuilder.Empty().WithSecondaryItem(sPath).Build(),
+            LocalIdQueryBuilder
+                .Empty()
+                .WithSecondaryItem(sPath, builder => builder.WithNode(nodes => nodes["1036.13i"], true).Build())
+                .Build(),
+        ];
+        Assert.Equal(queryMatches.Length, queries.Length);
+
+        var index = dataChannelList.CreateIndex();
+        var results = index.Match(LocalIdQueryMatcher.Compile(queries));
+        for (var i = 0; i < queries.Length; i++)
+        {
+            var expected = dataChannelList.Where(dc => queries[i].Match(dc.DataChannelId.LocalId)).ToArray();
+            Assert.Equal(queryMatches[i], expected.Length);
+            Assert.Equal(expected, index.Match(queries[i]));
+            Assert.Equal(expected, results[i]);
+        }
+    }
+
+    [Fact]
+    public async void Test_Compiled_Queries_Consistency()
+    {
+        var localIds = new List<LocalId>();
+        await using (var file = File.OpenRead("testdata/LocalIds.txt"))
+        {
+            using var reader = new StreamReader(file, leaveOpen: true);
+            string? localIdStr;
+            var line = 0;
+            while ((localIdStr = await reader.ReadLineAsync()) is not null)
+            {
+                if (line++ % 40 == 0 && localIdStr.StartsWith("/dnv-v2/vis-3-4a/"))
+                    localIds.Add(LocalId.Parse(localIdStr));
+            }
+        }
+        localIds = localIds.Distinct().ToList();
+
+        var queries = new List<LocalIdQuery>();
+        for (var i = 0; i < localIds.Count; i += 12)
+        {
+            var localId = localIds[i];
+            queries.Add(LocalIdQueryBuilder.From(localId).Build());
+            queries.Add(
+                LocalIdQueryBuilder.From(localId).WithPrimaryItem(p => p.WithoutLocations().Build()).Build()
+            );
+            queries.Add(
+                LocalIdQueryBuilder
+                    .Empty()
+                    .WithPrimaryItem(GmodPathQueryBuilder.Empty().WithNode(localId.PrimaryItem.Node, true).Build())
+                    .Build()
+            );
+            if (localId.MetadataTags.Count > 0)
+            {
+                queries.Add(
+                    LocalIdQueryBuilder
+                        .Empty()
+                        .WithTags(MetadataTagsQueryBuilder.Empty().WithTag(localId.MetadataTags[0]).Build())
+                        .WithoutSecondaryItem()
+                        .Build()
+                );
+            }
+        }
+        queries.Add(LocalIdQueryBuilder.Empty().Build());
+
+        var matcher = LocalIdQueryMatcher.Compile(queries);
+        foreach (var localId in localIds)
+        {
+            var expected = Enumerable.Range(0, queries.Count).Where(i => queries[i].Match(localId)).ToArray();
+            Assert.Equal(expected, matcher.Match(localId));
+            Assert.Equal(expected.Length > 0, matcher.MatchAny(localId));
+        }
+
+        await using var sample = File.OpenRead("schemas/json/DataChannelList.sample.json");
+        var package = await Serializer.DeserializeDataChannelListAsync(sample);
+        var template = package!.ToDomainModel().DataChannelList[0];
+        var dataChannelList = new Vista.SDK.Transport.DataChannel.DataChannelList(
+            localIds
+                .Select(
+                    (localId, i) =>
+                        template with
+                        {
+                            DataChannelId = template.DataChannelId with { LocalId = localId, ShortId = $"{i}" }
+                        }
+                )
+                .ToArray()
+        );
+        var index = dataChannelList.CreateIndex();
+        var results = index.Match(matcher);
+        for (var i = 0; i < queries.Count; i++)
+        {
+            var expected = dataChannelList.Where(dc => queries[i].Match(dc.DataChannelId.LocalId)).ToArray();
+            Assert.Equal(expected, results[i]);
+        }
+    }
+
+    [Fact]
+    public async void Test_DataChannelList_Index_Update()
+    {
+        var gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
+        var codebooks = VIS.Instance.GetCodebooks(VisVersion.v3_4a);
+
+        await using var reader = File.OpenRead("schemas/json/DataChannelList.sample.json");
+        var package = (await Serializer.DeserializeDataChannelListAsync(reader))!;
+        var dataChannelList = package.ToDomainModel().DataChannelList;
+        var index = dataChannelList.CreateIndex();
+
+        // A new configuration from the same package, with some data channels removed, modified and added
+        var target = package.ToDomainModel().DataChannelList;
+        var template = target[0];
+        for (var i = target.Count - 1; i >= 0; i -= 3)
+            target.Remove(target[i]);
+        for (var i = 0; i < target.Count; i += 4)
+        {
+            var dataChannel = target[i];
+            target.Remove(dataChannel);
+            target.Add(dataChannel with { Property = dataChannel.Property with { Remarks = "Modified" } });
+        }
+        target.Add(
+            File.ReadLines("testdata/LocalIds.txt")
+                .Where(l => l.StartsWith("/dnv-v2/vis-3-4a/"))
+                .Take(50)
+                .Select(l => LocalId.Parse(l))
+                .Distinct()
+                .Where(l => !target.TryGetByLocalId(l, out _))
+                .Select(
+                    (localId, i) =>
+                        template with
+                        {
+                            DataChannelId = template.DataChannelId with { LocalId = localId, ShortId = $"added-{i}" }
+                        }
+                )
+                .ToArray()
+        );
+
+        var diff = Vista.SDK.Transport.DataChannel.DataChannelListDiff.Compute(dataChannelList, target);
+        Assert.NotEmpty(diff.Added);
+        Assert.NotEmpty(diff.Removed);
+        Assert.NotEmpty(diff.Modified);
+
+        LocalIdQuery[] queries =
+        [
+            LocalIdQueryBuilder
+                .Empty()
+                .WithTags(
+                    MetadataTagsQueryBuilder
+                        .Empty()
+                        .WithTag(codebooks.CreateTag(CodebookName.Content, "heavy.fuel.oil"))
+                        .Build()
+                )
+                .Build(),
+            LocalIdQueryBuilder
+                .Empty()
+                .WithPrimaryItem(gmod.ParsePath("621.11i/H135"), builder => builder.WithoutLocations().Build())
+                .Build(),
+            LocalIdQueryBuilder.Empty().WithSecondaryItem(gmod.ParsePath("1036.13i-1/C662.1/C661")).Build(),
+            LocalIdQueryBuilder.Empty().WithoutSecondaryItem().Build(),
+            LocalIdQueryBuilder.Empty().Build(),
+        ];
+        var before = queries.Select(q => index.Match(q)).ToArray();
+
+        dataChannelList.Apply(diff);
+        var updated = index.Update(diff);
+        Assert.Equal(dataChannelList.DataChannels, updated.Match(LocalIdQueryBuilder.Empty().Build()));
+        Assert.Equal(dataChannelList.Count, updated.Count);
+
+        var results = updated.Match(LocalIdQueryMatcher.Compile(queries));
+        for (var i = 0; i < queries.Length; i++)
+        {
+            var expected = dataChannelList.Where(dc => queries[i].Match(dc.DataChannelId.LocalId)).ToArray();
+            Assert.Equal(expected, updated.Match(queries[i]));
+            Assert.Equal(expected, results[i]);
+            if (!diff.Affects(queries[i]))
+            {
+                Assert.Equal(
+                    before[i].Select(dc => dc.DataChannelId.LocalId),
+                    expected.Select(dc => dc.DataChannelId.LocalId)
+                );
+            }
+
+            // The previous index is a snapshot
+            Assert.Equal(before[i], index.Match(queries[i]));
+        }
+
+        Assert.Same(updated, updated.Update(Vista.SDK.Transport.DataChannel.DataChannelListDiff.Empty));
+        Assert.Throws<ArgumentException>(() => updated.Update(diff));
+    }
+
     [Fact]
     public void Test_UnspecifiedSecondary()
     {
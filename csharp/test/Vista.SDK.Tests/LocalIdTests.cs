@@ -1,3 +1,5 @@
+using System.Buffers;
+using System.Text;
 using FluentAssertions;
 using Vista.SDK.Experimental;
 using Vista.SDK.Internal;
@@ -278,6 +280,134 @@ public void Test_Parsing(string localIdStr)
         Assert.Equal(localIdStr, localId!.ToString());
     }
 
+    [Theory]
+    [InlineData("/dnv-v2/vis-3-4a/1031/meta/cnt-refrigerant/state-leaking")]
+    [InlineData("/dnv-v2/vis-3-4a/652.31/S90.3/S61/sec/652.1i-1P/meta/cnt-sea.water/state-opened")]
+    [InlineData(
+        "/dnv-v2/vis-3-4a/411.1/C101.63/S206/~propulsion.engine/~cooling.system/meta/qty-temperature/cnt-exhaust.gas/pos-inlet"
+    )]
+    public void Test_Parsing_Span(string localIdStr)
+    {
+        var expected = LocalId.Parse(localIdStr);
+
+        Assert.True(LocalId.TryParse(localIdStr.AsSpan(), out var fromChars));
+        Assert.Equal(expected, fromChars);
+        Assert.Equal(localIdStr, fromChars.ToString());
+
+        Assert.True(LocalId.TryParse(Encoding.UTF8.GetBytes(localIdStr).AsSpan(), out var errors, out var fromUtf8));
+        Assert.False(errors.HasErrors);
+        Assert.Equal(expected, fromUtf8);
+
+        // Repeated IDs are returned from the parse cache
+        Assert.True(LocalId.TryParse(localIdStr.AsSpan(), out var again));
+        Assert.Same(fromChars, again);
+    }
+
+    [Theory]
+    [InlineData("/dnv-v2/vis-3-4a/1031/meta/cnt-refrigerant/state-leaking")]
+    [InlineData("/dnv-v2/vis-3-4a/652.31/S90.3/S61/sec/652.1i-1P/meta/cnt-sea.water/state-opened")]
+    [InlineData(
+        "/dnv-v2/vis-3-4a/411.1/C101.63/S206/~propulsion.engine/~cooling.system/meta/qty-temperature/cnt-exhaust.gas/pos-inlet"
+    )]
+    public void Test_Formatting(string localIdStr)
+    {
+        var localId = LocalId.Parse(localIdStr);
+
+        AssertFormats(localIdStr, localId.TryFormat, localId.TryFormatUtf8, localId.WriteTo);
+        Assert.Same(localId.ToString(), localId.ToString());
+        Assert.Equal(Encoding.UTF8.GetBytes(localIdStr), localId.Utf8Value.ToArray());
+
+        foreach (var path in new[] { localId.PrimaryItem, localId.SecondaryItem }.OfType<GmodPath>())
+        {
+            AssertFormats(path.ToString(), path.TryFormat, path.TryFormatUtf8, path.WriteTo);
+            foreach (var node in path.GetFullPath())
+            {
+                if (node.Node.Location is { } location)
+                    AssertFormats(location.ToString(), location.TryFormat, location.TryFormatUtf8, location.WriteTo);
+            }
+        }
+
+        foreach (var tag in localId.MetadataTags)
+            AssertFormats(tag.ToString(), tag.TryFormat, tag.TryFormatUtf8, tag.WriteTo);
+
+        static void AssertFormats(
+            string expected,
+            TryFormatChars tryFormat,
+            TryFormatBytes tryFormatUtf8,
+            Action<IBufferWriter<byte>> writeTo
+        )
+        {
+            var chars = new char[expected.Length + 4];
+            Assert.True(tryFormat(chars, out var charsWritten, default, null));
+            Assert.Equal(expected, new string(chars, 0, charsWritten));
+            Assert.False(tryFormat(chars.AsSpan(0, expected.Length - 1), out charsWritten, default, null));
+            Assert.Equal(0, charsWritten);
+
+            var expectedBytes = Encoding.UTF8.GetBytes(expected);
+            var bytes = new byte[expectedBytes.Length + 4];
+            Assert.True(tryFormatUtf8(bytes, out var bytesWritten));
+            Assert.Equal(expectedBytes, bytes.AsSpan(0, bytesWritten).ToArray());
+            Assert.False(tryFormatUtf8(bytes.AsSpan(0, expectedBytes.Length - 1), out bytesWritten));
+            Assert.Equal(0, bytesWritten);
+
+            var writer = new ArrayBufferWriter<byte>(1);
+            writeTo(writer);
+            writeTo(writer);
+            Assert.Equal(expectedBytes.Concat(expectedBytes).ToArray(), writer.WrittenSpan.ToArray());
+        }
+    }
+
+    private delegate bool TryFormatChars(
+        Span<char> destination,
+        out int charsWritten,
+        ReadOnlySpan<char> format,
+        IFormatProvider? provider
+    );
+
+    private delegate bool TryFormatBytes(Span<byte> destination, out int bytesWritten);
+
+    [Theory]
+    [MemberData(nameof(VistaSDKTestData.AddInvalidLocalIdsData), MemberType = typeof(VistaSDKTestData))]
+    public void Test_Parsing_Span_Validation(string localIdStr, string[] expectedErrorMessages)
+    {
+        Assert.False(LocalId.TryParse(localIdStr.AsSpan(), out var localId));
+        Assert.Null(localId);
+
+        var parsed = LocalId.TryParse(Encoding.UTF8.GetBytes(localIdStr).AsSpan(), out var errors, out _);
+        Assert.False(parsed);
+        errors.Select(e => e.Message).ToArray().Should().Equal(expectedErrorMessages);
+    }
+
+    [Fact]
+    public void Test_Intern_Table()
+    {
+        var localIdStr = "/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet";
+
+        var previous = LocalId.InternTable;
+        var table = new LocalIdInternTable(16);
+        LocalId.InternTable = table;
+        try
+        {
+            var first = LocalId.Parse(localIdStr);
+            var second = LocalId.Parse(localIdStr);
+            var channelId = SDK.Transport.DataChannelId.Parse(localIdStr);
+
+            Assert.Same(first, second);
+            Assert.Same(first, channelId.LocalId);
+
+            Assert.False(SDK.Transport.DataChannelId.Parse("0010").IsLocalId);
+
+            table.Clear();
+            Assert.NotSame(first, LocalId.Parse(localIdStr));
+        }
+        finally
+        {
+            LocalId.InternTable = previous;
+        }
+
+        Assert.Throws<ArgumentOutOfRangeException>(() => new LocalIdInternTable(100));
+    }
+
     [Fact]
     public void Test()
     {
@@ -1,5 +1,6 @@
 using System.ComponentModel.DataAnnotations;
 using FluentAssertions;
+using Vista.SDK.Internal;
 
 namespace Vista.SDK.Tests;
 
@@ -67,6 +68,49 @@ void Verify(bool succeeded, ParsingErrors errors, Location parsedLocation)
         }
     }
 
+    [Fact]
+    public void Test_Locations_Fast_Path_Matches_Full_Parser()
+    {
+        var locations = VIS.Instance.GetLocations(VisVersion.v3_4a);
+        var alphabet = "0189ACFHILMNOPSUVX ";
+
+        var count = 0;
+        var buffer = new char[4];
+        for (var length = 1; length <= buffer.Length; length++)
+            Generate(0, length);
+        Assert.True(count > 0);
+
+        foreach (var value in new[] { "123456789", "1234567890", "99999999999", "123456789FIPU" })
+            Verify(value.AsSpan());
+
+        void Generate(int index, int length)
+        {
+            if (index == length)
+            {
+                Verify(buffer.AsSpan(0, length));
+                return;
+            }
+            foreach (var ch in alphabet)
+            {
+                buffer[index] = ch;
+                Generate(index + 1, length);
+            }
+        }
+
+        void Verify(ReadOnlySpan<char> value)
+        {
+            var errorBuilder = LocationParsingErrorBuilder.Empty;
+            var expected = locations.TryParseWithErrors(value, null, out _, ref errorBuilder);
+            var fast = locations.TryParseFast(value);
+            // The fast path may decline valid locations, but must never accept invalid ones
+            if (fast)
+                Assert.True(expected, value.ToString());
+            else if (expected)
+                Assert.True(value.Length > 9, value.ToString());
+            count += fast ? 1 : 0;
+        }
+    }
+
     [Fact]
     public void Test_Location_Parse_Throwing()
     {
@@ -0,0 +1,173 @@
+using System.Text;
+using System.Text.Json;
+using Vista.SDK.Transport.Binary;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+using DataChannelDomain = Vista.SDK.Transport.DataChannel;
+using Domain = Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Tests.Transport.Binary;
+
+public class BinaryTests
+{
+    private static Domain.TimeSeriesDataPackage LoadSample(string file) =>
+        Serializer.DeserializeTimeSeriesData(File.ReadAllText(file))!.ToDomainModel();
+
+    // The JSON of the packages compares every value, including the string values of the data sets
+    private static string ToJson(Domain.TimeSeriesDataPackage package) => package.ToJsonDto().Serialize();
+
+    private static DataChannelDomain.DataChannelListPackage LoadDataChannelList(string file) =>
+        Serializer.DeserializeDataChannelList(File.ReadAllText(file))!.ToDomainModel();
+
+    private static string ToJson(DataChannelDomain.DataChannelListPackage package) =>
+        package.ToJsonDto().Serialize();
+
+    [Theory]
+    [InlineData("schemas/json/TimeSeriesData.sample.json")]
+    [InlineData("Transport/Json/_files/TimeSeriesData.json")]
+    public void Test_TimeSeriesData_Roundtrip(string file)
+    {
+        var package = LoadSample(file);
+
+        var bytes = package.Serialize();
+        var deserialized = BinarySerializer.DeserializeTimeSeriesData(bytes);
+
+        Assert.Equal(ToJson(package), ToJson(deserialized));
+        Assert.True(bytes.Length < Encoding.UTF8.GetByteCount(ToJson(package)));
+    }
+
+    [Fact]
+    public void Test_TimeSeriesData_Stream_Roundtrip()
+    {
+        var package = IsoMessageTests.TestTimeSeriesDataPackage;
+
+        using var stream = new MemoryStream();
+        package.Serialize(stream);
+        Assert.Equal(package.Serialize(), stream.ToArray());
+
+        stream.Position = 0;
+        var deserialized = BinarySerializer.DeserializeTimeSeriesData(stream);
+
+        Assert.Equal(ToJson(package), ToJson(deserialized));
+    }
+
+    [Theory]
+    [InlineData("schemas/json/DataChannelList.sample.json")]
+    [InlineData("Transport/Json/_files/DataChannelList.json")]
+    public void Test_DataChannelList_Roundtrip(string file)
+    {
+        var package = LoadDataChannelList(file);
+
+        var bytes = package.Serialize();
+        var deserialized = BinarySerializer.DeserializeDataChannelList(bytes);
+
+        Assert.Equal(ToJson(package), ToJson(deserialized));
+        Assert.True(bytes.Length < Encoding.UTF8.GetByteCount(ToJson(package)));
+
+        using var stream = new MemoryStream();
+        package.Serialize(stream);
+        Assert.Equal(bytes, stream.ToArray());
+
+        stream.Position = 0;
+        Assert.Equal(ToJson(package), ToJson(BinarySerializer.DeserializeDataChannelList(stream)));
+    }
+
+    [Theory]
+    [InlineData("0")]
+    [InlineData("100.0")]
+    [InlineData("-0.0250")]
+    [InlineData("-0")]
+    [InlineData("007")]
+    [InlineData("+1")]
+    [InlineData("1.")]
+    [InlineData(".5")]
+    [InlineData("1e5")]
+    [InlineData("1E+300")]
+    [InlineData("0.30000000000000004")]
+    [InlineData("123456789012345678901234567890")]
+    [InlineData("NaN")]
+    [InlineData("true")]
+    [InlineData("True")]
+    [InlineData("")]
+    [InlineData("Øst")]
+    public void Test_Values_Roundtrip(string value)
+    {
+        var package = IsoMessageTests.TestTimeSeriesDataPackage;
+        var data = package.Package.TimeSeriesData[0];
+        data.TabularData![0].DataSets![0].Value[0] = value;
+        data.EventData!.DataSet![0].Value = value;
+
+        var deserialized = BinarySerializer.DeserializeTimeSeriesData(package.Serialize());
+
+        var deserializedData = deserialized.Package.TimeSeriesData[0];
+        Assert.Equal(value, deserializedData.TabularData![0].DataSets![0].Value[0]);
+        Assert.Equal(value, deserializedData.EventData!.DataSet![0].Value);
+    }
+
+    [Fact]
+    public void Test_Custom_Properties_Roundtrip()
+    {
+        var package = IsoMessageTests.TestTimeSeriesDataPackage;
+        using var document = JsonDocument.Parse("""{ "nested": [1, "two"] }""");
+        package.Package.Header!.CustomHeaders = new()
+        {
+            ["string"] = "value",
+            ["bool"] = true,
+            ["long"] = -42L,
+            ["double"] = 1.5,
+            ["element"] = document.RootElement.Clone(),
+        };
+
+        var headers = BinarySerializer.DeserializeTimeSeriesData(package.Serialize()).Package.Header!.CustomHeaders!;
+
+        Assert.Equal("value", headers["string"]);
+        Assert.Equal(true, headers["bool"]);
+        Assert.Equal(-42L, headers["long"]);
+        Assert.Equal(1.5, headers["double"]);
+        Assert.Equal("""{ "nested": [1, "two"] }""", ((JsonElement)headers["element"]).GetRawText());
+
+        package.Package.Header!.CustomHeaders["unsupported"] = new object();
+        Assert.Throws<NotSupportedException>(() => package.Serialize());
+    }
+
+    [Fact]
+    public void Test_Invalid_Payloads()
+    {
+        var bytes = IsoMessageTests.TestTimeSeriesDataPackage.Serialize();
+
+        Assert.Throws<InvalidDataException>(() => BinarySerializer.DeserializeTimeSeriesData(new byte[] { 1, 2, 3, 4 }));
+        Assert.Throws<EndOfStreamException>(
+            () => BinarySerializer.DeserializeTimeSeriesData(bytes, 0, bytes.Length / 2)
+        );
+        Assert.Throws<EndOfStreamException>(
+            () => BinarySerializer.DeserializeTimeSeriesData(new MemoryStream(bytes, 0, bytes.Length - 1))
+        );
+
+        var dataChannelList = IsoMessageTests.TestDataChannelListPackage.Serialize();
+        Assert.Throws<InvalidDataException>(() => BinarySerializer.DeserializeDataChannelList(bytes));
+        Assert.Throws<InvalidDataException>(() => BinarySerializer.DeserializeTimeSeriesData(dataChannelList));
+        Assert.Throws<EndOfStreamException>(
+            () => BinarySerializer.DeserializeDataChannelList(dataChannelList, 0, dataChannelList.Length / 2)
+        );
+    }
+
+    [Fact]
+    public void Test_Field_Lengths()
+    {
+        var package = IsoMessageTests.TestTimeSeriesDataPackage;
+        var value = new string('a', 100_000);
+        package.Package.Header!.CustomHeaders = new() { ["long"] = value };
+        var bytes = package.Serialize();
+
+        // Fields larger than the stream buffer, or than the maximum length
+        var headers = BinarySerializer.DeserializeTimeSeriesData(new MemoryStream(bytes)).Package.Header!.CustomHeaders!;
+        Assert.Equal(value, headers["long"]);
+        Assert.Throws<InvalidDataException>(
+            () => BinarySerializer.DeserializeTimeSeriesData(new MemoryStream(bytes), maxFieldLength: 50_000)
+        );
+        Assert.Throws<InvalidDataException>(
+            () => BinarySerializer.DeserializeTimeSeriesData(bytes, 0, bytes.Length, maxFieldLength: 50_000)
+        );
+    }
+}
@@ -86,6 +86,9 @@ public void Test_DataChannelTypeNames_Parse(string value, bool expectedResult)
         }
         else
             Assert.IsType<DataChannelTypeNames.ParseResult.Invalid>(result);
+
+        var spanResult = dataChannelTypeNames.Parse($"[{value}]".AsSpan(1, value.Length));
+        Assert.Equal(result, spanResult);
     }
 
     [Theory]
@@ -135,6 +138,9 @@ public void Test_FormatDataType_Parse(string value, bool expectedResult)
         }
         else
             Assert.IsType<FormatDataTypes.ParseResult.Invalid>(result);
+
+        var spanResult = types.Parse($"[{value}]".AsSpan(1, value.Length));
+        Assert.Equal(result, spanResult);
     }
 
     [Theory]
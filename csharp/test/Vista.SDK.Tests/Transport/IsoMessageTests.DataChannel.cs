@@ -194,4 +194,223 @@ public void Test_DataChannelList_Json()
 
         message.Should().BeEquivalentTo(message2);
     }
+
+    public static IEnumerable<object?[]> Test_Value_Validator_Data =>
+        new object?[][]
+        {
+            ["Decimal", null, "1.5"],
+            ["Decimal", null, "abc"],
+            ["Decimal", new Restriction { FractionDigits = 1, MinInclusive = 0, MaxInclusive = 10 }, "1.5"],
+            ["Decimal", new Restriction { FractionDigits = 1, MinInclusive = 0, MaxInclusive = 10 }, "1.55"],
+            ["Decimal", new Restriction { FractionDigits = 1, MinInclusive = 0, MaxInclusive = 10 }, "11"],
+            ["Integer", null, "42"],
+            ["Integer", null, "4.2"],
+            ["Integer", new Restriction { MinExclusive = 0, MaxExclusive = 100 }, "100"],
+            ["Integer", new Restriction { TotalDigits = 2 }, "42"],
+            ["Boolean", null, "true"],
+            ["Boolean", null, "yes"],
+            ["String", null, "anything"],
+            ["String", new Restriction { Enumeration = ["ON", "OFF"] }, "ON"],
+            ["String", new Restriction { Enumeration = ["ON", "OFF"] }, "on"],
+            ["String", new Restriction { MaxLength = 4, MinLength = 1 }, "abc"],
+            ["String", new Restriction { MaxLength = 4, MinLength = 1 }, "abcd"],
+            ["String", new Restriction { Length = 3 }, "ab"],
+            ["String", new Restriction { Pattern = "^[A-Z]+$" }, "ABC"],
+            ["String", new Restriction { Pattern = "^[A-Z]+$" }, "AbC"],
+            ["DateTime", null, "1994-11-20T10:25:33Z"],
+            ["DateTime", null, "1994-11-20T10"],
+        };
+
+    [Theory]
+    [MemberData(nameof(Test_Value_Validator_Data))]
+    public void Test_Value_Validator(string type, Restriction? restriction, string value)
+    {
+        var format = new Format { Type = type, Restriction = restriction };
+
+        var expected = format.ValidateValue(value, out var expectedValue);
+        var validator = ValueValidator.Compile(format);
+        var result = validator.Validate(value, out var parsedValue);
+
+        Assert.Equal(expected.GetType(), result.GetType());
+        Assert.Equal(expected.GetType(), validator.Validate(value).GetType());
+        if (result is ValidateResult.Invalid invalid)
+        {
+            Assert.Equal(((ValidateResult.Invalid)expected).Messages, invalid.Messages);
+            Assert.Null(parsedValue);
+        }
+        else
+            Assert.Equal(expectedValue, parsedValue);
+    }
+
+    [Fact]
+    public void Test_DataChannelList_Validator_Cache()
+    {
+        var dataChannelList = ValidDataChannelList.DataChannelList;
+        var dataChannel = dataChannelList[0];
+
+        var validator = dataChannelList.GetValidator(dataChannel);
+        Assert.Same(validator, dataChannelList.GetValidator(dataChannel));
+
+        dataChannel.Property.Format.Restriction = new Restriction { Enumeration = ["1"] };
+        var recompiled = dataChannelList.GetValidator(dataChannel);
+        Assert.NotSame(validator, recompiled);
+        Assert.IsType<ValidateResult.Invalid>(recompiled.Validate("2"));
+        Assert.Same(recompiled, dataChannelList.GetValidator(dataChannel));
+
+        dataChannel.Property.Format.Restriction.Enumeration = ["2"];
+        Assert.IsType<ValidateResult.Ok>(dataChannelList.GetValidator(dataChannel).Validate("2"));
+
+        // Changed in place
+        var enumeration = new List<string> { "1" };
+        dataChannel.Property.Format.Restriction.Enumeration = enumeration;
+        Assert.IsType<ValidateResult.Invalid>(dataChannelList.GetValidator(dataChannel).Validate("2"));
+        enumeration.Add("2");
+        Assert.IsType<ValidateResult.Ok>(dataChannelList.GetValidator(dataChannel).Validate("2"));
+    }
+
+    [Fact]
+    public void Test_DataChannelList_Migration()
+    {
+        var package = ValidFullyCustomDataChannelList;
+        var dataChannelList = package.DataChannelList;
+        var expectedLocalIds = dataChannelList
+            .Select(dc => VIS.Instance.ConvertLocalId(dc.DataChannelId.LocalId, VIS.LatestVisVersion))
+            .ToArray();
+
+        var result = DataChannelListMigration.Migrate(package, VIS.LatestVisVersion);
+
+        Assert.True(result.IsSuccess);
+
+        var migrated = result.Package.DataChannelList;
+        Assert.Equal(expectedLocalIds.Length, migrated.Count);
+        for (var i = 0; i < expectedLocalIds.Length; i++)
+        {
+            Assert.Equal(expectedLocalIds[i], migrated[i].DataChannelId.LocalId);
+            Assert.Equal(dataChannelList[i].DataChannelId.ShortId, migrated[i].DataChannelId.ShortId);
+            Assert.Same(dataChannelList[i].Property, migrated[i].Property);
+            Assert.Same(migrated[i], migrated[expectedLocalIds[i]!]);
+        }
+        Assert.Equal(package.Package.Header, result.Package.Package.Header);
+    }
+
+    [Fact]
+    public void Test_DataChannelList_Migration_Collects_Failures()
+    {
+        var package = ValidFullyCustomDataChannelList;
+        var dataChannelList = package.DataChannelList;
+        var last = dataChannelList[dataChannelList.Count - 1];
+        var newer = last with
+        {
+            DataChannelId = last.DataChannelId with
+            {
+                LocalId = LocalId.Parse("/dnv-v2/vis-3-6a/411.1/C101.31-2/meta/qty-temperature"),
+                ShortId = "newer"
+            }
+        };
+        dataChannelList.Add(newer);
+
+        var result = DataChannelListMigration.Migrate(package, VisVersion.v3_5a, maxDegreeOfParallelism: 2);
+
+        var failure = Assert.Single(result.Failures);
+        Assert.Same(newer, failure.DataChannel);
+        Assert.NotNull(failure.Exception);
+        Assert.Equal(dataChannelList.Count - 1, result.Package.DataChannelList.Count);
+    }
+
+    [Fact]
+    public void Test_DataChannelList_Remove_Keeps_Order()
+    {
+        var dataChannelList = ValidFullyCustomDataChannelList.DataChannelList;
+        var first = dataChannelList[0];
+        var second = dataChannelList[1];
+        var version = dataChannelList.Version;
+
+        Assert.True(dataChannelList.Contains(first));
+        Assert.False(dataChannelList.Contains(first with { DataChannelId = second.DataChannelId }));
+        Assert.True(dataChannelList.Remove(first));
+        Assert.False(dataChannelList.Remove(first));
+        Assert.False(dataChannelList.Contains(first));
+        Assert.False(dataChannelList.TryGetByShortId(first.DataChannelId.ShortId!, out _));
+        Assert.NotEqual(version, dataChannelList.Version);
+
+        Assert.Same(second, Assert.Single(dataChannelList));
+        dataChannelList.Add(first);
+        Assert.Equal(new[] { second, first }, dataChannelList.DataChannels);
+        Assert.True(dataChannelList.Remove(second));
+        Assert.Same(first, dataChannelList[first.DataChannelId.LocalId]);
+    }
+
+    [Fact]
+    public void Test_DataChannelList_Diff()
+    {
+        var source = ValidFullyCustomDataChannelList.DataChannelList;
+        var target = ValidFullyCustomDataChannelList.DataChannelList;
+        Assert.True(DataChannelListDiff.Compute(source, target).IsEmpty);
+
+        var kept = target[0];
+        var removed = target[1];
+        var modified = kept with { Property = kept.Property with { Remarks = "Moved" } };
+        var added = removed with
+        {
+            DataChannelId = new SDK.Transport.DataChannel.DataChannelId
+            {
+                LocalId = LocalId.Parse("/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature"),
+                // Short IDs can move to other data channels
+                ShortId = removed.DataChannelId.ShortId,
+            }
+        };
+        target.Remove(kept);
+        target.Remove(removed);
+        target.Add([modified, added]);
+
+        var diff = DataChannelListDiff.Compute(source, target);
+        Assert.Same(added, Assert.Single(diff.Added));
+        Assert.Same(source[1], Assert.Single(diff.Removed));
+        var change = Assert.Single(diff.Modified);
+        Assert.Same(source[0], change.Previous);
+        Assert.Same(modified, change.Current);
+
+        var addedQuery = LocalIdQueryBuilder.From(added.DataChannelId.LocalId).Build();
+        var keptQuery = LocalIdQueryBuilder.From(kept.DataChannelId.LocalId).Build();
+        Assert.True(diff.Affects(addedQuery));
+        Assert.False(diff.Affects(keptQuery));
+
+        var version = source.Version;
+        source.Apply(diff);
+        Assert.NotEqual(version, source.Version);
+        Assert.Equal(new[] { modified, added }, source.DataChannels);
+        Assert.Same(modified, source[kept.DataChannelId.LocalId]);
+        Assert.Same(modified, source[kept.DataChannelId.ShortId!]);
+        Assert.Same(added, source[added.DataChannelId.ShortId!]);
+        Assert.False(source.TryGetByLocalId(removed.DataChannelId.LocalId, out _));
+        Assert.True(DataChannelListDiff.Compute(source, target).IsEmpty);
+
+        // Already applied, nothing changes
+        version = source.Version;
+        Assert.Throws<ArgumentException>(() => source.Apply(diff));
+        Assert.Equal(version, source.Version);
+        Assert.Equal(new[] { modified, added }, source.DataChannels);
+    }
+
+    [Fact]
+    public void Test_DataChannelList_Diff_Keeps_Validators()
+    {
+        var source = ValidFullyCustomDataChannelList.DataChannelList;
+        var target = ValidFullyCustomDataChannelList.DataChannelList;
+        var unchanged = source[0];
+        var validator = source.GetValidator(unchanged);
+        var previous = source[1];
+        var previousValidator = source.GetValidator(previous);
+
+        var modified = target[1];
+        modified.Property.Format.Restriction = new Restriction { Enumeration = ["ON", "OFF"] };
+        var diff = DataChannelListDiff.Compute(source, target);
+        Assert.Same(modified, Assert.Single(diff.Modified).Current);
+
+        source.Apply(diff);
+        Assert.Same(validator, source.GetValidator(unchanged));
+        var recompiled = source.GetValidator(modified);
+        Assert.NotSame(previousValidator, recompiled);
+        Assert.IsType<ValidateResult.Invalid>(recompiled.Validate("on"));
+    }
 }
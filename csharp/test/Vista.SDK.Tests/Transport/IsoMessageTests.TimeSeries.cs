@@ -1,3 +1,5 @@
+using System.Buffers;
+using System.Globalization;
 using FluentAssertions;
 using Vista.SDK.Transport;
 using Vista.SDK.Transport.TimeSeries;
@@ -198,4 +200,209 @@ public void Test_TimeSeriesData_Validation()
             result.Should().BeOfType<ValidateResult.Ok>();
         }
     }
+
+    [Fact]
+    public void Test_TabularColumnBatch()
+    {
+        var dcList = TestDataChannelListPackage.DataChannelList;
+        var message = TestTimeSeriesDataPackage;
+
+        foreach (var table in message.Package.TimeSeriesData.SelectMany(x => x.TabularData ?? []))
+        {
+            var result = TabularColumnBatch.Create(table, dcList, out var batch);
+            result.Should().BeOfType<ValidateResult.Ok>();
+            Assert.NotNull(batch);
+            using var _ = batch;
+
+            Assert.Equal(table.DataSets!.Count, batch.RowCount);
+            Assert.Equal(table.DataSets.Select(x => x.TimeStamp), batch.TimeStamps.ToArray());
+            Assert.Equal(table.DataChannelIds!.Count, batch.Columns.Count);
+            for (var j = 0; j < batch.Columns.Count; j++)
+            {
+                var column = batch[j];
+                Assert.Equal(table.DataChannelIds[j], column.DataChannelId);
+                var validator = dcList.GetValidator(column.DataChannel);
+                for (var i = 0; i < batch.RowCount; i++)
+                {
+                    var row = table.DataSets[i];
+                    Assert.IsType<ValidateResult.Ok>(validator.Validate(row.Value[j], out var expected));
+                    object actual = column switch
+                    {
+                        TabularColumn<double> c => new Value.Decimal((decimal)c.Values[i]),
+                        TabularColumn<long> c => new Value.Integer((int)c.Values[i]),
+                        TabularColumn<bool> c => new Value.Boolean(c.Values[i]),
+                        TabularColumn<DateTimeOffset> c => new Value.DateTime(c.Values[i]),
+                        StringTabularColumn c => new Value.String(c[i]),
+                        _ => throw new Exception("Unexpected column type"),
+                    };
+                    Assert.Equal(expected, actual);
+                    if (row.Quality is null)
+                        Assert.True(column.Quality.IsEmpty);
+                    else
+                        Assert.Equal(row.Quality[j], column.Quality[i]);
+                }
+            }
+        }
+    }
+
+    [Fact]
+    public void Test_TabularColumnBatch_Invalid()
+    {
+        var dcList = TestDataChannelListPackage.DataChannelList;
+        var table = TestTimeSeriesDataPackage.Package.TimeSeriesData[0].TabularData![1];
+        table.DataSets![1].Value[0] = "abc";
+
+        var result = TabularColumnBatch.Create(table, dcList, out var batch);
+        var invalid = Assert.IsType<ValidateResult.Invalid>(result);
+        Assert.Null(batch);
+        Assert.Single(invalid.Messages);
+        Assert.Contains("Invalid decimal value - Value='abc'", invalid.Messages[0]);
+
+        table.DataChannelIds![0] = DataChannelId.Parse("unknown");
+        result = TabularColumnBatch.Create(table, dcList, out batch);
+        invalid = Assert.IsType<ValidateResult.Invalid>(result);
+        Assert.Null(batch);
+        Assert.Contains("Data channel with short id 'unknown' not found", invalid.Messages[0]);
+    }
+
+    [Fact]
+    public void Test_TimeSeriesData_Json_Encoded_TabularData()
+    {
+        var message = TestTimeSeriesDataPackage;
+
+        var dto = SDK.Transport.Json.TimeSeriesData.Extensions.ToJsonDto(message, encodeTabularData: true);
+        Assert.All(dto.Package.TimeSeriesData, t => Assert.Null(t.TabularData));
+        var message2 = SDK.Transport.Json.TimeSeriesData.Extensions.ToDomainModel(dto);
+
+        var tables = message.Package.TimeSeriesData.SelectMany(x => x.TabularData ?? []).ToList();
+        var tables2 = message2.Package.TimeSeriesData.SelectMany(x => x.TabularData ?? []).ToList();
+        Assert.Equal(tables.Count, tables2.Count);
+        for (var i = 0; i < tables.Count; i++)
+        {
+            Assert.Equal(tables[i].DataChannelIds, tables2[i].DataChannelIds);
+            AssertEqual(tables[i].DataSets!, tables2[i].DataSets!);
+        }
+        Assert.All(message2.Package.TimeSeriesData, t => Assert.Null(t.CustomDataKinds));
+    }
+
+    [Fact]
+    public void Test_TimeSeriesData_Json_Encoded_TabularData_Order()
+    {
+        var message = TestTimeSeriesDataPackage;
+        var timeSeriesData = message.Package.TimeSeriesData[0];
+        var table = timeSeriesData.TabularData![0];
+
+        // Tables without data sets aren't encoded, so they stay in the tabular data of the JSON
+        var empty = new TabularData { DataChannelIds = table.DataChannelIds, DataSets = null };
+        timeSeriesData.TabularData = [empty, table, empty, table, empty];
+
+        var dto = SDK.Transport.Json.TimeSeriesData.Extensions.ToJsonDto(message, encodeTabularData: true);
+        Assert.Equal(3, dto.Package.TimeSeriesData[0].TabularData!.Count);
+        var message2 = SDK.Transport.Json.TimeSeriesData.Extensions.ToDomainModel(dto);
+        var tables = message2.Package.TimeSeriesData[0].TabularData!;
+
+        Assert.Equal([false, true, false, true, false], tables.Select(t => t.DataSets is not null));
+        Assert.All(tables, t => Assert.Equal(table.DataChannelIds, t.DataChannelIds));
+    }
+
+    [Fact]
+    public void Test_TabularDataCodec()
+    {
+        foreach (var table in TestTimeSeriesDataPackage.Package.TimeSeriesData.SelectMany(x => x.TabularData ?? []))
+            AssertCodecRoundtrip(table);
+    }
+
+    [Fact]
+    public void Test_TabularDataCodec_Generated()
+    {
+        var random = new Random(1234);
+        var start = DateTimeOffset.Parse("2024-01-01T00:00:00+01:00", CultureInfo.InvariantCulture);
+        var level = 100.0;
+        var dataSets = new List<TabularDataSet>();
+        for (var i = 0; i < 1000; i++)
+        {
+            level += random.NextDouble() - 0.5;
+            var timeStamp = start.AddSeconds(i).AddTicks(i % 10 == 0 ? random.Next(-10_000, 10_000) : 0);
+            if (i >= 500)
+                timeStamp = timeStamp.ToOffset(System.TimeSpan.FromHours(2));
+
+            dataSets.Add(
+                new TabularDataSet
+                {
+                    TimeStamp = timeStamp,
+                    Value =
+                    [
+                        (i / 10).ToString(CultureInfo.InvariantCulture),
+                        (i * 0.25m - 50).ToString("0.00", CultureInfo.InvariantCulture),
+                        level.ToString("R", CultureInfo.InvariantCulture),
+                        i % 100 < 50 ? "OPEN" : "CLOSED",
+                        i == 3 ? "007" : "1",
+                    ],
+                    Quality = i % 7 == 0 ? null : ["0", "0", i % 50 == 0 ? "1" : "0", "0", "0"],
+                }
+            );
+        }
+        var table = new TabularData
+        {
+            DataChannelIds = Enumerable.Range(1, 5).Select(i => DataChannelId.Parse($"{i:D4}")).ToList(),
+            DataSets = dataSets,
+        };
+
+        var encoded = AssertCodecRoundtrip(table);
+
+        // Compared to the timestamps, values and qualities as text
+        var textLength = dataSets.Sum(
+            d => d.TimeStamp.ToString("o").Length + d.Value.Sum(v => v.Length) + (d.Quality?.Sum(q => q.Length) ?? 0)
+        );
+        Assert.True(encoded.Length * 5 < textLength, $"{encoded.Length} bytes encoded from {textLength} characters");
+    }
+
+    [Fact]
+    public void Test_TabularDataCodec_Invalid()
+    {
+        var table = TestTimeSeriesDataPackage.Package.TimeSeriesData[0].TabularData![0];
+        table.DataSets![1].Value.RemoveAt(0);
+
+        var buffer = new ArrayBufferWriter<byte>();
+        Assert.False(TabularDataCodec.TryEncode(table, buffer));
+        Assert.Equal(0, buffer.WrittenCount);
+
+        table = TestTimeSeriesDataPackage.Package.TimeSeriesData[0].TabularData![0];
+        Assert.True(TabularDataCodec.TryEncode(table, buffer));
+        var encoded = buffer.WrittenSpan.ToArray();
+        Assert.Throws<EndOfStreamException>(() => TabularDataCodec.Decode(encoded.AsSpan(0, encoded.Length / 2)));
+        Assert.Throws<InvalidDataException>(() => TabularDataCodec.Decode(encoded, table.DataChannelIds!.Count));
+        Assert.Equal((table.DataSets!.Count, table.DataChannelIds!.Count), TabularDataCodec.ReadCounts(encoded));
+        encoded[0] = 42;
+        Assert.Throws<InvalidDataException>(() => TabularDataCodec.Decode(encoded));
+
+        // int.MaxValue data sets of a data channel in a few bytes
+        byte[] counts = [1, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 1, 0, 0];
+        Assert.Throws<EndOfStreamException>(() => TabularDataCodec.Decode(counts));
+        Assert.Throws<EndOfStreamException>(() => TabularDataCodec.ReadCounts(counts));
+    }
+
+    private static byte[] AssertCodecRoundtrip(TabularData table)
+    {
+        var buffer = new ArrayBufferWriter<byte>();
+        Assert.True(TabularDataCodec.TryEncode(table, buffer));
+
+        AssertEqual(table.DataSets!, TabularDataCodec.Decode(buffer.WrittenSpan));
+        return buffer.WrittenSpan.ToArray();
+    }
+
+    private static void AssertEqual(List<TabularDataSet> expected, List<TabularDataSet> actual)
+    {
+        Assert.Equal(expected.Count, actual.Count);
+        for (var i = 0; i < expected.Count; i++)
+        {
+            Assert.Equal(expected[i].TimeStamp, actual[i].TimeStamp);
+            Assert.Equal(expected[i].TimeStamp.Offset, actual[i].TimeStamp.Offset);
+            Assert.Equal(expected[i].Value, actual[i].Value);
+            if (expected[i].Quality is null)
+                Assert.Null(actual[i].Quality);
+            else
+                Assert.Equal(expected[i].Quality!, actual[i].Quality!);
+        }
+    }
 }
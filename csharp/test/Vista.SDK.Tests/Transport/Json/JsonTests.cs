@@ -1,6 +1,7 @@
 using System.Globalization;
 using System.Text;
 using System.Text.Json;
+using System.Text.Json.Serialization.Metadata;
 using FluentAssertions;
 using FluentAssertions.Equivalency;
 using ICSharpCode.SharpZipLib.BZip2;
@@ -8,6 +9,7 @@
 using Json.Schema.Serialization;
 using Vista.SDK.Transport.Json;
 using Vista.SDK.Transport.Json.DataChannel;
+using Vista.SDK.Tests.Transport;
 using Vista.SDK.Transport.Json.TimeSeriesData;
 
 namespace Vista.SDK.Tests.Transport.Json;
@@ -24,6 +26,15 @@ public class JsonTests
     [InlineData("2022-04-04T20:44:31.1234567-01:00", true)]
     [InlineData("2022-04-04T20:44:31.1234567-01", false)]
     [InlineData("20-11-1994T20:44:31Z", false)]
+    [InlineData("2022-02-29T20:44:31Z", false)]
+    [InlineData("2022-04-04T24:00:00Z", false)]
+    [InlineData("2022-04-04T20:44:31.Z", false)]
+    [InlineData("2022-04-04T20:44:31+15:00", false)]
+    [InlineData("2022-04-04T20:44:31.1234567", false)]
+    [InlineData("0001-01-01T00:00:00+01:00", false)]
+    [InlineData("2022-04-04T20:44:31Z\\n", true)]
+    [InlineData("2022-04-04T20:44:31Z\\n\\n", false)]
+    [InlineData("2022-04-04T20:44:31Z ", false)]
     public void Test_ISO8601_DateTimeOffset(string value, bool expectedResult)
     {
         var converter = new DatetimeOffsetConverter();
@@ -188,6 +199,30 @@ public async Task Test_DataChannelList_Domain_Model_Roundtrip(string file)
         dto.Should().BeEquivalentTo(package, DataChannelListEquivalency);
     }
 
+    [Theory]
+    [InlineData("Transport/Json/_files/DataChannelList.json")]
+    [InlineData("schemas/json/DataChannelList.sample.json")]
+    [InlineData("schemas/json/DataChannelList.sample.compact.json")]
+    public async Task Test_DataChannelList_Source_Generated_Serialization(string file)
+    {
+        var json = await File.ReadAllTextAsync(file);
+        var reflectionOptions = new JsonSerializerOptions(Serializer.Options)
+        {
+            TypeInfoResolver = new DefaultJsonTypeInfoResolver()
+        };
+
+        var context = DataChannelListSerializerContext.Default;
+        var package = JsonSerializer.Deserialize(json, context.DataChannelListPackage);
+        Assert.NotNull(package);
+
+        var expected = JsonSerializer.Serialize(
+            JsonSerializer.Deserialize<DataChannelListPackage>(json, reflectionOptions),
+            reflectionOptions
+        );
+        Assert.Equal(expected, JsonSerializer.Serialize(package, context.DataChannelListPackage));
+        Assert.Equal(expected, Serializer.DeserializeDataChannelList(json)!.Serialize());
+    }
+
     [Theory]
     [InlineData("Transport/Json/_files/DataChannelList.json")]
     [InlineData("schemas/json/DataChannelList.sample.json")]
@@ -266,6 +301,232 @@ public async Task Test_TimeSeriesData_Domain_Model_Roundtrip(string file)
         dto.Should().BeEquivalentTo(package, TimeSeriesDataEquivalency);
     }
 
+    [Theory]
+    [InlineData(7, false)]
+    [InlineData(7, true)]
+    [InlineData(64 * 1024, false)]
+    public async Task Test_TimeSeriesData_Streaming_Validation(int chunkSize, bool withBom)
+    {
+        var dcPackage = IsoMessageTests.TestDataChannelListPackage;
+        var package = IsoMessageTests.TestTimeSeriesDataPackage;
+
+        var expected = new List<(DateTimeOffset, SDK.Transport.DataChannel.DataChannel, SDK.Transport.Value, string?)>();
+        foreach (var timeSeriesData in package.Package.TimeSeriesData)
+        {
+            var result = timeSeriesData.Validate(
+                dcPackage,
+                (t, dc, v, q) => Collect(expected, t, dc, v, q),
+                (t, dc, v, q) => Collect(expected, t, dc, v, q)
+            );
+            Assert.IsType<ValidateResult.Ok>(result);
+        }
+
+        var json = Encoding.UTF8.GetBytes(package.ToJsonDto().Serialize());
+        if (withBom)
+            json = Encoding.UTF8.GetPreamble().Concat(json).ToArray();
+
+        var actual = new List<(DateTimeOffset, SDK.Transport.DataChannel.DataChannel, SDK.Transport.Value, string?)>();
+        var streamed = Serializer.ValidateTimeSeriesData(
+            new ChunkedStream(json, chunkSize),
+            dcPackage,
+            (t, dc, v, q) => Collect(actual, t, dc, v, q),
+            (t, dc, v, q) => Collect(actual, t, dc, v, q)
+        );
+        Assert.IsType<ValidateResult.Ok>(streamed);
+        Assert.Equal(expected, actual);
+
+        actual.Clear();
+        streamed = await Serializer.ValidateTimeSeriesDataAsync(
+            new ChunkedStream(json, chunkSize),
+            dcPackage,
+            (t, dc, v, q) => Collect(actual, t, dc, v, q),
+            (t, dc, v, q) => Collect(actual, t, dc, v, q)
+        );
+        Assert.IsType<ValidateResult.Ok>(streamed);
+        Assert.Equal(expected, actual);
+
+        static ValidateResult Collect(
+            List<(DateTimeOffset, SDK.Transport.DataChannel.DataChannel, SDK.Transport.Value, string?)> calls,
+            DateTimeOffset timeStamp,
+            SDK.Transport.DataChannel.DataChannel dataChannel,
+            SDK.Transport.Value value,
+            string? quality
+        )
+        {
+            calls.Add((timeStamp, dataChannel, value, quality));
+            return new ValidateResult.Ok();
+        }
+    }
+
+    [Fact]
+    public void Test_TimeSeriesData_Streaming_Validation_Invalid()
+    {
+        var dcPackage = IsoMessageTests.TestDataChannelListPackage;
+        // The custom header is larger than the read buffer, so it has to grow to read the token
+        var json = $$$"""
+            {"Package":{"Header":{"ShipID":"IMO1234567","Custom":"{{{new string('x', 40_000)}}}"},
+            "TimeSeriesData":[{"TabularData":[{"NumberOfDataSet":1,"NumberOfDataChannel":1,"DataChannelID":["9999"],
+            "DataSet":[{"TimeStamp":"2016-01-01T12:00:00Z","Value":["1"]}]}]}]}}
+            """;
+
+        var domain = Serializer.DeserializeTimeSeriesData(json)!.ToDomainModel();
+        var expected = domain.Package.TimeSeriesData[0].Validate(
+            dcPackage,
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (_, _, _, _) => new ValidateResult.Ok()
+        );
+
+        var result = Serializer.ValidateTimeSeriesData(
+            new ChunkedStream(Encoding.UTF8.GetBytes(json), 4096),
+            dcPackage,
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (_, _, _, _) => new ValidateResult.Ok()
+        );
+
+        var invalid = Assert.IsType<ValidateResult.Invalid>(result);
+        Assert.Equal(Assert.IsType<ValidateResult.Invalid>(expected).Messages, invalid.Messages);
+
+        Assert.ThrowsAny<JsonException>(
+            () =>
+                Serializer.ValidateTimeSeriesData(
+                    new MemoryStream(Encoding.UTF8.GetBytes(json.Substring(0, 200))),
+                    dcPackage,
+                    (_, _, _, _) => new ValidateResult.Ok(),
+                    (_, _, _, _) => new ValidateResult.Ok()
+                )
+        );
+    }
+
+    [Theory]
+    [InlineData(1, 1)]
+    [InlineData(5, 1)]
+    [InlineData(1, 3)]
+    public void Test_TimeSeriesData_Streaming_Validation_Counts(int numberOfDataSet, int numberOfDataChannel)
+    {
+        // The domain model derives the counts from the contents of a table, which the streaming path validates too,
+        // whatever counts the header declares
+        var dcPackage = IsoMessageTests.TestDataChannelListPackage;
+        var dataChannelId = dcPackage.DataChannelList[0].DataChannelId;
+        var id = dataChannelId.ShortId ?? dataChannelId.LocalId.ToString();
+        string Package(int dataSets, int dataChannels) =>
+            $$$"""
+            {"Package":{"TimeSeriesData":[{"TabularData":[{"NumberOfDataSet":{{{dataSets}}},
+            "NumberOfDataChannel":{{{dataChannels}}},"DataChannelID":["{{{id}}}"],
+            "DataSet":[{"TimeStamp":"2016-01-01T12:00:00Z","Value":["100.0"]}]}]}]}}
+            """;
+
+        var domain = Serializer.DeserializeTimeSeriesData(Package(1, 1))!.ToDomainModel();
+        var expected = domain.Package.TimeSeriesData[0].Validate(
+            dcPackage,
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (_, _, _, _) => new ValidateResult.Ok()
+        );
+        var result = Serializer.ValidateTimeSeriesData(
+            new MemoryStream(Encoding.UTF8.GetBytes(Package(numberOfDataSet, numberOfDataChannel))),
+            dcPackage,
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (_, _, _, _) => new ValidateResult.Ok()
+        );
+
+        Assert.IsType<ValidateResult.Ok>(expected);
+        Assert.IsType<ValidateResult.Ok>(result);
+    }
+
+    [Fact]
+    public void Test_TimeSeriesData_Streaming_Validation_Encoded()
+    {
+        var dcPackage = IsoMessageTests.TestDataChannelListPackage;
+        ValidateResult Validate(SDK.Transport.TimeSeries.TimeSeriesDataPackage package, out int values)
+        {
+            var dto = package.ToJsonDto(encodeTabularData: true);
+            Assert.All(dto.Package.TimeSeriesData, t => Assert.Null(t.TabularData));
+
+            var count = 0;
+            var result = Serializer.ValidateTimeSeriesData(
+                new MemoryStream(Encoding.UTF8.GetBytes(dto.Serialize())),
+                dcPackage,
+                (_, _, _, _) =>
+                {
+                    count++;
+                    return new ValidateResult.Ok();
+                },
+                (_, _, _, _) => new ValidateResult.Ok()
+            );
+            values = count;
+            return result;
+        }
+
+        var package = IsoMessageTests.TestTimeSeriesDataPackage;
+        var expectedValues = package
+            .Package.TimeSeriesData.SelectMany(t => t.TabularData!)
+            .Sum(t => t.DataSets!.Sum(d => d.Value.Count));
+        Assert.IsType<ValidateResult.Ok>(Validate(package, out var values));
+        Assert.Equal(expectedValues, values);
+
+        // An invalid value inside an encoded table
+        package.Package.TimeSeriesData[0].TabularData![1].DataSets![1].Value[0] = "not a number";
+        var expected = package.Package.TimeSeriesData[0].Validate(
+            dcPackage,
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (_, _, _, _) => new ValidateResult.Ok()
+        );
+        var invalid = Assert.IsType<ValidateResult.Invalid>(Validate(package, out _));
+        Assert.Equal(Assert.IsType<ValidateResult.Invalid>(expected).Messages, invalid.Messages);
+    }
+
+    [Fact]
+    public void Test_TimeSeriesData_Streaming_Validation_Limits()
+    {
+        var dcPackage = IsoMessageTests.TestDataChannelListPackage;
+        static string Package(int rows, bool channelsFirst)
+        {
+            var channels = "\"DataChannelID\":[\"9999\"]";
+            var dataSets =
+                "\"DataSet\":["
+                + string.Join(",", Enumerable.Repeat("""{"TimeStamp":"2016-01-01T12:00:00Z","Value":["1"]}""", rows))
+                + "]";
+            var table = channelsFirst ? channels + "," + dataSets : dataSets + "," + channels;
+            return """{"Package":{"TimeSeriesData":[{"TabularData":[{""" + table + "}]}]}}";
+        }
+        ValidateResult Validate(string json) =>
+            Serializer.ValidateTimeSeriesData(
+                new MemoryStream(Encoding.UTF8.GetBytes(json)),
+                dcPackage,
+                (_, _, _, _) => new ValidateResult.Ok(),
+                (_, _, _, _) => new ValidateResult.Ok()
+            );
+
+        // Errors past the first thousand are only counted
+        var invalid = Assert.IsType<ValidateResult.Invalid>(Validate(Package(1500, channelsFirst: true)));
+        Assert.Equal(1001, invalid.Messages.Length);
+        Assert.Equal("500 more invalid values are not reported", invalid.Messages[^1]);
+
+        invalid = Assert.IsType<ValidateResult.Invalid>(Validate(Package(1500, channelsFirst: false)));
+        Assert.Equal(1001, invalid.Messages.Length);
+
+        // Data sets before the data channel IDs are held until the IDs are read
+        invalid = Assert.IsType<ValidateResult.Invalid>(Validate(Package(60_000, channelsFirst: false)));
+        Assert.Equal(
+            "Tabular data has more than 100000 values before its DataChannelID",
+            Assert.Single(invalid.Messages)
+        );
+    }
+
+    // Returns at most chunkSize bytes per read, like a network stream
+    private sealed class ChunkedStream : MemoryStream
+    {
+        private readonly int _chunkSize;
+
+        public ChunkedStream(byte[] buffer, int chunkSize)
+            : base(buffer) => _chunkSize = chunkSize;
+
+        public override int Read(byte[] buffer, int offset, int count) =>
+            base.Read(buffer, offset, Math.Min(count, _chunkSize));
+
+        public override Task<int> ReadAsync(byte[] buffer, int offset, int count, CancellationToken cancellationToken) =>
+            base.ReadAsync(buffer, offset, Math.Min(count, _chunkSize), cancellationToken);
+    }
+
     private sealed class JsonElementComparer : IEqualityComparer<JsonElement>
     {
         public bool Equals(JsonElement x, JsonElement y) =>
@@ -1,3 +1,5 @@
+using System.Text;
+
 namespace Vista.SDK.Tests;
 
 public class UniversalIdTests
@@ -67,4 +69,84 @@ public void Test_UniversalBuilder_TryWith()
         Assert.Null(universalBuilder.LocalId);
         Assert.Null(universalBuilder.ImoNumber);
     }
+
+    [Theory]
+    [MemberData(nameof(Test_Data))]
+    public void Test_Span_And_Utf8_Parsing(string testCase)
+    {
+        var expected = UniversalId.Parse(testCase);
+
+        Assert.True(UniversalId.TryParse(testCase.AsSpan(), out var fromSpan));
+        Assert.True(UniversalId.TryParse(Encoding.UTF8.GetBytes(testCase), out var fromUtf8));
+        Assert.True(UniversalIdBuilder.TryParse(testCase.AsSpan(), out var builder));
+
+        Assert.Equal(expected, fromSpan);
+        Assert.Equal(expected, fromUtf8);
+        Assert.Equal(expected, builder.Build());
+        Assert.Equal(testCase, fromSpan.ToString());
+    }
+
+    [Theory]
+    [InlineData("data.dnv.com/IMO1234568/dnv-v2/vis-3-4a/621.21/S90/meta/qty-mass")]
+    [InlineData("data.dnv.com/IMOabc/dnv-v2/vis-3-4a/621.21/S90/meta/qty-mass")]
+    [InlineData("data.dnv.no/IMO1234567/dnv-v2/vis-3-4a/621.21/S90/meta/qty-mass")]
+    [InlineData("data.dnv.com/IMO1234567/vis-3-4a/621.21/S90/meta/qty-mass")]
+    [InlineData("data.dnv.com/IMO1234567/dnv-v2/vis-3-4a/621.21/S90/meta/qty-invalid")]
+    [InlineData("")]
+    public void Test_Span_Parsing_Invalid(string testCase)
+    {
+        Assert.False(UniversalId.TryParse(testCase.AsSpan(), out var universalId));
+        Assert.Null(universalId);
+
+        // Checked again for vessels that were rejected before
+        Assert.False(UniversalId.TryParse(testCase.AsSpan(), out _));
+    }
+
+    [Fact]
+    public void Test_Vessel_Prefix_Errors()
+    {
+        var testCase = "data.dnv.com/IMO1234568/dnv-v2/vis-3-4a/621.21/S90/meta/qty-mass";
+        for (var i = 0; i < 2; i++)
+        {
+            Assert.True(UniversalIdBuilder.TryParse(testCase, out var errors, out var builder));
+            Assert.Null(builder.ImoNumber);
+            Assert.True(errors.HasErrors);
+        }
+    }
+
+    [Fact]
+    public void Test_Batch_Parsing()
+    {
+        var items = new[]
+        {
+            "data.dnv.com/IMO1234567/dnv-v2/vis-3-4a/621.21/S90/sec/411.1/C101/meta/qty-mass/cnt-fuel.oil/pos-inlet",
+            "data.dnv.com/IMO1234567/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet",
+            "data.dnv.com/IMO9074729/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet",
+            "data.dnv.com/IMO1234568/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet",
+            null,
+            "data.dnv.com/IMO9074729/dnv-v2/vis-3-7a/612.21/C701.23/C633/meta/calc~accumulate",
+        };
+
+        var universalIds = new UniversalId?[items.Length];
+        var parsed = UniversalId.TryParseAll(items, universalIds);
+
+        Assert.Equal(4, parsed);
+        Assert.Null(universalIds[3]);
+        Assert.Null(universalIds[4]);
+        for (var i = 0; i < items.Length; i++)
+        {
+            if (universalIds[i] is { } universalId)
+                Assert.Equal(UniversalId.Parse(items[i]!), universalId);
+        }
+        Assert.Equal(new ImoNumber(1234567), universalIds[1]!.ImoNumber);
+        Assert.Equal(new ImoNumber(9074729), universalIds[2]!.ImoNumber);
+
+        var valid = items.Where((_, i) => universalIds[i] is not null).Select(i => i!).ToArray();
+        Assert.Equal(universalIds.Where(u => u is not null), UniversalId.ParseAll(valid));
+        Assert.Throws<ArgumentException>(() => UniversalId.ParseAll(new[] { items[3]! }));
+
+        // The builder accepts a wrong naming entity, reporting it as an error
+        var ex = Assert.Throws<ArgumentException>(() => UniversalId.ParseAll(new[] { "other" + items[0]![8..] }));
+        Assert.Contains("Naming entity segment didnt match. Found: other.com", ex.Message);
+    }
 }
@@ -67,4 +67,44 @@ public void Test_OrderedVisVersions()
         var index310 = sortedVersions.IndexOf("3-10a");
         Assert.True(index34 < index310);
     }
+
+    [Fact]
+    public void Test_Registry()
+    {
+        var vis = new VIS();
+
+        var gmod = vis.GetGmod(VisVersion.v3_4a);
+        Assert.Same(gmod, vis.GetGmod(VisVersion.v3_4a));
+        Assert.Same(vis.GetCodebooks(VisVersion.v3_4a), vis.GetCodebooks(VisVersion.v3_4a));
+        Assert.Same(vis.GetLocations(VisVersion.v3_4a), vis.GetLocations(VisVersion.v3_4a));
+        Assert.Throws<ArgumentException>(() => vis.GetGmod((VisVersion)int.MaxValue));
+        Assert.Throws<ArgumentException>(() => vis.GetCodebooks((VisVersion)(-1)));
+        Assert.Throws<ArgumentException>(() => vis.GetLocations((VisVersion)int.MaxValue));
+
+        vis.Configure(new VisOptions { CacheMode = VisCacheMode.Expiring, SizeLimit = 2 });
+        var expiring = vis.GetGmod(VisVersion.v3_4a);
+        Assert.NotSame(gmod, expiring);
+        Assert.Same(expiring, vis.GetGmod(VisVersion.v3_4a));
+        Assert.Equal(gmod.Count(), expiring.Count());
+
+        Assert.Throws<ArgumentException>(() => vis.Configure(new VisOptions { SizeLimit = 0 }));
+        Assert.Throws<ArgumentException>(() => new VIS(new VisOptions { CacheMode = (VisCacheMode)42 }));
+    }
+
+    [Fact]
+    public async Task Test_Preload()
+    {
+        var vis = new VIS();
+        var versions = new[] { VisVersion.v3_4a, VisVersion.v3_5a };
+
+        await vis.PreloadAsync(versions);
+
+        var gmods = versions.Select(v => vis.GetGmod(v)).ToArray();
+        var tasks = Enumerable.Range(0, 8).Select(_ => Task.Run(() => vis.GetGmod(VisVersion.v3_4a))).ToArray();
+        foreach (var gmod in await Task.WhenAll(tasks))
+            Assert.Same(gmods[0], gmod);
+        Assert.Equal(VisVersion.v3_5a, gmods[1].VisVersion);
+
+        await Assert.ThrowsAsync<ArgumentException>(() => vis.PreloadAsync(new[] { (VisVersion)int.MaxValue }));
+    }
 }
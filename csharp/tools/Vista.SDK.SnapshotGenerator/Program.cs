@@ -0,0 +1,40 @@
+using System.IO.Compression;
+using System.Text.Json;
+using Vista.SDK;
+using Vista.SDK.Internal;
+
+// Produces a GmodSnapshot for each gmod-vis-*.json.gz resource, embedded into Vista.SDK at build time.
+// Usage: Vista.SDK.SnapshotGenerator <output directory> <gmod resource>...
+
+if (args.Length < 2)
+{
+    Console.Error.WriteLine("Usage: Vista.SDK.SnapshotGenerator <output directory> <gmod resource>...");
+    return 1;
+}
+
+var outputDirectory = args[0];
+Directory.CreateDirectory(outputDirectory);
+
+foreach (var resource in args.Skip(1))
+{
+    GmodDto dto;
+    using (var stream = new GZipStream(File.OpenRead(resource), CompressionMode.Decompress))
+    {
+        dto =
+            JsonSerializer.Deserialize<GmodDto>(stream)
+            ?? throw new InvalidOperationException($"Could not deserialize Gmod resource '{resource}'");
+    }
+
+    var snapshot = GmodSnapshot.Create(dto);
+
+    var fileName = Path.GetFileName(resource);
+    fileName = fileName.Substring(0, fileName.Length - ".json.gz".Length) + GmodSnapshot.FileExtension;
+    var outputPath = Path.Combine(outputDirectory, fileName);
+
+    using (var output = File.Create(outputPath))
+        snapshot.WriteTo(output);
+
+    Console.WriteLine($"Generated {outputPath} ({snapshot.Nodes.Length} nodes, {snapshot.Strings.Length} strings)");
+}
+
+return 0;
@@ -24,6 +24,37 @@ export class Client {
         );
     }
 
+    /**
+     * Fetches the Gmod unless it still has the ETag of a cached copy
+     * @returns No dto when the server answered 304 Not Modified
+     */
+    public static async visGetGmodIfNoneMatch(
+        version: VisVersion,
+        etag?: string
+    ): Promise<{ dto?: GmodDto; etag?: string }> {
+        const url = `${this.API_URL}gmod-vis-${VisVersionExtension.toString(
+            version
+        )}.json`;
+
+        const response = await fetch(
+            url,
+            etag ? { headers: { "If-None-Match": etag } } : undefined
+        );
+        if (response.status === 304) return { etag };
+        if (response.ok) {
+            return {
+                dto: (await response.json()) as GmodDto,
+                etag: response.headers.get("ETag") ?? undefined,
+            };
+        }
+
+        throw new Error(
+            `Failed to fetch gmod version ${VisVersionExtension.toString(
+                version
+            )}: ${response.statusText}.`
+        );
+    }
+
     public static async visGetCodebooks(
         version: VisVersion
     ): Promise<CodebooksDto> {
@@ -0,0 +1,48 @@
+import * as fs from "fs/promises";
+import * as path from "path";
+import { GmodBinaryCache, GmodBinaryCacheEntry } from "./GmodBinaryCache";
+
+/** Stores binary Gmods as files in a directory, for Node.js */
+export class FileSystemGmodBinaryCache implements GmodBinaryCache {
+    public constructor(private readonly directory: string) {}
+
+    public async get(key: string): Promise<GmodBinaryCacheEntry | undefined> {
+        const file = path.join(this.directory, key);
+        try {
+            const data = await fs.readFile(file + ".bin");
+            const etag = await fs
+                .readFile(file + ".etag", "utf8")
+                .catch(() => undefined);
+            // Buffers can be views into a shared pool
+            return {
+                data: data.buffer.slice(
+                    data.byteOffset,
+                    data.byteOffset + data.byteLength
+                ),
+                etag,
+            };
+        } catch {
+            return undefined;
+        }
+    }
+
+    public async set(key: string, entry: GmodBinaryCacheEntry): Promise<void> {
+        const file = path.join(this.directory, key);
+        await fs.mkdir(this.directory, { recursive: true });
+
+        await FileSystemGmodBinaryCache.write(
+            file + ".bin",
+            new Uint8Array(entry.data)
+        );
+        if (entry.etag)
+            await FileSystemGmodBinaryCache.write(file + ".etag", entry.etag);
+        else await fs.rm(file + ".etag", { force: true });
+    }
+
+    // Renamed into place, so other processes never read half a file
+    private static async write(file: string, data: Uint8Array | string) {
+        const temporary = `${file}.${process.pid}.tmp`;
+        await fs.writeFile(temporary, data);
+        await fs.rename(temporary, file);
+    }
+}
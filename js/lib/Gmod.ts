@@ -1,4 +1,5 @@
 import { GmodNode } from "./GmodNode";
+import { GmodBinary } from "./internal/GmodBinary";
 import { GmodPath } from "./GmodPath";
 import { Locations } from "./Location";
 import {
@@ -21,11 +22,21 @@ export class Gmod {
     public visVersion: VisVersion;
     private _rootNode: GmodNode;
     private _nodeMap: Map<string, GmodNode>;
+    private _binary?: GmodBinary;
 
-    public constructor(visVersion: VisVersion, dto: GmodDto) {
+    public constructor(visVersion: VisVersion, dto: GmodDto);
+    public constructor(visVersion: VisVersion, binary: GmodBinary);
+    public constructor(visVersion: VisVersion, source: GmodDto | GmodBinary) {
         this.visVersion = visVersion;
 
         this._nodeMap = new Map<string, GmodNode>();
+        if (source instanceof GmodBinary) {
+            this._binary = source;
+            this._rootNode = source.rootNode;
+            return;
+        }
+
+        const dto = source;
         let rootNodeId: string | undefined = undefined;
         for (const nodeDto of dto.items) {
             const node = GmodNode.createFromDto(visVersion, nodeDto);
@@ -63,6 +74,27 @@ export class Gmod {
         this._rootNode = rootNode;
     }
 
+    /**
+     * Compiles the dto to the compact binary form read by
+     * {@link Gmod.fromBinary}, with the relations resolved and sorted
+     * so it can be stored or shipped instead of the JSON
+     */
+    public static toBinary(dto: GmodDto): ArrayBuffer {
+        return GmodBinary.encode(dto);
+    }
+
+    /**
+     * Loads a Gmod from {@link Gmod.toBinary} output without building the
+     * graph, nodes are created on first access and their relations when read
+     * @throws If the buffer is not a binary Gmod for the VIS version
+     */
+    public static fromBinary(
+        visVersion: VisVersion,
+        buffer: ArrayBuffer
+    ): Gmod {
+        return new Gmod(visVersion, GmodBinary.decode(buffer, visVersion));
+    }
+
     public get rootNode() {
         return this._rootNode;
     }
@@ -141,7 +173,9 @@ export class Gmod {
     }
 
     public tryGetNode(key: string, location?: string): GmodNode | undefined {
-        const node = this._nodeMap.get(key);
+        const node = this._binary
+            ? this._binary.tryGetNode(key)
+            : this._nodeMap.get(key);
         if (!node) return;
         return node;
     }
@@ -268,6 +302,10 @@ export class Gmod {
     }
 
     public *[Symbol.iterator](): Generator<GmodNode> {
+        if (this._binary) {
+            yield* this._binary.nodes();
+            return;
+        }
         for (const [_, value] of this._nodeMap) yield value;
     }
 }
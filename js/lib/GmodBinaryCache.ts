@@ -0,0 +1,66 @@
+export type GmodBinaryCacheEntry = {
+    data: ArrayBuffer;
+    /** ETag of the downloaded Gmod, to ask the server if it has changed */
+    etag?: string;
+};
+
+/**
+ * Persistent store for binary Gmods, see {@link VIS.useGmodBinaryCache}.
+ * Keys are the resource names, like gmod-vis-3-4a
+ */
+export interface GmodBinaryCache {
+    get(key: string): Promise<GmodBinaryCacheEntry | undefined>;
+    set(key: string, entry: GmodBinaryCacheEntry): Promise<void>;
+}
+
+/** Stores binary Gmods in an IndexedDB object store, for browsers */
+export class IndexedDbGmodBinaryCache implements GmodBinaryCache {
+    private _db?: Promise<IDBDatabase>;
+
+    public constructor(
+        private readonly databaseName = "dnv-vista-sdk",
+        private readonly storeName = "gmod"
+    ) {}
+
+    public async get(key: string): Promise<GmodBinaryCacheEntry | undefined> {
+        const db = await this.open();
+        return await IndexedDbGmodBinaryCache.request<
+            GmodBinaryCacheEntry | undefined
+        >(
+            db
+                .transaction(this.storeName, "readonly")
+                .objectStore(this.storeName)
+                .get(key)
+        );
+    }
+
+    public async set(key: string, entry: GmodBinaryCacheEntry): Promise<void> {
+        const db = await this.open();
+        await IndexedDbGmodBinaryCache.request(
+            db
+                .transaction(this.storeName, "readwrite")
+                .objectStore(this.storeName)
+                .put(entry, key)
+        );
+    }
+
+    private open(): Promise<IDBDatabase> {
+        if (!this._db) {
+            if (typeof indexedDB === "undefined")
+                return Promise.reject(new Error("IndexedDB is not available"));
+
+            const request = indexedDB.open(this.databaseName, 1);
+            request.onupgradeneeded = () =>
+                request.result.createObjectStore(this.storeName);
+            this._db = IndexedDbGmodBinaryCache.request(request);
+        }
+        return this._db;
+    }
+
+    private static request<T>(request: IDBRequest<T>): Promise<T> {
+        return new Promise((resolve, reject) => {
+            request.onsuccess = () => resolve(request.result);
+            request.onerror = () => reject(request.error);
+        });
+    }
+}
@@ -13,6 +13,7 @@ export class GmodNode {
     private _location?: Location;
     private _children: GmodNode[];
     private _parents: GmodNode[];
+    private _relations?: () => [children: GmodNode[], parents: GmodNode[]];
 
     private constructor(previous: GmodNode);
     private constructor(
@@ -40,8 +41,8 @@ export class GmodNode {
             this.code = previous.code;
             this.metadata = previous.metadata;
             this._location = previous._location;
-            this._children = previous._children;
-            this._parents = previous._parents;
+            this._children = previous.children;
+            this._parents = previous.parents;
         } else {
             this._id = arg1;
             this._visVersion = visVersion!;
@@ -115,6 +116,22 @@ export class GmodNode {
         );
     }
 
+    /**
+     * Creates a node whose relations are only resolved on first access,
+     * see {@link Gmod.fromBinary}
+     */
+    public static createLazy(
+        id: string,
+        visVersion: VisVersion,
+        code: string,
+        metadata: GmodNodeMetadata,
+        relations: () => [children: GmodNode[], parents: GmodNode[]]
+    ) {
+        const node = new GmodNode(id, visVersion, code, metadata);
+        node._relations = relations;
+        return node;
+    }
+
     public withEmptyRelations(): GmodNode {
         return new GmodNode(
             this._id,
@@ -190,13 +207,22 @@ export class GmodNode {
     }
 
     public get children() {
+        if (this._relations) this.resolveRelations();
         return this._children;
     }
 
     public get parents() {
+        if (this._relations) this.resolveRelations();
         return this._parents;
     }
 
+    private resolveRelations() {
+        const [children, parents] = this._relations!();
+        this._relations = undefined;
+        this._children = children;
+        this._parents = parents;
+    }
+
     public get isMappable() {
         if (!!this.productType) return false;
         if (!!this.productSelection) return false;
@@ -220,20 +246,22 @@ export class GmodNode {
     }
 
     public get productType(): GmodNode | undefined {
-        if (this._children.length !== 1) return;
+        const children = this.children;
+        if (children.length !== 1) return;
         if (!this.metadata.category.includes("FUNCTION")) return;
 
-        const child = this._children[0];
+        const child = children[0];
         if (child.metadata.category !== "PRODUCT") return;
         if (child.metadata.type !== "TYPE") return;
         return child;
     }
 
     public get productSelection(): GmodNode | undefined {
-        if (this._children.length != 1) return;
+        const children = this.children;
+        if (children.length != 1) return;
         if (!this.metadata.category.includes("FUNCTION")) return;
 
-        const child = this._children[0];
+        const child = children[0];
         if (!child.metadata.category.includes("PRODUCT")) return;
         if (child.metadata.type !== "SELECTION") return;
 
@@ -247,8 +275,9 @@ export class GmodNode {
     }
 
     private isChildFromCode(code: string) {
-        for (let i = 0; i < this._children.length; i++) {
-            if (this._children[i].code == code) return true;
+        const children = this.children;
+        for (let i = 0; i < children.length; i++) {
+            if (children[i].code == code) return true;
         }
 
         return false;
@@ -268,11 +297,11 @@ export class GmodNode {
     }
 
     public addChild(child: GmodNode) {
-        this._children.push(child);
+        this.children.push(child);
     }
 
     public addParent(parent: GmodNode) {
-        this._parents.push(parent);
+        this.parents.push(parent);
     }
 
     private getSortedString(node: GmodNode) {
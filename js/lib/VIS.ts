@@ -8,6 +8,7 @@ import { Gmod } from "./Gmod";
 import { Codebooks } from "./Codebooks";
 import { LocationsDto } from "./types/LocationDto";
 import { Locations } from "./Location";
+import { GmodBinaryCache } from "./GmodBinaryCache";
 
 export class VIS {
     public static readonly instance = new VIS();
@@ -26,6 +27,8 @@ export class VIS {
         Promise<LocationsDto>
     >;
     private readonly _locationCache: LRUCache<VisVersion, Locations>;
+    private _gmodBinaryCache?: GmodBinaryCache;
+    private _revalidateGmodBinaryCache = false;
 
     public constructor() {
         this._gmodDtoCache = new LRUCache(this.options);
@@ -62,11 +65,68 @@ export class VIS {
             return gmod;
         }
 
-        gmod = new Gmod(visVersion, await this.getGmodDto(visVersion));
+        gmod = this._gmodBinaryCache
+            ? await this.getBinaryGmod(visVersion, this._gmodBinaryCache)
+            : new Gmod(visVersion, await this.getGmodDto(visVersion));
         this._gmodCache.set(visVersion, gmod);
         return gmod;
     }
 
+    /**
+     * Loads Gmods from compact binaries kept in the cache, so later startups
+     * skip both the download and building the graph,
+     * see {@link Gmod.fromBinary}.
+     * Gmods missing from the cache are downloaded and stored in it.
+     * @param options.revalidate Ask the server if the cached Gmod has changed,
+     * by its ETag. Published VIS versions do not change, so it is off by default
+     */
+    public useGmodBinaryCache(
+        cache: GmodBinaryCache | undefined,
+        options?: { revalidate?: boolean }
+    ) {
+        this._gmodBinaryCache = cache;
+        this._revalidateGmodBinaryCache = options?.revalidate ?? false;
+    }
+
+    private async getBinaryGmod(
+        visVersion: VisVersion,
+        cache: GmodBinaryCache
+    ): Promise<Gmod> {
+        const key = `gmod-vis-${VisVersionExtension.toString(visVersion)}`;
+        const cached = await cache.get(key);
+        let gmod: Gmod | undefined;
+        if (cached) {
+            try {
+                gmod = Gmod.fromBinary(visVersion, cached.data);
+            } catch {
+                // Entries of an other binary format or VIS version
+                // are downloaded again
+            }
+        }
+        if (gmod && !this._revalidateGmodBinaryCache) return gmod;
+
+        let response: Awaited<ReturnType<typeof Client.visGetGmodIfNoneMatch>>;
+        try {
+            response = await Client.visGetGmodIfNoneMatch(
+                visVersion,
+                gmod ? cached?.etag : undefined
+            );
+        } catch (e) {
+            // Offline, the cached copy is still better than nothing
+            if (gmod) return gmod;
+            throw e;
+        }
+
+        if (!response.dto) {
+            if (!gmod) throw new Error("Gmod not modified, but not cached");
+            return gmod;
+        }
+
+        const data = Gmod.toBinary(response.dto);
+        await cache.set(key, { data, etag: response.etag });
+        return Gmod.fromBinary(visVersion, data);
+    }
+
     public async getGmodsMap(
         visVersions: VisVersion[]
     ): Promise<Map<VisVersion, Gmod>> {
@@ -40,9 +40,20 @@ import {
 import * as Experimental from "./experimental";
 import { TreeNode } from "./types/Tree";
 import { ILocalIdBuilder, ILocalIdBuilderGeneric } from "./ILocalIdBuilder";
+import {
+    GmodBinaryCache,
+    GmodBinaryCacheEntry,
+    IndexedDbGmodBinaryCache,
+} from "./GmodBinaryCache";
 
 // Types
-export type { GmodNodeMetadata, PmodInfo, TreeNode };
+export type {
+    GmodNodeMetadata,
+    PmodInfo,
+    TreeNode,
+    GmodBinaryCache,
+    GmodBinaryCacheEntry,
+};
 // VisVersion
 export { VisVersion, VisVersionExtension, VisVersions };
 // VIS
@@ -74,6 +85,7 @@ export { UniversalIdParser, UniversalIdBuilder, UniversalId };
 
 // Gmod
 export { Gmod, GmodNode, GmodPath, GmodIndividualizableSet };
+export { IndexedDbGmodBinaryCache };
 // Pmod
 export { Pmod, PmodNode, NotRelevant };
 // Client
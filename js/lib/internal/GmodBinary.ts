@@ -0,0 +1,440 @@
+import { GmodNode } from "../GmodNode";
+import { GmodDto } from "../types/GmodDto";
+import { naturalSort } from "../util/util";
+import { VisVersion, VisVersionExtension } from "../VisVersion";
+
+// "VGMB" read as a little endian uint32, so big endian buffers fail the check
+const MAGIC = 0x424d4756;
+const FORMAT_VERSION = 1;
+const NONE = 0xffffffff;
+
+const HEADER_WORDS = 9;
+// key, code, category, type, name, commonName, definition, commonDefinition,
+// and installSubstructure as 0 for missing, 1 for false and 2 for true
+const NODE_WORDS = 9;
+
+const encoder = new TextEncoder();
+const decoder = new TextDecoder();
+
+/**
+ * Compact binary form of a Gmod, with the relations already resolved and sorted,
+ * so loading one only creates typed array views, and nodes are created on first
+ * access.
+ *
+ * The buffer is a uint32 section followed by the UTF-8 bytes of the strings:
+ * - header: magic, format version, VIS release string, the node, string, byte,
+ *   relation and assignment counts, and the root node index
+ * - string offsets into the bytes, string count + 1
+ * - nodes, NODE_WORDS values per node in the order of the dto items,
+ *   string indexes or NONE for missing values
+ * - children and parents, each as node count + 1 offsets followed by the
+ *   related node indexes
+ * - normal assignment names, node count + 1 offsets followed by key and value
+ *   string index pairs
+ *
+ * Decoding checks every offset and index once, so a corrupt buffer throws
+ * instead of resolving to the wrong strings or nodes later.
+ */
+export class GmodBinary {
+    public readonly visVersion: VisVersion;
+    private readonly _words: Uint32Array;
+    private readonly _bytes: Uint8Array;
+    private readonly _nodeCount: number;
+    private readonly _rootIndex: number;
+    private readonly _stringsStart: number;
+    private readonly _nodesStart: number;
+    private readonly _childrenStart: number;
+    private readonly _parentsStart: number;
+    private readonly _assignmentsStart: number;
+    private readonly _strings: (string | undefined)[];
+    private readonly _nodes: (GmodNode | undefined)[];
+    private _keys?: Map<string, number>;
+
+    private constructor(visVersion: VisVersion, buffer: ArrayBuffer) {
+        const header = GmodBinary.readHeader(buffer);
+        if (!header) throw new Error("Invalid binary Gmod");
+
+        const [
+            nodeCount,
+            stringCount,
+            byteCount,
+            relationCount,
+            assignmentCount,
+            rootIndex,
+        ] = header;
+        const wordCount = GmodBinary.wordCount(
+            nodeCount,
+            stringCount,
+            relationCount,
+            assignmentCount
+        );
+        if (buffer.byteLength !== wordCount * 4 + byteCount)
+            throw new Error("Invalid binary Gmod, unexpected length");
+
+        this.visVersion = visVersion;
+        this._words = new Uint32Array(buffer, 0, wordCount);
+        this._bytes = new Uint8Array(buffer, wordCount * 4, byteCount);
+        this._nodeCount = nodeCount;
+        this._rootIndex = rootIndex;
+        this._stringsStart = HEADER_WORDS;
+        this._nodesStart = this._stringsStart + stringCount + 1;
+        this._childrenStart = this._nodesStart + nodeCount * NODE_WORDS;
+        this._parentsStart =
+            this._childrenStart + nodeCount + 1 + relationCount;
+        this._assignmentsStart =
+            this._parentsStart + nodeCount + 1 + relationCount;
+        this._strings = new Array(stringCount);
+        this._nodes = new Array(nodeCount);
+        this.validate(stringCount, byteCount, relationCount, assignmentCount);
+
+        const release = this.string(this._words[2]);
+        const expected = VisVersionExtension.toString(visVersion);
+        if (release !== expected)
+            throw new Error(
+                `Binary Gmod is for VIS ${release}, expected ${expected}`
+            );
+    }
+
+    public static decode(buffer: ArrayBuffer, visVersion: VisVersion) {
+        return new GmodBinary(visVersion, buffer);
+    }
+
+    /** Encodes the Gmod of the dto, in the shape the Gmod constructor gives it */
+    public static encode(dto: GmodDto): ArrayBuffer {
+        const strings: string[] = [];
+        const stringIndexes = new Map<string, number>();
+        const intern = (value?: string | null) => {
+            if (value === undefined || value === null) return NONE;
+            let index = stringIndexes.get(value);
+            if (index === undefined) {
+                index = strings.length;
+                strings.push(value);
+                stringIndexes.set(value, index);
+            }
+            return index;
+        };
+
+        const release = intern(dto.visRelease);
+        const nodeCount = dto.items.length;
+        const nodeIndexes = new Map<string, number>();
+        const nodes: number[] = [];
+        const assignments: number[][] = [];
+        let rootIndex = NONE;
+        for (let i = 0; i < nodeCount; i++) {
+            const item = dto.items[i];
+            const key = item.id ?? item.code;
+            if (item.code === "VE") rootIndex = i;
+            nodeIndexes.set(key, i);
+
+            nodes.push(
+                intern(key),
+                intern(item.code),
+                intern(item.category),
+                intern(item.type),
+                intern(item.name),
+                intern(item.commonName),
+                intern(item.definition),
+                intern(item.commonDefinition),
+                item.installSubstructure === undefined ||
+                    item.installSubstructure === null
+                    ? 0
+                    : item.installSubstructure
+                    ? 2
+                    : 1
+            );
+            assignments.push(
+                Object.entries(item.normalAssignmentNames ?? {}).flatMap(
+                    ([key, value]) => [intern(key), intern(value)]
+                )
+            );
+        }
+        if (rootIndex === NONE) throw new Error("Couldnt find root node");
+
+        // The order the Gmod constructor adds them in, without sorting the dto
+        const relations = dto.relations
+            .slice()
+            .sort(([_, a], [__, b]) => naturalSort(a, b));
+        const children: number[][] = dto.items.map(() => []);
+        const parents: number[][] = dto.items.map(() => []);
+        for (const [parentCode, childCode] of relations) {
+            const parent = nodeIndexes.get(parentCode);
+            const child = nodeIndexes.get(childCode);
+            if (parent === undefined)
+                throw new Error(
+                    "Couldnt find parent node with code: " + parentCode
+                );
+            if (child === undefined)
+                throw new Error(
+                    "Couldnt find child node with code: " + childCode
+                );
+
+            children[parent].push(child);
+            parents[child].push(parent);
+        }
+
+        const encoded = strings.map((s) => encoder.encode(s));
+        const byteCount = encoded.reduce((sum, b) => sum + b.length, 0);
+        const assignmentCount = assignments.reduce(
+            (sum, a) => sum + a.length / 2,
+            0
+        );
+        const wordCount = GmodBinary.wordCount(
+            nodeCount,
+            strings.length,
+            relations.length,
+            assignmentCount
+        );
+
+        const buffer = new ArrayBuffer(wordCount * 4 + byteCount);
+        const words = new Uint32Array(buffer, 0, wordCount);
+        const bytes = new Uint8Array(buffer, wordCount * 4, byteCount);
+        words.set([
+            MAGIC,
+            FORMAT_VERSION,
+            release,
+            nodeCount,
+            strings.length,
+            byteCount,
+            relations.length,
+            assignmentCount,
+            rootIndex,
+        ]);
+
+        let position = HEADER_WORDS;
+        let offset = 0;
+        for (const b of encoded) {
+            words[position++] = offset;
+            bytes.set(b, offset);
+            offset += b.length;
+        }
+        words[position++] = offset;
+
+        words.set(nodes, position);
+        position += nodes.length;
+
+        for (const section of [children, parents, assignments]) {
+            let count = 0;
+            for (const values of section) {
+                words[position++] = count;
+                count += values.length;
+            }
+            words[position++] = count;
+            for (const values of section) {
+                words.set(values, position);
+                position += values.length;
+            }
+        }
+
+        return buffer;
+    }
+
+    private validate(
+        stringCount: number,
+        byteCount: number,
+        relationCount: number,
+        assignmentCount: number
+    ) {
+        const words = this._words;
+        const fail = (section: string) => {
+            throw new Error(`Invalid binary Gmod, corrupt ${section}`);
+        };
+        const checkOffsets = (
+            section: string,
+            start: number,
+            count: number,
+            end: number
+        ) => {
+            if (words[start] !== 0 || words[start + count] !== end)
+                fail(section);
+            for (let i = start; i < start + count; i++)
+                if (words[i] > words[i + 1]) fail(section);
+        };
+        const checkIndexes = (
+            section: string,
+            start: number,
+            count: number,
+            bound: number
+        ) => {
+            for (let i = start; i < start + count; i++)
+                if (words[i] >= bound) fail(section);
+        };
+
+        checkOffsets("strings", this._stringsStart, stringCount, byteCount);
+        if (words[2] >= stringCount) fail("header");
+        if (this._rootIndex >= this._nodeCount) fail("header");
+
+        for (let i = 0; i < this._nodeCount; i++) {
+            const start = this._nodesStart + i * NODE_WORDS;
+            // key, code, category and type are required
+            checkIndexes("nodes", start, 4, stringCount);
+            for (let j = start + 4; j < start + 8; j++)
+                if (words[j] !== NONE && words[j] >= stringCount)
+                    fail("nodes");
+            if (words[start + 8] > 2) fail("nodes");
+        }
+
+        for (const [section, start] of [
+            ["children", this._childrenStart],
+            ["parents", this._parentsStart],
+        ] as const) {
+            checkOffsets(section, start, this._nodeCount, relationCount);
+            checkIndexes(
+                section,
+                start + this._nodeCount + 1,
+                relationCount,
+                this._nodeCount
+            );
+        }
+
+        checkOffsets(
+            "assignments",
+            this._assignmentsStart,
+            this._nodeCount,
+            assignmentCount * 2
+        );
+        // Offsets of key and value pairs
+        const assignmentsEnd = this._assignmentsStart + this._nodeCount;
+        for (let i = this._assignmentsStart; i < assignmentsEnd; i++)
+            if (words[i] % 2 !== 0) fail("assignments");
+        checkIndexes(
+            "assignments",
+            this._assignmentsStart + this._nodeCount + 1,
+            assignmentCount * 2,
+            stringCount
+        );
+    }
+
+    public get rootNode() {
+        return this.node(this._rootIndex);
+    }
+
+    public tryGetNode(key: string): GmodNode | undefined {
+        const index = this.keys.get(key);
+        return index === undefined ? undefined : this.node(index);
+    }
+
+    public *nodes(): Generator<GmodNode> {
+        for (let i = 0; i < this._nodeCount; i++) yield this.node(i);
+    }
+
+    private get keys() {
+        // Decoding the keys is far cheaper than creating the nodes
+        if (!this._keys) {
+            this._keys = new Map<string, number>();
+            for (let i = 0; i < this._nodeCount; i++)
+                this._keys.set(
+                    this.string(this._words[this._nodesStart + i * NODE_WORDS]),
+                    i
+                );
+        }
+        return this._keys;
+    }
+
+    private node(index: number): GmodNode {
+        const existing = this._nodes[index];
+        if (existing) return existing;
+
+        const words = this._words;
+        const start = this._nodesStart + index * NODE_WORDS;
+        const normalAssignmentNames = new Map<string, string>();
+        const [from, to] = this.range(this._assignmentsStart, index);
+        const pairsStart = this._assignmentsStart + this._nodeCount + 1;
+        for (let i = pairsStart + from; i < pairsStart + to; i += 2)
+            normalAssignmentNames.set(
+                this.string(words[i]),
+                this.string(words[i + 1])
+            );
+
+        const installSubstructure = words[start + 8];
+        const node = GmodNode.createLazy(
+            this.string(words[start]),
+            this.visVersion,
+            this.string(words[start + 1]),
+            {
+                category: this.string(words[start + 2]),
+                type: this.string(words[start + 3]),
+                // Missing on a few nodes, which the JSON loading lets through too
+                name: this.optionalString(words[start + 4]) as string,
+                commonName: this.optionalString(words[start + 5]),
+                definition: this.optionalString(words[start + 6]),
+                commonDefinition: this.optionalString(words[start + 7]),
+                installSubstructure:
+                    installSubstructure === 0
+                        ? undefined
+                        : installSubstructure === 2,
+                normalAssignmentNames,
+            },
+            () => [
+                this.related(this._childrenStart, index),
+                this.related(this._parentsStart, index),
+            ]
+        );
+        this._nodes[index] = node;
+        return node;
+    }
+
+    private related(sectionStart: number, index: number): GmodNode[] {
+        const [from, to] = this.range(sectionStart, index);
+        const valuesStart = sectionStart + this._nodeCount + 1;
+        const nodes: GmodNode[] = new Array(to - from);
+        for (let i = from; i < to; i++)
+            nodes[i - from] = this.node(this._words[valuesStart + i]);
+        return nodes;
+    }
+
+    private range(sectionStart: number, index: number): [number, number] {
+        return [
+            this._words[sectionStart + index],
+            this._words[sectionStart + index + 1],
+        ];
+    }
+
+    private string(index: number): string {
+        const existing = this._strings[index];
+        if (existing !== undefined) return existing;
+
+        const offsets = this._stringsStart + index;
+        const value = decoder.decode(
+            this._bytes.subarray(this._words[offsets], this._words[offsets + 1])
+        );
+        this._strings[index] = value;
+        return value;
+    }
+
+    private optionalString(index: number): string | undefined {
+        return index === NONE ? undefined : this.string(index);
+    }
+
+    private static readHeader(buffer: ArrayBuffer) {
+        if (buffer.byteLength < HEADER_WORDS * 4) return undefined;
+        const header = new Uint32Array(buffer, 0, HEADER_WORDS);
+        if (header[0] !== MAGIC || header[1] !== FORMAT_VERSION)
+            return undefined;
+        return [
+            header[3],
+            header[4],
+            header[5],
+            header[6],
+            header[7],
+            header[8],
+        ] as const;
+    }
+
+    private static wordCount(
+        nodeCount: number,
+        stringCount: number,
+        relationCount: number,
+        assignmentCount: number
+    ) {
+        return (
+            HEADER_WORDS +
+            stringCount +
+            1 +
+            nodeCount * NODE_WORDS +
+            2 * (nodeCount + 1 + relationCount) +
+            nodeCount +
+            1 +
+            assignmentCount * 2
+        );
+    }
+}
@@ -0,0 +1,4 @@
+// Node.js only entry point, imported as dnv-vista-sdk/node
+import { FileSystemGmodBinaryCache } from "./FileSystemGmodBinaryCache";
+
+export { FileSystemGmodBinaryCache };
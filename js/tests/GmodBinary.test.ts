@@ -0,0 +1,120 @@
+import * as fs from "fs";
+import * as os from "os";
+import * as path from "path";
+import { Gmod, VIS, VisVersionExtension, VisVersions } from "../lib";
+import { FileSystemGmodBinaryCache } from "../lib/node";
+import { getVIS, getVISMap } from "./Fixture";
+
+const testVersions = VisVersions.all;
+
+beforeAll(async () => {
+    await getVISMap();
+});
+
+it.each(testVersions)("Binary gmod matches %s", async (version) => {
+    const { gmod } = getVIS(version);
+    const dto = await VIS.instance.getGmodDto(version);
+    const binary = Gmod.fromBinary(version, Gmod.toBinary(dto));
+
+    expect(binary.rootNode.code).toBe(gmod.rootNode.code);
+
+    const nodes = Array.from(gmod);
+    expect(Array.from(binary).map((n) => n.id)).toEqual(
+        nodes.map((n) => n.id)
+    );
+    for (const node of nodes) {
+        const other = binary.getNode(node.id);
+        expect(other.code).toBe(node.code);
+        expect(other.metadata).toEqual(node.metadata);
+        expect(other.children.map((n) => n.code)).toEqual(
+            node.children.map((n) => n.code)
+        );
+        expect(other.parents.map((n) => n.code)).toEqual(
+            node.parents.map((n) => n.code)
+        );
+    }
+});
+
+it("Binary gmod resolves relations to the same nodes", async () => {
+    const version = VIS.latestVisVersion;
+    const dto = await VIS.instance.getGmodDto(version);
+    const gmod = Gmod.fromBinary(version, Gmod.toBinary(dto));
+
+    const node = gmod.getNode("411.1");
+    expect(node.children.length).toBeGreaterThan(0);
+    for (const child of node.children) {
+        expect(gmod.getNode(child.id)).toBe(child);
+        expect(child.parents).toContain(node);
+    }
+    expect(gmod.tryGetNode("not a node")).toBeUndefined();
+});
+
+it("Binary gmod parses paths", async () => {
+    const version = VIS.latestVisVersion;
+    const { gmod, locations } = getVIS(version);
+    const dto = await VIS.instance.getGmodDto(version);
+    const binary = Gmod.fromBinary(version, Gmod.toBinary(dto));
+
+    const pathStr = "411.1/C101.31-2";
+    expect(binary.parsePath(pathStr, locations).toString()).toBe(
+        gmod.parsePath(pathStr, locations).toString()
+    );
+});
+
+it("Binary gmod rejects other versions", async () => {
+    const dto = await VIS.instance.getGmodDto(VIS.latestVisVersion);
+    const buffer = Gmod.toBinary(dto);
+
+    expect(() => Gmod.fromBinary(testVersions[0], buffer)).toThrowError();
+    expect(() =>
+        Gmod.fromBinary(VIS.latestVisVersion, buffer.slice(0, 100))
+    ).toThrowError();
+});
+
+it("Binary gmod rejects corrupt buffers", async () => {
+    const dto = await VIS.instance.getGmodDto(VIS.latestVisVersion);
+    const buffer = Gmod.toBinary(dto);
+    const [nodeCount, stringCount] = new Uint32Array(buffer, 12, 2);
+    const childrenStart = 9 + stringCount + 1 + nodeCount * 9;
+
+    const corrupt = (index: number, value: number) => {
+        const copy = buffer.slice(0);
+        new Uint32Array(copy)[index] = value;
+        return () => Gmod.fromBinary(VIS.latestVisVersion, copy);
+    };
+    // A string offset past the bytes, a node name and a child out of range
+    expect(corrupt(10, 0xfffffff0)).toThrowError(/strings/);
+    expect(corrupt(9 + stringCount + 1 + 4, stringCount)).toThrowError(
+        /nodes/
+    );
+    expect(corrupt(childrenStart + nodeCount + 1, nodeCount)).toThrowError(
+        /children/
+    );
+});
+
+it("File system cache", async () => {
+    const directory = fs.mkdtempSync(path.join(os.tmpdir(), "vista-gmod-"));
+    try {
+        const cache = new FileSystemGmodBinaryCache(directory);
+        expect(await cache.get("gmod-vis-3-4a")).toBeUndefined();
+
+        const dto = await VIS.instance.getGmodDto(VIS.latestVisVersion);
+        const data = Gmod.toBinary(dto);
+        await cache.set("gmod", { data, etag: '"etag"' });
+
+        const entry = await cache.get("gmod");
+        expect(entry?.etag).toBe('"etag"');
+        expect(new Uint8Array(entry!.data)).toEqual(new Uint8Array(data));
+
+        const vis = new VIS();
+        vis.useGmodBinaryCache(cache);
+        const key = `gmod-vis-${VisVersionExtension.toString(
+            VIS.latestVisVersion
+        )}`;
+        await cache.set(key, entry!);
+        const gmod = await vis.getGmod(VIS.latestVisVersion);
+        expect(gmod.rootNode.code).toBe("VE");
+    } finally {
+        fs.rmSync(directory, { recursive: true, force: true });
+    }
+});
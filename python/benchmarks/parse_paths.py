@@ -0,0 +1,82 @@
+"""Compares parsing the Gmod paths of testdata/LocalIds.txt one at a time with
+``GmodPath.try_parse`` to ``Gmod.parse_paths``, for unique and repeated paths.
+
+Run from the python directory, with the resources available as for the tests:
+
+    python -m benchmarks.parse_paths --repeat 20
+"""
+
+from __future__ import annotations
+
+import argparse
+import time
+from pathlib import Path
+from typing import Callable, List
+
+from vista_sdk.GmodPath import GmodPath
+from vista_sdk.VIS import VIS
+from vista_sdk.VisVersions import VisVersion, VisVersionExtension
+
+TESTDATA = Path(__file__).resolve().parents[2] / "testdata"
+
+
+def read_paths(vis_version: VisVersion) -> List[str]:
+    prefix = f"/dnv-v2/vis-{VisVersionExtension.to_version_string(vis_version)}/"
+    paths: List[str] = []
+    with open(TESTDATA / "LocalIds.txt") as file:
+        for line in file:
+            line = line.strip()
+            if line.startswith(prefix):
+                items = line[len(prefix) :].split("/meta")[0]
+                paths.extend(items.split("/sec/"))
+    return paths
+
+
+def measure(name: str, parse: Callable[[], list], baseline: float = 0) -> float:
+    start = time.perf_counter()
+    results = parse()
+    elapsed = time.perf_counter() - start
+    parsed = sum(1 for result in results if result is not None)
+    speedup = f", {baseline / elapsed:.1f}x" if baseline else ""
+    print(
+        f"{name:<40} {elapsed * 1000:>9.1f} ms "
+        f"{elapsed / len(results) * 1e6:>7.1f} us/path{speedup} ({parsed} parsed)"
+    )
+    return elapsed
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--repeat", type=int, default=10)
+    args = parser.parse_args()
+
+    vis_version = VisVersion.v3_4a
+    vis = VIS()
+    gmod = vis.get_gmod(vis_version)
+    vis.get_locations(vis_version)
+
+    unique = sorted(set(read_paths(vis_version)))
+    repeated = unique * args.repeat
+    print(f"{len(unique)} unique paths, repeated {args.repeat} times")
+
+    def each(paths: List[str]) -> Callable[[], list]:
+        return lambda: [GmodPath.try_parse(p, vis_version)[1] for p in paths]
+
+    def batch(paths: List[str], cold: bool) -> Callable[[], list]:
+        def run() -> list:
+            if cold:
+                gmod._found_paths.clear()
+            return gmod.parse_paths(paths)
+
+        return run
+
+    _ = gmod.tables  # built once, outside the measurements
+    baseline = measure("unique, try_parse", each(unique))
+    measure("unique, parse_paths, cold", batch(unique, True), baseline)
+    measure("unique, parse_paths, warm", batch(unique, False), baseline)
+    baseline = measure("repeated, try_parse", each(repeated))
+    measure("repeated, parse_paths, cold", batch(repeated, True), baseline)
+
+
+if __name__ == "__main__":
+    main()
@@ -51,6 +51,47 @@ class TestGmodPath(unittest.TestCase):
                 self.assertFalse(path[0])
                 self.assertIsNone(path[1])
 
+    def test_gmod_parse_paths(self):
+        items = self.gmod_test_data.valid + self.gmod_test_data.invalid
+        for vis_version in {item.vis_version for item in items}:
+            with self.subTest(vis_version=vis_version):
+                version = VisVersions.parse(vis_version)
+                gmod = self.vis.get_gmod(version)
+                paths = [item.path for item in items if item.vis_version == vis_version]
+                # Repeated items are parsed once, but each gets its own path
+                parsed = gmod.parse_paths(paths + paths)
+                self.assertEqual(2 * len(paths), len(parsed))
+                for i, input_path in enumerate(paths):
+                    expected = GmodPath.try_parse(input_path, version)[1]
+                    for path in (parsed[i], parsed[i + len(paths)]):
+                        if expected is None:
+                            self.assertIsNone(path, input_path)
+                            continue
+                        self.assertIsNotNone(path, input_path)
+                        self.assertEqual(expected, path)
+                        self.assertEqual(input_path, str(path))
+                        self.assertEqual(
+                            expected.to_full_path_string(), path.to_full_path_string()
+                        )
+                if paths:
+                    self.assertIsNot(parsed[0], parsed[len(paths)])
+
+    def test_gmod_parse_paths_individualizable_sets(self):
+        for item in self.test_individualizable_sets_data.data:
+            if item.is_full_path:
+                continue
+            with self.subTest(item=item):
+                gmod = self.vis.get_gmod(VisVersions.parse(item.vis_version))
+                path = gmod.parse_paths([item.path])[0]
+                if item.expected is None:
+                    self.assertIsNone(path)
+                    continue
+                self.assertIsNotNone(path)
+                sets = path.individualizable_sets
+                self.assertEqual(
+                    item.expected, [[n.code for n in s.nodes] for s in sets]
+                )
+
     def test_get_full_path(self):
         path_str = "411.1/C101.72/I101"
         expectation = {
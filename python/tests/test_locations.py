@@ -45,6 +45,16 @@ class TestLocations(unittest.TestCase):
         with self.assertRaises(ValueError):
             self.locations.parse("")
 
+    def test_locations_try_parse_many(self):
+        values = ["11FIPU", "1", "some_string", "", None, "11FIPU", "1A2"]
+        parsed = self.locations.try_parse_many(values)
+        self.assertEqual(len(values), len(parsed))
+        self.assertEqual("11FIPU", str(parsed[0]))
+        self.assertEqual("1", str(parsed[1]))
+        self.assertEqual([None, None, None], parsed[2:5])
+        self.assertEqual(parsed[0], parsed[5])
+        self.assertIsNone(parsed[6])
+
     def test_location_builder(self):
         location_str = "11FIPU"
         self.locations.parse(location_str)
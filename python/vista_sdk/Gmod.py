@@ -4,24 +4,33 @@ import inspect
 from dataclasses import dataclass, field
 from types import NoneType
 from typing import (
+    TYPE_CHECKING,
     Callable,
     Dict,
     Generic,
     Iterable,
     List,
     Optional,
+    Tuple,
     TypeVar,
     cast,
     overload,
 )
 
+from cachetools import LRUCache  # type: ignore
+
 from vista_sdk.GmodDto import GmodDto
 from vista_sdk.GmodNode import GmodNode, GmodNodeMetadata
 from vista_sdk.internal.ChdDictionary import ChdDictionary
+from vista_sdk.internal.GmodTables import GmodTables
 from vista_sdk.VisVersions import VisVersion
 
 from .TraversalHandlerResult import TraversalHandlerResult
 
+if TYPE_CHECKING:
+    from vista_sdk.GmodPath import GmodPath
+    from vista_sdk.Locations import Location, Locations
+
 TState = TypeVar("TState")
 
 TraversalHandler = Callable[[List[GmodNode], GmodNode], TraversalHandlerResult]
@@ -39,6 +48,7 @@ class TraversalOptions:
 class Gmod:
     PotentialParentScopeTypes = {"SELECTION", "GROUP", "LEAF"}
     LeafTypes = {"ASSET FUNCTION LEAF", "PRODUCT FUNCTION LEAF"}
+    MaxCachedPaths = 100_000
 
     def __init__(self, vis_version: VisVersion, dto: GmodDto):
         self.vis_version = vis_version
@@ -68,6 +78,8 @@ class Gmod:
         self._node_map = ChdDictionary(
             [(key, value) for key, value in node_map.items()]
         )
+        self._tables: Optional[GmodTables] = None
+        self._found_paths: LRUCache = LRUCache(maxsize=Gmod.MaxCachedPaths)
 
     @property
     def root_node(self) -> GmodNode:
@@ -168,6 +180,103 @@ class Gmod:
 
         return GmodPath.try_parse_full_path(item, arg=self.vis_version)
 
+    @property
+    def tables(self) -> GmodTables:
+        """Compact index tables of the nodes, built on first use."""
+        if self._tables is None:
+            self._tables = GmodTables([node for _, node in self._node_map])
+        return self._tables
+
+    def parse_paths(
+        self, items: Iterable[str], locations: Optional[Locations] = None
+    ) -> List[Optional[GmodPath]]:
+        """Parses many short paths at once, with the same results as parsing each.
+
+        The searches run over ``tables`` and are cached by their codes, and each
+        distinct item and location is only parsed once per call, so the repeated
+        paths of historical channel names cost little more than a lookup.
+
+        Returns:
+            The paths in the order of ``items``, None for the ones that don't parse
+        """
+        from vista_sdk.GmodPath import GmodPath
+        from vista_sdk.VIS import VIS
+
+        if locations is None:
+            locations = VIS().get_locations(self.vis_version)
+        if locations.vis_version != self.vis_version:
+            raise ValueError(
+                "Got different VIS versions for Gmod and Locations arguments"
+            )
+
+        parsed: Dict[str, Optional[Tuple[GmodNode, ...]]] = {}
+        location_strs: Dict[str, Optional[Location]] = {}
+        results: List[Optional[GmodPath]] = []
+        for item in items:
+            if item not in parsed:
+                parsed[item] = self._parse_path_nodes(item, locations, location_strs)
+            nodes = parsed[item]
+            results.append(
+                GmodPath(list(nodes[:-1]), nodes[-1]) if nodes is not None else None
+            )
+        return results
+
+    def _parse_path_nodes(
+        self,
+        item: str,
+        locations: Locations,
+        location_strs: Dict[str, Optional[Location]],
+    ) -> Optional[Tuple[GmodNode, ...]]:
+        if not item or item.isspace():
+            return None
+
+        tables = self.tables
+        codes: List[int] = []
+        part_locations: Dict[int, Location] = {}
+        location: Optional[Location] = None
+        for part in item.strip().lstrip("/").split("/"):
+            code, dash, location_str = part.partition("-")
+            node = tables.index.get(code)
+            if node is None:
+                return None
+            location = None
+            if dash:
+                if location_str not in location_strs:
+                    location_strs[location_str] = locations.try_parse_many(
+                        [location_str]
+                    )[0]
+                location = location_strs[location_str]
+                if location is None:
+                    return None
+                part_locations[node] = location
+            codes.append(node)
+
+        key = tuple(codes)
+        if key in self._found_paths:
+            found = self._found_paths[key]
+        else:
+            found = self._found_paths[key] = tables.find_path(key)
+        if found is None:
+            return None
+
+        # Locations apply to the nodes the search went through, not the ones above
+        path, traversal_start = found
+        path_locations: List[Optional[Location]] = [None] * len(path)
+        for i in range(traversal_start, len(path) - 1):
+            path_locations[i] = part_locations.get(path[i])
+        path_locations[-1] = location
+        try:
+            if not tables.location_sets(path, path_locations):
+                return None
+        except Exception:
+            return None
+
+        nodes = tables.nodes
+        return tuple(
+            nodes[n] if loc is None else nodes[n].clone(location=loc)
+            for n, loc in zip(path, path_locations)
+        )
+
     def check_signature(
         self, handler: TraversalHandler | TraversalHandlerWithState, param_count: int
     ):
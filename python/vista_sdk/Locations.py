@@ -1,7 +1,7 @@
 from __future__ import annotations
 
 from enum import Enum
-from typing import Dict, List, Optional, Tuple, overload
+from typing import Dict, Iterable, List, Optional, Tuple, overload
 
 from vista_sdk.LocationsDto import LocationsDto
 from vista_sdk.VisVersions import VisVersion
@@ -174,6 +174,24 @@ class Locations:
         else:
             raise ValueError("Invalid value for location")
 
+    def try_parse_many(
+        self, values: Iterable[Optional[str]]
+    ) -> List[Optional[Location]]:
+        """Validates many location strings at once, None for the invalid ones.
+
+        Each distinct value is only validated once, as bulk data repeats a few.
+        """
+        parsed: Dict[Optional[str], Optional[Location]] = {}
+        result: List[Optional[Location]] = []
+        for value in values:
+            if value not in parsed:
+                valid, location = self.try_parse_internal(
+                    value if value else "", value, LocationParsingErrorBuilder.create()
+                )
+                parsed[value] = location if valid else None
+            result.append(parsed[value])
+        return result
+
     def try_parse_with_errors(
         self, value: Optional[str]
     ) -> Tuple[bool, Optional[Location], ParsingErrors]:
@@ -0,0 +1,235 @@
+from __future__ import annotations
+
+import sys
+from array import array
+from typing import TYPE_CHECKING, Dict, List, Optional, Sequence, Tuple
+
+if TYPE_CHECKING:
+    from vista_sdk.GmodNode import GmodNode
+    from vista_sdk.Locations import Location
+
+# Node flags, computed once from the metadata so traversals only test bits
+LEAF = 1
+POTENTIAL_PARENT = 2
+NO_SUBSTRUCTURE = 4
+FUNCTION = 8
+PRODUCT_SELECTION = 16
+INDIVIDUALIZABLE = 32
+FUNCTION_COMPOSITION = 64
+
+_CONTINUE = 0
+_SKIP_SUBTREE = 1
+_STOP = 2
+
+
+class GmodTables:
+    """Flat tables of the nodes and relations of a Gmod, for batch parsing.
+
+    Nodes are numbered by their position in ``nodes``, codes are interned and
+    relations are stored as offsets into flat index arrays, children in the
+    same order as ``GmodNode.children``, so traversals visit nodes in the same
+    order as ``Gmod.traverse``.
+    """
+
+    def __init__(self, nodes: Sequence[GmodNode]):
+        from vista_sdk.Gmod import Gmod
+
+        self.nodes: List[GmodNode] = list(nodes)
+        self.index: Dict[str, int] = {
+            sys.intern(node.code): i for i, node in enumerate(self.nodes)
+        }
+        self.root = self.index["VE"]
+        self.flags = array("B")
+        self.child_offsets = array("I", [0])
+        self.children = array("I")
+        self.parent_offsets = array("I", [0])
+        self.parents = array("I")
+
+        for node in self.nodes:
+            metadata = node.metadata
+            flags = 0
+            if Gmod.is_leaf_node(metadata.full_type):
+                flags |= LEAF
+            if Gmod.is_potential_parent(metadata.type):
+                flags |= POTENTIAL_PARENT
+            if metadata.install_substructure is False:
+                flags |= NO_SUBSTRUCTURE
+            if "FUNCTION" in metadata.category:
+                flags |= FUNCTION
+            if "PRODUCT" in metadata.category and metadata.type == "SELECTION":
+                flags |= PRODUCT_SELECTION
+            if node.is_individualizable():
+                flags |= INDIVIDUALIZABLE
+            if node.is_function_composition:
+                flags |= FUNCTION_COMPOSITION
+            self.flags.append(flags)
+
+            self.children.extend(self.index[c.code] for c in node.children)
+            self.child_offsets.append(len(self.children))
+            self.parents.extend(self.index[p.code] for p in node.parents)
+            self.parent_offsets.append(len(self.parents))
+
+    def parent_count(self, node: int) -> int:
+        return self.parent_offsets[node + 1] - self.parent_offsets[node]
+
+    def first_parent(self, node: int) -> int:
+        return self.parents[self.parent_offsets[node]]
+
+    def is_individualizable(self, node: int, is_target: bool, is_in_set: bool):
+        flags = self.flags[node]
+        if flags & INDIVIDUALIZABLE:
+            return True
+        return bool(flags & FUNCTION_COMPOSITION) and (is_target or is_in_set)
+
+    def find_path(self, codes: Sequence[int]) -> Optional[Tuple[Tuple[int, ...], int]]:
+        """Finds the full path through the short path codes, with the search of
+        ``GmodPath.parse``: a depth first traversal from the first code that
+        finds the codes in order, skipping leaf subtrees that don't match.
+
+        Returns:
+            The node numbers from the root to the last code, and how many of the
+            leading nodes were added above the first code, or None
+        """
+        flags = self.flags
+        child_offsets = self.child_offsets
+        children = self.children
+        stack: List[int] = []
+        occurrences: Dict[int, int] = {}
+        last = len(codes) - 1
+        part = 0
+        result: List[Optional[Tuple[Tuple[int, ...], int]]] = [None]
+
+        def visit(node: int) -> int:
+            nonlocal part
+            node_flags = flags[node]
+            if node_flags & NO_SUBSTRUCTURE:
+                return _CONTINUE
+
+            if node == codes[part]:
+                if part == last:
+                    result[0] = self._complete(stack, node)
+                    return _STOP
+                part += 1
+            elif node_flags & LEAF:
+                return _SKIP_SUBTREE
+
+            # Product selections repeat below each function, as in Gmod.traverse
+            is_assignment = (
+                stack and flags[stack[-1]] & FUNCTION and node_flags & PRODUCT_SELECTION
+            )
+            if not is_assignment and occurrences.get(node, 0) >= 1:
+                return _SKIP_SUBTREE
+
+            stack.append(node)
+            occurrences[node] = occurrences.get(node, 0) + 1
+            for i in range(child_offsets[node], child_offsets[node + 1]):
+                if visit(children[i]) == _STOP:
+                    return _STOP
+            stack.pop()
+            occurrences[node] -= 1
+            return _CONTINUE
+
+        visit(codes[0])
+        return result[0]
+
+    def _complete(
+        self, traversed: List[int], end: int
+    ) -> Optional[Tuple[Tuple[int, ...], int]]:
+        # Walks up from the first code while the parent is unambiguous
+        if traversed and self.parent_count(traversed[0]) == 1:
+            start: Optional[int] = self.first_parent(traversed[0])
+        elif self.parent_count(end) == 1:
+            start = self.first_parent(end)
+        else:
+            start = None
+        if start is None or self.parent_count(start) > 1:
+            return None
+
+        above: List[int] = []
+        while self.parent_count(start) == 1:
+            above.append(start)
+            start = self.first_parent(start)
+            if self.parent_count(start) > 1:
+                return None
+        above.append(self.root)
+        above.reverse()
+        return tuple(above + traversed + [end]), len(above)
+
+    def location_sets(
+        self, path: Sequence[int], locations: List[Optional[Location]]
+    ) -> bool:
+        """Spreads the locations over the individualizable sets of the path,
+        like ``LocationSetsVisitor``, updating ``locations`` in place.
+
+        Returns:
+            False if a location is on a node that can't be individualized
+        """
+        flags = self.flags
+        last = len(path) - 1
+        current_parent_start = -1
+
+        for i, node in enumerate(path):
+            is_target = i == last
+            found: Optional[Tuple[int, int, Optional[Location]]] = None
+            if current_parent_start == -1:
+                if flags[node] & POTENTIAL_PARENT:
+                    current_parent_start = i
+                if self.is_individualizable(node, is_target, False):
+                    found = (i, i, locations[i])
+            elif flags[node] & POTENTIAL_PARENT or is_target:
+                nodes: Optional[Tuple[int, int, Optional[Location]]] = None
+                if current_parent_start + 1 == i:
+                    if self.is_individualizable(node, is_target, False):
+                        nodes = (i, i, locations[i])
+                else:
+                    skipped_one = -1
+                    has_composition = False
+                    for j in range(current_parent_start + 1, i + 1):
+                        set_node = path[j]
+                        if not self.is_individualizable(set_node, j == last, True):
+                            if nodes is not None:
+                                skipped_one = j
+                            continue
+                        location = locations[j]
+                        if (
+                            nodes
+                            and nodes[2] is not None
+                            and location is not None
+                            and nodes[2] != location
+                        ):
+                            raise Exception(
+                                "Mapping error: different locations in the same "
+                                f"nodeset: {nodes[2]}, {location}"
+                            )
+                        if skipped_one != -1:
+                            raise Exception(
+                                "Can't skip in the middle of individualizable set"
+                            )
+                        if flags[set_node] & FUNCTION_COMPOSITION:
+                            has_composition = True
+                        nodes = (
+                            nodes[0] if nodes else j,
+                            j,
+                            nodes[2] if nodes and nodes[2] is not None else location,
+                        )
+                    if nodes and nodes[0] == nodes[1] and has_composition:
+                        nodes = None
+
+                current_parent_start = i
+                if nodes and any(
+                    flags[path[j]] & LEAF or j == last
+                    for j in range(nodes[0], nodes[1] + 1)
+                ):
+                    found = nodes
+                elif is_target and self.is_individualizable(node, True, False):
+                    found = (i, i, locations[i])
+
+            if found is None:
+                if locations[i] is not None:
+                    return False
+                continue
+            start, end, location = found
+            for j in range(start, end + 1):
+                locations[j] = location
+
+        return True